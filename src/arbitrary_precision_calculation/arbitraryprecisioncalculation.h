@@ -41,8 +41,13 @@
 #define ARBITRARY_PRECISION_CALCULATION_INCLUDES_H_
 
 #include "arbitrary_precision_calculation/operations.h"
+#include "arbitrary_precision_calculation/check_precision_sampler.h"
+#include "arbitrary_precision_calculation/constants.h"
+#include "arbitrary_precision_calculation/elementary_functions.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/random_number_generator.h"
 #include "arbitrary_precision_calculation/parse.h"
 #include "arbitrary_precision_calculation/configuration.h"
+#include "arbitrary_precision_calculation/context.h"
 
 #endif /* ARBITRARY_PRECISION_CALCULATION_INCLUDES_H_ */
@@ -43,6 +43,19 @@
 
 namespace arbitraryprecisioncalculation {
 
+AssertionLevel g_runtime_assertion_level = (AssertionLevel)ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL;
+
+void SetAssertionLevel(AssertionLevel level){
+	if(level > ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL){
+		level = (AssertionLevel)ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL;
+	}
+	g_runtime_assertion_level = level;
+}
+
+AssertionLevel GetAssertionLevel(){
+	return g_runtime_assertion_level;
+}
+
 void __AssertCondition(const char * argument, const char * file, const char * function_name,  int line, std::string message){
 	std::cerr << "Unsatisfied condition \"" << std::string(argument) << "\" in file \"" << std::string(file) << "\" in function \"" 
 			<< std::string(function_name) << "\" at line " << line << ".\n";
@@ -42,8 +42,73 @@
 
 #include <string>
 
+/**
+* @brief The highest assertion level which is compiled into the program (0 = off, 1 = cheap, 2 = paranoid, see arbitraryprecisioncalculation::AssertionLevel).
+*
+* Checks of higher levels are removed by the compiler. The makefile sets this value by the variable ASSERTION_LEVEL.
+*/
+#ifndef ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL
+#define ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL 1
+#endif
+
 namespace arbitraryprecisioncalculation {
 
+/**
+* @brief Specification possibilities which internal consistency checks in hot paths are executed.
+*
+* Conditions which are checked by AssertCondition are always checked.
+* Only conditions checked by AssertConditionAtLevel depend on the assertion level.
+*/
+enum AssertionLevel {
+	/**
+	* @brief No internal consistency checks are executed.
+	*/
+	ASSERTION_LEVEL_OFF = 0,
+	/**
+	* @brief Checks with constant cost are executed, e.g. the bookkeeping of the mpf_t pool.
+	*/
+	ASSERTION_LEVEL_CHEAP = 1,
+	/**
+	* @brief All checks are executed, including checks whose cost grows with the precision like the verification of every limb of cloned values.
+	*/
+	ASSERTION_LEVEL_PARANOID = 2
+};
+
+/**
+* @brief The assertion level which is active at runtime. It never exceeds the compiled assertion level.
+*/
+extern AssertionLevel g_runtime_assertion_level;
+
+/**
+* @brief Checks whether the checks of the given assertion level are executed.
+*
+* The compiled assertion level is a constant, hence checks above it are removed by the compiler.
+*
+* @param level The assertion level of the check.
+*
+* @retval true If the checks of the given level are executed.
+* @retval false otherwise.
+*/
+inline bool IsAssertionLevelActive(AssertionLevel level) {
+	return level <= ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL && level <= g_runtime_assertion_level;
+}
+
+/**
+* @brief Sets the assertion level which is active at runtime.
+*
+* Levels above the compiled assertion level are reduced to the compiled assertion level.
+*
+* @param level The new assertion level.
+*/
+void SetAssertionLevel(AssertionLevel level);
+
+/**
+* @brief Returns the assertion level which is active at runtime.
+*
+* @return The active assertion level.
+*/
+AssertionLevel GetAssertionLevel();
+
 /**
 * @brief If EX is evaluated to false then it prints the given information to stderr and let the program terminate with exit code 1.
 *
@@ -52,6 +117,17 @@ namespace arbitraryprecisioncalculation {
 */
 #define AssertCondition(EX, MSG) (void)((EX) || (__AssertCondition (#EX, __FILE__, __func__, __LINE__, MSG),0))
 
+/**
+* @brief If the given assertion level is active and EX is evaluated to false then it prints the given information to stderr and let the program terminate with exit code 1.
+*
+* EX is not evaluated if the assertion level is not active (see IsAssertionLevelActive).
+*
+* @param LEVEL The assertion level of the check.
+* @param EX The expression which should be checked.
+* @param MSG A special message which will be displayed if EX is not true.
+*/
+#define AssertConditionAtLevel(LEVEL, EX, MSG) (void)(!IsAssertionLevelActive(LEVEL) || (EX) || (__AssertCondition (#EX, __FILE__, __func__, __LINE__, MSG),0))
+
 /**
 * @brief Prints the given information to stderr and let the program terminate with exit code 1.
 *
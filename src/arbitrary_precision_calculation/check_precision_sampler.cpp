@@ -0,0 +1,127 @@
+/**
+* @file   arbitrary_precision_calculation/check_precision_sampler.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the implementation of the sampler which decides whether a probabilistic precision check is done.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/check_precision_sampler.h"
+
+#include <cmath>
+#include <sstream>
+
+namespace arbitraryprecisioncalculation {
+
+CheckPrecisionSampler::CheckPrecisionSampler(unsigned long long seed, bool adaptive) :
+		initial_seed_(seed), adaptive_(adaptive), state_(seed), remaining_gap_(0),
+		gap_probability_(-1.0), rate_reduction_(0), checks_without_recommendation_(0) {}
+
+bool CheckPrecisionSampler::ShouldCheck(double probability) {
+	double effective_probability = GetEffectiveProbability(probability);
+	if(effective_probability != gap_probability_) {
+		// The gaps are memoryless, hence a new gap can be drawn whenever the probability changes.
+		DrawGap(effective_probability);
+	}
+	if(remaining_gap_ > 0) {
+		--remaining_gap_;
+		return false;
+	}
+	DrawGap(effective_probability);
+	return true;
+}
+
+void CheckPrecisionSampler::ReportCheckResult(bool recommended) {
+	if(!adaptive_) return;
+	if(recommended) {
+		rate_reduction_ = 0;
+		checks_without_recommendation_ = 0;
+		return;
+	}
+	++checks_without_recommendation_;
+	if(checks_without_recommendation_ >= ADAPTATION_WINDOW) {
+		checks_without_recommendation_ = 0;
+		if(rate_reduction_ < MAXIMAL_RATE_REDUCTION) ++rate_reduction_;
+	}
+}
+
+double CheckPrecisionSampler::GetEffectiveProbability(double probability) {
+	return std::ldexp(probability, -rate_reduction_);
+}
+
+unsigned long long CheckPrecisionSampler::RandomUnsignedLongLong() {
+	unsigned long long z = (state_ += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+void CheckPrecisionSampler::DrawGap(double probability) {
+	gap_probability_ = probability;
+	if(probability >= 1.0) {
+		remaining_gap_ = 0;
+		return;
+	}
+	if(probability <= 0.0) {
+		remaining_gap_ = (1LL << 62);
+		return;
+	}
+	// uniform value in (0,1] from the upper 53 bits
+	double uniform = std::ldexp((double)((RandomUnsignedLongLong() >> 11) + 1), -53);
+	double gap = std::floor(std::log(uniform) / std::log1p(-probability));
+	if(gap >= std::ldexp(1.0, 62)) remaining_gap_ = (1LL << 62);
+	else remaining_gap_ = (long long) gap;
+}
+
+void CheckPrecisionSampler::LoadData(std::ifstream* inputstream){
+	(*inputstream) >> state_ >> remaining_gap_ >> gap_probability_ >> rate_reduction_ >> checks_without_recommendation_;
+}
+
+void CheckPrecisionSampler::StoreData(std::ofstream* outputstream){
+	// the probability is stored with enough digits such that the loaded value is identical
+	std::streamsize old_precision = outputstream->precision(17);
+	(*outputstream) << state_ << " " << remaining_gap_ << " " << gap_probability_ << " "
+			<< rate_reduction_ << " " << checks_without_recommendation_ << std::endl;
+	outputstream->precision(old_precision);
+}
+
+std::string CheckPrecisionSampler::GetName(){
+	std::ostringstream os;
+	os << "GG";
+	if(adaptive_) os << "A";
+	os << initial_seed_;
+	return os.str();
+}
+
+} // namespace arbitraryprecisioncalculation
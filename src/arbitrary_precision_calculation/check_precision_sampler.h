@@ -0,0 +1,155 @@
+/**
+* @file   arbitrary_precision_calculation/check_precision_sampler.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the sampler which decides whether a probabilistic precision check is done.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_CHECK_PRECISION_SAMPLER_H_
+#define ARBITRARY_PRECISION_CALCULATION_CHECK_PRECISION_SAMPLER_H_
+
+#include <fstream>
+#include <string>
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief This class decides which additions and subtractions are checked if the check precision probability is less than one.
+*
+* Instead of drawing a random mpf_t value from the standard random number generator for each addition
+* the sampler draws the number of additions which are skipped until the next check.
+* This number is geometrically distributed and is calculated from a single 64 bit random integer.
+* The sampler has its own random number generator such that the random numbers of the optimization are not consumed.
+*/
+class CheckPrecisionSampler {
+public:
+	/**
+	* @brief The constructor.
+	*
+	* @param seed The initial seed of the internal random number generator.
+	* @param adaptive Specifies whether the sampling rate is adapted to the results of the recent checks.
+	*/
+	CheckPrecisionSampler(unsigned long long seed, bool adaptive);
+
+	/**
+	* @brief Decides whether the current addition or subtraction should be checked.
+	*
+	* @param probability The check precision probability.
+	*
+	* @retval TRUE if the precision of the current calculation should be checked.
+	* @retval FALSE otherwise.
+	*/
+	bool ShouldCheck(double probability);
+
+	/**
+	* @brief Informs the sampler about the result of a check.
+	*
+	* If the sampler is adaptive then the sampling rate is halved after each series of
+	* ADAPTATION_WINDOW checks without a recommendation, but it is never reduced to less than
+	* 2<sup>-MAXIMAL_RATE_REDUCTION</sup> times the check precision probability.
+	* A check which recommends an increase of the precision restores the full check precision probability.
+	*
+	* @param recommended Specifies whether the check recommended an increase of the precision.
+	*/
+	void ReportCheckResult(bool recommended);
+
+	/**
+	* @brief Returns the probability with which the sampler actually checks calculations.
+	*
+	* @param probability The check precision probability.
+	*
+	* @return The given probability reduced by the current adaptation.
+	*/
+	double GetEffectiveProbability(double probability);
+
+	/**
+	* @brief Creates a random long long value.
+	*
+	* The internal random number generator is a SplitMix64 generator.
+	*
+	* @return The random value.
+	*/
+	unsigned long long RandomUnsignedLongLong();
+
+	/**
+	* @brief Loads the state of the sampler from the given stream.
+	*
+	* @param input_stream The input stream.
+	*/
+	void LoadData(std::ifstream* input_stream);
+
+	/**
+	* @brief Stores the state of the sampler to the given stream.
+	*
+	* @param output_stream The output stream.
+	*/
+	void StoreData(std::ofstream* output_stream);
+
+	/**
+	* @brief Returns the name of the sampler, which contains the initial seed.
+	*
+	* @return The name of the sampler.
+	*/
+	std::string GetName();
+
+	/**
+	* @brief Number of consecutive checks without recommendation after which the adaptive sampler halves its rate.
+	*/
+	static const long long ADAPTATION_WINDOW = 1024;
+	/**
+	* @brief Maximal number of halvings of the rate of the adaptive sampler.
+	*/
+	static const int MAXIMAL_RATE_REDUCTION = 6;
+
+private:
+	/**
+	* @brief Draws the number of additions which are skipped until the next check.
+	*
+	* @param probability The probability with which each addition should be checked.
+	*/
+	void DrawGap(double probability);
+
+	const unsigned long long initial_seed_;
+	const bool adaptive_;
+	unsigned long long state_;
+	long long remaining_gap_;
+	double gap_probability_;
+	int rate_reduction_;
+	long long checks_without_recommendation_;
+};
+
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_CHECK_PRECISION_SAMPLER_H_ */
@@ -39,6 +39,7 @@
 
 #include "arbitrary_precision_calculation/configuration.h"
 
+#include "arbitrary_precision_calculation/context.h"
 #include "arbitrary_precision_calculation/random_number_generator.h"
 
 namespace arbitraryprecisioncalculation {
@@ -47,16 +48,21 @@ int Configuration::initial_precision_ = 32;
 bool Configuration::initial_precision_already_set_ = false;
 int Configuration::precision_safety_margin_ = 32;
 
+// The precision check settings and the algorithm selectors are shared by all contexts.
+// They are set while the configuration is read and must not be changed while several contexts are used by different threads.
 arbitraryprecisioncalculation::configuration::CheckPrecisionMode Configuration::check_precision_mode_ = arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS;
+arbitraryprecisioncalculation::configuration::CheckPrecisionAlgorithm Configuration::check_precision_algorithm_ = arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_TRIAL_ADDITION;
+arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm Configuration::elementary_function_algorithm_ = arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE;
+arbitraryprecisioncalculation::configuration::ConstantAlgorithm Configuration::constant_algorithm_ = arbitraryprecisioncalculation::configuration::CONSTANT_ALGORITHM_REFERENCE;
+arbitraryprecisioncalculation::configuration::GaussianAlgorithm Configuration::gaussian_algorithm_ = arbitraryprecisioncalculation::configuration::GAUSSIAN_ALGORITHM_REFERENCE;
 double Configuration::check_precision_probability_ = 1.00;
 // <= 0 -> surely not check
 // >= 1 -> surely check
 // > 0 && < 1 -> randomly check
-bool Configuration::increase_precision_recommended_ = false;
 
 int Configuration::output_precision_ = 5;
-
-RandomNumberGenerator* Configuration::standard_random_number_generator_ = new FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 0);
+arbitraryprecisioncalculation::configuration::OutputFormat Configuration::output_format_ = arbitraryprecisioncalculation::configuration::OUTPUT_FORMAT_DECIMAL;
+arbitraryprecisioncalculation::configuration::StorageFormat Configuration::storage_format_ = arbitraryprecisioncalculation::configuration::STORAGE_FORMAT_TEXT;
 
 void Configuration::Init(){
 
@@ -65,12 +71,20 @@ void Configuration::Init(){
 	precision_safety_margin_ = 32;
 
 	check_precision_mode_ = arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS;
+	check_precision_algorithm_ = arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_TRIAL_ADDITION;
+	elementary_function_algorithm_ = arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE;
+	constant_algorithm_ = arbitraryprecisioncalculation::configuration::CONSTANT_ALGORITHM_REFERENCE;
+	gaussian_algorithm_ = arbitraryprecisioncalculation::configuration::GAUSSIAN_ALGORITHM_REFERENCE;
 	check_precision_probability_ = 1.00;
-	increase_precision_recommended_ = false;
 
 	output_precision_ = 5;
+	output_format_ = arbitraryprecisioncalculation::configuration::OUTPUT_FORMAT_DECIMAL;
+	storage_format_ = arbitraryprecisioncalculation::configuration::STORAGE_FORMAT_TEXT;
 
-	standard_random_number_generator_ = new FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 0);
+	Context* context = Context::GetCurrent();
+	context->SetCheckPrecisionSampler(NULL);
+	context->SetIncreasePrecisionRecommended(false);
+	context->SetStandardRandomNumberGenerator(new FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 0));
 }
 
 
@@ -83,6 +97,50 @@ void Configuration::setCheckPrecisionMode(
 	check_precision_mode_ = checkPrecisionMode;
 }
 
+arbitraryprecisioncalculation::configuration::CheckPrecisionAlgorithm Configuration::getCheckPrecisionAlgorithm() {
+	return check_precision_algorithm_;
+}
+
+void Configuration::setCheckPrecisionAlgorithm(
+		arbitraryprecisioncalculation::configuration::CheckPrecisionAlgorithm checkPrecisionAlgorithm) {
+	check_precision_algorithm_ = checkPrecisionAlgorithm;
+}
+
+arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm Configuration::getElementaryFunctionAlgorithm() {
+	return elementary_function_algorithm_;
+}
+
+void Configuration::setElementaryFunctionAlgorithm(
+		arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm elementaryFunctionAlgorithm) {
+	elementary_function_algorithm_ = elementaryFunctionAlgorithm;
+}
+
+arbitraryprecisioncalculation::configuration::ConstantAlgorithm Configuration::getConstantAlgorithm() {
+	return constant_algorithm_;
+}
+
+void Configuration::setConstantAlgorithm(
+		arbitraryprecisioncalculation::configuration::ConstantAlgorithm constantAlgorithm) {
+	constant_algorithm_ = constantAlgorithm;
+}
+
+arbitraryprecisioncalculation::configuration::GaussianAlgorithm Configuration::getGaussianAlgorithm() {
+	return gaussian_algorithm_;
+}
+
+void Configuration::setGaussianAlgorithm(
+		arbitraryprecisioncalculation::configuration::GaussianAlgorithm gaussianAlgorithm) {
+	gaussian_algorithm_ = gaussianAlgorithm;
+}
+
+std::string Configuration::getArithmeticBackend() {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	return "mpfr";
+#else
+	return "gmp";
+#endif
+}
+
 double Configuration::getCheckPrecisionProbability() {
 	return check_precision_probability_;
 }
@@ -91,16 +149,24 @@ void Configuration::setCheckPrecisionProbability(double checkPrecisionProbabilit
 	check_precision_probability_ = checkPrecisionProbability;
 }
 
+CheckPrecisionSampler* Configuration::getCheckPrecisionSampler() {
+	return Context::GetCurrent()->GetCheckPrecisionSampler();
+}
+
+void Configuration::setCheckPrecisionSampler(CheckPrecisionSampler* checkPrecisionSampler) {
+	Context::GetCurrent()->SetCheckPrecisionSampler(checkPrecisionSampler);
+}
+
 bool Configuration::isIncreasePrecisionRecommended() {
-	return increase_precision_recommended_;
+	return Context::GetCurrent()->IsIncreasePrecisionRecommended();
 }
 
 void Configuration::ResetIncreasePrecisionRecommended() {
-	increase_precision_recommended_ = false;
+	Context::GetCurrent()->SetIncreasePrecisionRecommended(false);
 }
 
 void Configuration::RecommendIncreasePrecision() {
-	increase_precision_recommended_ = true;
+	Context::GetCurrent()->SetIncreasePrecisionRecommended(true);
 }
 
 int Configuration::getInitialPrecision() {
@@ -109,7 +175,7 @@ int Configuration::getInitialPrecision() {
 
 void Configuration::setInitialPrecision(int initialPrecision) {
 	initial_precision_ = initialPrecision;
-	mpf_set_default_prec(initialPrecision);
+	Context::GetCurrent()->SetPrecision(initialPrecision);
 	if(!initial_precision_already_set_){
 		initial_precision_already_set_ = true;
 		setPrecisionSafetyMargin(initialPrecision);
@@ -124,6 +190,22 @@ void Configuration::setOutputPrecision(int outputPrecision) {
 	output_precision_ = outputPrecision;
 }
 
+arbitraryprecisioncalculation::configuration::OutputFormat Configuration::getOutputFormat() {
+	return output_format_;
+}
+
+void Configuration::setOutputFormat(arbitraryprecisioncalculation::configuration::OutputFormat outputFormat) {
+	output_format_ = outputFormat;
+}
+
+arbitraryprecisioncalculation::configuration::StorageFormat Configuration::getStorageFormat() {
+	return storage_format_;
+}
+
+void Configuration::setStorageFormat(arbitraryprecisioncalculation::configuration::StorageFormat storageFormat) {
+	storage_format_ = storageFormat;
+}
+
 int Configuration::getPrecisionSafetyMargin() {
 	return precision_safety_margin_;
 }
@@ -137,13 +219,13 @@ void Configuration::setPrecisionSafetyMargin(int precisionSafetyMargin) {
 }
 
 RandomNumberGenerator* Configuration::getStandardRandomNumberGenerator() {
-	return standard_random_number_generator_;
+	return Context::GetCurrent()->GetStandardRandomNumberGenerator();
 }
 
 
 void Configuration::setStandardRandomNumberGenerator(
 		RandomNumberGenerator* standardRandomNumberGenerator) {
-	standard_random_number_generator_ = standardRandomNumberGenerator;
+	Context::GetCurrent()->SetStandardRandomNumberGenerator(standardRandomNumberGenerator);
 }
 
 } // namespace arbitraryprecisioncalculation
@@ -43,6 +43,7 @@
 #include <string>
 #include <vector>
 
+#include "arbitrary_precision_calculation/check_precision_sampler.h"
 #include "arbitrary_precision_calculation/random_number_generator.h"
 
 /**
@@ -69,7 +70,103 @@ enum CheckPrecisionMode {
 	/**
 	* @brief The precision is never checked.
 	*/
-	CHECK_PRECISION_NEVER
+	CHECK_PRECISION_NEVER,
+	/**
+	* @brief Each value carries an error radius (ball arithmetic), which is propagated through the operations.
+	* Additions and subtractions are not checked. An increase of the precision is recommended as soon as
+	* a comparison with a context (mpftoperations::Compare with three arguments) cannot be decided because the balls of the operands overlap.
+	*/
+	CHECK_PRECISION_BALL
+};
+/**
+* @brief Specification possibilities how the precision check on additions and subtractions decides whether the precision should be increased.
+*/
+enum CheckPrecisionAlgorithm {
+	/**
+	* @brief The smallest absolute value of the operands and the result is scaled down by the precision safety margin and added to the largest one. If the largest value does not change then the precision should be increased.
+	*/
+	CHECK_PRECISION_ALGORITHM_TRIAL_ADDITION,
+	/**
+	* @brief The same decision as for the trial addition is derived from the exponents and limb counts of the operands and the result with integer arithmetic only.
+	*/
+	CHECK_PRECISION_ALGORITHM_EXPONENT,
+	/**
+	* @brief Both algorithms are executed. The decision of the trial addition is used and disagreements of the exponent based algorithm are reported.
+	*/
+	CHECK_PRECISION_ALGORITHM_REGRESSION
+};
+/**
+* @brief Specification possibilities which implementations of elementary functions like the exponential function and the logarithm are used.
+*/
+enum ElementaryFunctionAlgorithm {
+	/**
+	* @brief The original implementations are used. They evaluate Taylor series after halving the argument or taking square roots and check the precision of their internal additions.
+	* Results of previous program versions are reproduced exactly.
+	*/
+	ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE,
+	/**
+	* @brief The fast kernels of the elementaryfunctions namespace are used. They reduce the argument by multiples of ln(2) or Pi / 2 or by a table of arcus tangents and use rectangular splitting or the arithmetic-geometric mean.
+	* The results may differ from the original implementations in the last bits.
+	*/
+	ELEMENTARY_FUNCTION_ALGORITHM_FAST
+};
+/**
+* @brief Specification possibilities how the mathematical constants Pi and e are calculated.
+*/
+enum ConstantAlgorithm {
+	/**
+	* @brief The original implementations are used. They recalculate the constant by a series whenever the default precision changes.
+	* Results of previous program versions are reproduced exactly.
+	*/
+	CONSTANT_ALGORITHM_REFERENCE,
+	/**
+	* @brief The constants namespace is used. It calculates the constants by binary splitting and serves lower precisions by truncation of the most precise value.
+	* The results may differ from the original implementations in the last bits.
+	*/
+	CONSTANT_ALGORITHM_ENGINE
+};
+/**
+* @brief Specification possibilities how random values with normal distribution are generated (see mpftoperations::GetGaussianRandomMpft).
+*/
+enum GaussianAlgorithm {
+	/**
+	* @brief The original variant of the Box Muller method is used. Each value needs a logarithm, two square roots and a division.
+	* Results of previous program versions are reproduced exactly.
+	*/
+	GAUSSIAN_ALGORITHM_REFERENCE,
+	/**
+	* @brief The polar method of Marsaglia is used. One logarithm, one square root and one division yield a pair of independent values.
+	* Vector fills use both values of each pair. The generated values differ from the reference algorithm.
+	*/
+	GAUSSIAN_ALGORITHM_POLAR
+};
+/**
+* @brief Specification possibilities how mpf_t values are converted to strings (see mpftoperations::MpftToString).
+*/
+enum OutputFormat {
+	/**
+	* @brief The values are written in decimal scientific notation with the output precision.
+	*/
+	OUTPUT_FORMAT_DECIMAL,
+	/**
+	* @brief The values are written exactly in hexadecimal notation with a binary exponent (e.g. 0x1.8p+0 for 1.5).
+	* The output precision is ignored.
+	*/
+	OUTPUT_FORMAT_HEXADECIMAL
+};
+/**
+* @brief Specification possibilities how mpf_t values are written by mpftoperations::StoreMpft.
+*/
+enum StorageFormat {
+	/**
+	* @brief The size, the precision, the exponent and the limbs are written as decimal text.
+	*/
+	STORAGE_FORMAT_TEXT,
+	/**
+	* @brief The values are written as compact binary records with raw little-endian limbs.
+	* mpftoperations::LoadMpft reads both formats.
+	*/
+	STORAGE_FORMAT_BINARY
 };
 } // namespace configuration
 
@@ -94,11 +191,88 @@ public:
 	/**
 	 * @brief Setter function for the check precision mode. Stores the given check precision mode.
 	 *
+	 * The setting is shared by all contexts. It must not be changed while other threads calculate with their contexts.
+	 *
 	 * @param checkPrecisionMode The new check precision mode.
 	 */
 	static void setCheckPrecisionMode(
 			arbitraryprecisioncalculation::configuration::CheckPrecisionMode checkPrecisionMode);
 
+	/**
+	 * @brief Getter function for the check precision algorithm.
+	 *
+	 * @return The current check precision algorithm.
+	 */
+	static arbitraryprecisioncalculation::configuration::CheckPrecisionAlgorithm getCheckPrecisionAlgorithm();
+
+	/**
+	 * @brief Setter function for the check precision algorithm. Stores the given check precision algorithm.
+	 *
+	 * The setting is shared by all contexts. It must not be changed while other threads calculate with their contexts.
+	 *
+	 * @param checkPrecisionAlgorithm The new check precision algorithm.
+	 */
+	static void setCheckPrecisionAlgorithm(
+			arbitraryprecisioncalculation::configuration::CheckPrecisionAlgorithm checkPrecisionAlgorithm);
+
+	/**
+	 * @brief Getter function for the elementary function algorithm.
+	 *
+	 * @return The current elementary function algorithm.
+	 */
+	static arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm getElementaryFunctionAlgorithm();
+
+	/**
+	 * @brief Setter function for the elementary function algorithm. Stores the given elementary function algorithm.
+	 *
+	 * The setting is shared by all contexts. It must not be changed while other threads calculate with their contexts.
+	 *
+	 * @param elementaryFunctionAlgorithm The new elementary function algorithm.
+	 */
+	static void setElementaryFunctionAlgorithm(
+			arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm elementaryFunctionAlgorithm);
+
+	/**
+	 * @brief Getter function for the constant algorithm.
+	 *
+	 * @return The current constant algorithm.
+	 */
+	static arbitraryprecisioncalculation::configuration::ConstantAlgorithm getConstantAlgorithm();
+
+	/**
+	 * @brief Setter function for the constant algorithm. Stores the given constant algorithm.
+	 *
+	 * The setting is shared by all contexts. It must not be changed while other threads calculate with their contexts.
+	 *
+	 * @param constantAlgorithm The new constant algorithm.
+	 */
+	static void setConstantAlgorithm(
+			arbitraryprecisioncalculation::configuration::ConstantAlgorithm constantAlgorithm);
+
+	/**
+	 * @brief Getter function for the gaussian algorithm.
+	 *
+	 * @return The current gaussian algorithm.
+	 */
+	static arbitraryprecisioncalculation::configuration::GaussianAlgorithm getGaussianAlgorithm();
+
+	/**
+	 * @brief Setter function for the gaussian algorithm. Stores the given gaussian algorithm.
+	 *
+	 * The setting is shared by all contexts. It must not be changed while other threads calculate with their contexts.
+	 *
+	 * @param gaussianAlgorithm The new gaussian algorithm.
+	 */
+	static void setGaussianAlgorithm(
+			arbitraryprecisioncalculation::configuration::GaussianAlgorithm gaussianAlgorithm);
+
+	/**
+	 * @brief Getter function for the arithmetic backend, which is selected at build time.
+	 *
+	 * @return "gmp" for the default backend and "mpfr" if the elementary functions and constants are evaluated by MPFR.
+	 */
+	static std::string getArithmeticBackend();
+
 	/**
 	 * @brief Getter function for the check precision probability.
 	 *
@@ -109,12 +283,31 @@ public:
 	/**
 	 * @brief Setter function for the check precision probability. Stores the given check precision probability.
 	 *
+	 * The setting is shared by all contexts. It must not be changed while other threads calculate with their contexts.
+	 *
 	 * @param checkPrecisionProbability The new check precision probability.
 	 */
 	static void setCheckPrecisionProbability(double checkPrecisionProbability);
 
 	/**
-	 * @brief Status function for increasing precision.
+	 * @brief Getter function for the check precision sampler of the current context (see Context).
+	 *
+	 * @return The current check precision sampler or NULL if the standard random number generator decides which calculations are checked.
+	 */
+	static CheckPrecisionSampler* getCheckPrecisionSampler();
+
+	/**
+	 * @brief Setter function for the check precision sampler of the current context. Stores the given check precision sampler.
+	 *
+	 * If the check precision probability is less than one then the sampler decides which calculations are checked.
+	 * If the sampler is NULL then a random value of the standard random number generator is drawn for each calculation instead.
+	 *
+	 * @param checkPrecisionSampler The new check precision sampler.
+	 */
+	static void setCheckPrecisionSampler(CheckPrecisionSampler* checkPrecisionSampler);
+
+	/**
+	 * @brief Status function for increasing precision in the current context (see Context).
 	 *
 	 * @retval TRUE if calculations recommend an increase of the precision.
 	 * @retval FALSE otherwise.
@@ -139,7 +332,7 @@ public:
 	static int getInitialPrecision();
 
 	/**
-	 * @brief Setter function for the initial precision. Stores the given initial precision.
+	 * @brief Setter function for the initial precision. Stores the given initial precision and sets the precision of the current context.
 	 *
 	 * @param initialPrecision The new initial precision.
 	 */
@@ -159,6 +352,34 @@ public:
 	 */
 	static void setOutputPrecision(int outputPrecision);
 
+	/**
+	 * @brief Getter function for the output format.
+	 *
+	 * @return The current output format.
+	 */
+	static arbitraryprecisioncalculation::configuration::OutputFormat getOutputFormat();
+
+	/**
+	 * @brief Setter function for the output format. Stores the given output format.
+	 *
+	 * @param outputFormat The new output format.
+	 */
+	static void setOutputFormat(arbitraryprecisioncalculation::configuration::OutputFormat outputFormat);
+
+	/**
+	 * @brief Getter function for the storage format.
+	 *
+	 * @return The current storage format.
+	 */
+	static arbitraryprecisioncalculation::configuration::StorageFormat getStorageFormat();
+
+	/**
+	 * @brief Setter function for the storage format. Stores the given storage format.
+	 *
+	 * @param storageFormat The new storage format.
+	 */
+	static void setStorageFormat(arbitraryprecisioncalculation::configuration::StorageFormat storageFormat);
+
 	/**
 	 * @brief Getter function for the precision safety margin.
 	 *
@@ -174,14 +395,14 @@ public:
 	static void setPrecisionSafetyMargin(int precisionSafetyMargin);
 
 	/**
-	 * @brief Getter function for the standard random number generator.
+	 * @brief Getter function for the standard random number generator of the current context (see Context).
 	 *
 	 * @return The currently stored standard random number generator.
 	 */
 	static RandomNumberGenerator* getStandardRandomNumberGenerator();
 
 	/**
-	 * @brief Setter function for the standard random number generator. Stores the given standard random number generator.
+	 * @brief Setter function for the standard random number generator of the current context. Stores the given standard random number generator.
 	 *
 	 * @param standardRandomNumberGenerator The new standard random number generator.
 	 */
@@ -209,24 +430,39 @@ private:
 	*/
 	static arbitraryprecisioncalculation::configuration::CheckPrecisionMode check_precision_mode_;
 	/**
-	* @brief Specifies the probability whether a precision check is actually done.
+	* @brief Stores the information how precision checks decide whether the precision should be increased.
 	*/
-	static double check_precision_probability_;
+	static arbitraryprecisioncalculation::configuration::CheckPrecisionAlgorithm check_precision_algorithm_;
+	/**
+	* @brief Stores the information which implementations of elementary functions are used.
+	*/
+	static arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm elementary_function_algorithm_;
+	/**
+	* @brief Stores the information how the mathematical constants are calculated.
+	*/
+	static arbitraryprecisioncalculation::configuration::ConstantAlgorithm constant_algorithm_;
 	/**
-	* @brief Specifies whether the precision will be increased shortly.
+	* @brief Stores the information how random values with normal distribution are generated.
 	*/
-	static bool increase_precision_recommended_;
+	static arbitraryprecisioncalculation::configuration::GaussianAlgorithm gaussian_algorithm_;
+	/**
+	* @brief Specifies the probability whether a precision check is actually done.
+	*/
+	static double check_precision_probability_;
 
 	/**
 	* @brief Specifies the number of digits for the output of mpf_t values while using printing functions.
 	* The value -1 specifies that the output precision should match the current precision of the mpf_t data type.
 	*/
 	static int output_precision_;
-
 	/**
-	* @brief Specifies the random number generator for the particle swarm optimization algorithm.
+	* @brief Specifies the format for the output of mpf_t values while using printing functions.
+	*/
+	static arbitraryprecisioncalculation::configuration::OutputFormat output_format_;
+	/**
+	* @brief Specifies the format in which mpf_t values are stored.
 	*/
-	static RandomNumberGenerator* standard_random_number_generator_;
+	static arbitraryprecisioncalculation::configuration::StorageFormat storage_format_;
 
 
 }; // class Configuration
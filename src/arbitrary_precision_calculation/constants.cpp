@@ -0,0 +1,424 @@
+/**
+* @file   arbitrary_precision_calculation/constants.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the engine for mathematical constants.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/constants.h"
+#include "arbitrary_precision_calculation/context.h"
+#include "arbitrary_precision_calculation/mpfr_backend.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace arbitraryprecisioncalculation {
+namespace constants {
+
+namespace {
+
+// Name of the cache file which was loaded by LoadCacheFile. Contexts which are created afterwards use this file.
+// Like the configuration it is shared by all contexts and must not be changed while other threads calculate.
+std::string loaded_cache_file_name_ = "";
+
+// Number which distinguishes the temporary files of the contexts.
+std::atomic<unsigned long> next_cache_id_(0);
+
+// Term k of a series sum_k a(k) / b(k) * p(0) ... p(k) / (q(0) ... q(k)) with integer values.
+typedef void (*SeriesTerm)(unsigned long k, unsigned long parameter, mpz_t p, mpz_t q, mpz_t a, mpz_t b);
+
+// Binary splitting of the terms from (inclusive) to to (exclusive).
+// Afterwards p and q are the products of p(k) and q(k), b is the product of b(k)
+// and the partial sum equals t / (b q).
+void binarySplitting(unsigned long from, unsigned long to, SeriesTerm term, unsigned long parameter, mpz_t p, mpz_t q, mpz_t b, mpz_t t) {
+	if(to - from == 1) {
+		term(from, parameter, p, q, t, b);
+		mpz_mul(t, t, p);
+		return;
+	}
+	unsigned long middle = from + (to - from) / 2;
+	mpz_t p_right, q_right, b_right, t_right;
+	mpz_init(p_right);
+	mpz_init(q_right);
+	mpz_init(b_right);
+	mpz_init(t_right);
+	binarySplitting(from, middle, term, parameter, p, q, b, t);
+	binarySplitting(middle, to, term, parameter, p_right, q_right, b_right, t_right);
+	// t = b_right q_right t + b p t_right
+	mpz_mul(t, t, b_right);
+	mpz_mul(t, t, q_right);
+	mpz_mul(t_right, t_right, b);
+	mpz_mul(t_right, t_right, p);
+	mpz_add(t, t, t_right);
+	mpz_mul(p, p, p_right);
+	mpz_mul(q, q, q_right);
+	mpz_mul(b, b, b_right);
+	mpz_clear(p_right);
+	mpz_clear(q_right);
+	mpz_clear(b_right);
+	mpz_clear(t_right);
+}
+
+// Stores the sum of the first terms of the series in result.
+// If invert is true then the reciprocal of the sum is stored.
+void sumSeries(mpf_t result, unsigned long terms, SeriesTerm term, unsigned long parameter, bool invert, mp_bitcnt_t bits) {
+	mpz_t p, q, b, t;
+	mpz_init(p);
+	mpz_init(q);
+	mpz_init(b);
+	mpz_init(t);
+	binarySplitting(0, terms, term, parameter, p, q, b, t);
+	mpz_mul(b, b, q);
+	mpf_t numerator, denominator;
+	mpf_init2(numerator, bits);
+	mpf_init2(denominator, bits);
+	mpf_set_z(numerator, invert ? b : t);
+	mpf_set_z(denominator, invert ? t : b);
+	mpf_div(result, numerator, denominator);
+	mpf_clear(numerator);
+	mpf_clear(denominator);
+	mpz_clear(p);
+	mpz_clear(q);
+	mpz_clear(b);
+	mpz_clear(t);
+}
+
+// 640320^3 / 24
+const unsigned long CHUDNOVSKY_Q_FACTOR = 10939058860032000UL;
+
+// 1 / Pi = 12 / 640320^(3/2) sum_k (-1)^k (6k)! (13591409 + 545140134 k) / ((3k)! (k!)^3 640320^(3k))
+void chudnovskyTerm(unsigned long k, unsigned long, mpz_t p, mpz_t q, mpz_t a, mpz_t b) {
+	mpz_set_ui(b, 1);
+	mpz_set_ui(a, 545140134);
+	mpz_mul_ui(a, a, k);
+	mpz_add_ui(a, a, 13591409);
+	if(k == 0) {
+		mpz_set_ui(p, 1);
+		mpz_set_ui(q, 1);
+		return;
+	}
+	// p(k) / q(k) = -(6k - 5) (2k - 1) (6k - 1) / (k^3 640320^3 / 24)
+	mpz_set_ui(p, 6 * k - 5);
+	mpz_mul_ui(p, p, 2 * k - 1);
+	mpz_mul_ui(p, p, 6 * k - 1);
+	mpz_neg(p, p);
+	mpz_set_ui(q, k);
+	mpz_mul_ui(q, q, k);
+	mpz_mul_ui(q, q, k);
+	mpz_mul_ui(q, q, CHUDNOVSKY_Q_FACTOR);
+}
+
+void computePi(mpf_t result, mp_bitcnt_t bits) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::Pi(result);
+	return;
+#endif
+	// each term adds about 47.11 bits
+	unsigned long terms = bits / 47 + 2;
+	mpf_t factor;
+	mpf_init2(factor, bits);
+	// Pi = 426880 sqrt(10005) / sum
+	sumSeries(result, terms, chudnovskyTerm, 0, true, bits);
+	mpf_sqrt_ui(factor, 10005);
+	mpf_mul_ui(factor, factor, 426880);
+	mpf_mul(result, result, factor);
+	mpf_clear(factor);
+}
+
+// atanh(1 / x) = (1 / x) sum_k 1 / ((2k + 1) x^(2k))
+void atanhReciprocalTerm(unsigned long k, unsigned long x, mpz_t p, mpz_t q, mpz_t a, mpz_t b) {
+	mpz_set_ui(p, 1);
+	mpz_set_ui(q, k == 0 ? 1 : x * x);
+	mpz_set_ui(a, 1);
+	mpz_set_ui(b, 2 * k + 1);
+}
+
+void addAtanhReciprocal(mpf_t result, long factor, unsigned long x, mp_bitcnt_t bits) {
+	unsigned long terms = (unsigned long)(bits / (2.0 * std::log2((double)x))) + 2;
+	mpf_t value;
+	mpf_init2(value, bits);
+	sumSeries(value, terms, atanhReciprocalTerm, x, false, bits);
+	mpf_div_ui(value, value, x);
+	if(factor < 0) {
+		mpf_mul_ui(value, value, -factor);
+		mpf_sub(result, result, value);
+	} else {
+		mpf_mul_ui(value, value, factor);
+		mpf_add(result, result, value);
+	}
+	mpf_clear(value);
+}
+
+void computeLn2(mpf_t result, mp_bitcnt_t bits) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::Ln2(result);
+	return;
+#endif
+	mpf_set_ui(result, 0);
+	addAtanhReciprocal(result, 18, 26, bits);
+	addAtanhReciprocal(result, -2, 4801, bits);
+	addAtanhReciprocal(result, 8, 8749, bits);
+}
+
+// e = sum_k 1 / k!
+void eTerm(unsigned long k, unsigned long, mpz_t p, mpz_t q, mpz_t a, mpz_t b) {
+	mpz_set_ui(p, 1);
+	mpz_set_ui(q, k == 0 ? 1 : k);
+	mpz_set_ui(a, 1);
+	mpz_set_ui(b, 1);
+}
+
+void computeE(mpf_t result, mp_bitcnt_t bits) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::E(result);
+	return;
+#endif
+	// the remainder after the terms up to 1 / (n - 1)! is less than 2 / n!
+	unsigned long terms = 2;
+	double factorial_bits = 0.0;
+	while(factorial_bits < bits + 2) {
+		factorial_bits += std::log2((double)terms);
+		terms++;
+	}
+	sumSeries(result, terms, eTerm, 0, false, bits);
+}
+
+void computeSqrt2(mpf_t result, mp_bitcnt_t) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::Sqrt2(result);
+	return;
+#endif
+	mpf_sqrt_ui(result, 2);
+}
+
+// Constant, which is calculated by the function.
+struct ConstantDefinition {
+	const char* name;
+	void (*compute)(mpf_t, mp_bitcnt_t);
+};
+
+const ConstantDefinition CONSTANT_DEFINITIONS[] = {
+		{"pi", computePi},
+		{"ln2", computeLn2},
+		{"e", computeE},
+		{"sqrt2", computeSqrt2}};
+const int NUMBER_OF_CONSTANTS = sizeof(CONSTANT_DEFINITIONS) / sizeof(CONSTANT_DEFINITIONS[0]);
+
+// Cached constant, which is only recomputed if a higher precision is requested.
+struct CachedConstant {
+	mpf_t value;
+	// precision of the value or 0 if it is not calculated yet
+	mp_bitcnt_t bits;
+};
+
+} // namespace
+
+// Cached constants, which are owned by a context such that several contexts can calculate at the same time.
+struct CachedConstants {
+	CachedConstant constants[NUMBER_OF_CONSTANTS];
+	// name of the file in which the constants are persisted, empty if no file is used
+	std::string file_name;
+	// specifies whether the file has been read
+	bool file_loaded;
+	// identifies the temporary file of the context
+	unsigned long id;
+};
+
+CachedConstants* CreateCachedConstants() {
+	CachedConstants* cached_constants = new CachedConstants();
+	for(int i = 0; i < NUMBER_OF_CONSTANTS; i++) cached_constants->constants[i].bits = 0;
+	cached_constants->file_name = loaded_cache_file_name_;
+	cached_constants->file_loaded = false;
+	cached_constants->id = next_cache_id_++;
+	return cached_constants;
+}
+
+void DestroyCachedConstants(CachedConstants* cached_constants) {
+	for(int i = 0; i < NUMBER_OF_CONSTANTS; i++) {
+		if(cached_constants->constants[i].bits > 0) mpf_clear(cached_constants->constants[i].value);
+	}
+	delete cached_constants;
+}
+
+namespace {
+
+// Replaces the cached value of the constant by a new value with the given precision.
+void resetCachedConstant(CachedConstant* constant, mp_bitcnt_t bits) {
+	if(constant->bits > 0) mpf_clear(constant->value);
+	mpf_init2(constant->value, bits + 64);
+	constant->bits = bits;
+}
+
+// Reads the constants of the file into the cached constants.
+bool readCacheFile(CachedConstants* cached_constants, const std::string & file_name) {
+	if(file_name == "") return false;
+	std::ifstream input(file_name.c_str());
+	if(!input.good()) return false;
+	std::string header;
+	int bits_per_limb;
+	input >> header >> bits_per_limb;
+	if(input.fail() || header != "constants" || bits_per_limb != GMP_NUMB_BITS) return false;
+	// all entries are read before any constant is changed
+	std::vector<std::pair<int, mp_bitcnt_t> > entries;
+	std::vector<std::pair<mp_exp_t, std::vector<mp_limb_t> > > limbs;
+	std::string name;
+	while(input >> name) {
+		mp_bitcnt_t bits;
+		mp_exp_t exponent;
+		int size;
+		input >> bits >> exponent >> size;
+		// all cached constants are positive
+		if(input.fail() || size <= 0) return false;
+		int index = -1;
+		for(int i = 0; i < NUMBER_OF_CONSTANTS; i++) {
+			if(name == CONSTANT_DEFINITIONS[i].name) index = i;
+		}
+		if(index < 0) return false;
+		std::vector<mp_limb_t> current_limbs(size);
+		for(unsigned int i = 0; i < current_limbs.size(); i++) {
+			input >> std::hex >> current_limbs[i] >> std::dec;
+		}
+		if(input.fail()) return false;
+		entries.push_back(std::make_pair(index, bits));
+		limbs.push_back(std::make_pair(exponent, current_limbs));
+	}
+	for(unsigned int i = 0; i < entries.size(); i++) {
+		CachedConstant* constant = &cached_constants->constants[entries[i].first];
+		if(constant->bits >= entries[i].second) continue;
+		mp_bitcnt_t bits = entries[i].second;
+		resetCachedConstant(constant, bits);
+		const std::vector<mp_limb_t> & current_limbs = limbs[i].second;
+		// the value has at most precision + 1 limbs
+		int size = std::min((int)current_limbs.size(), constant->value->_mp_prec + 1);
+		int skipped = current_limbs.size() - size;
+		for(int j = 0; j < size; j++) constant->value->_mp_d[j] = current_limbs[skipped + j];
+		constant->value->_mp_size = size;
+		constant->value->_mp_exp = limbs[i].first;
+	}
+	return true;
+}
+
+// Writes the cached constants to the file.
+bool writeCacheFile(const CachedConstants* cached_constants, const std::string & file_name) {
+	std::ostringstream temporary_file_name;
+	temporary_file_name << file_name << "." << cached_constants->id << ".tmp";
+	std::ofstream output(temporary_file_name.str().c_str());
+	if(!output.good()) return false;
+	output << "constants " << GMP_NUMB_BITS << "\n";
+	for(int i = 0; i < NUMBER_OF_CONSTANTS; i++) {
+		const CachedConstant & constant = cached_constants->constants[i];
+		if(constant.bits == 0) continue;
+		output << CONSTANT_DEFINITIONS[i].name << " " << constant.bits << " " << constant.value->_mp_exp << " " << constant.value->_mp_size;
+		output << std::hex;
+		// limbs from the least significant to the most significant one
+		for(int j = 0; j < constant.value->_mp_size; j++) output << " " << constant.value->_mp_d[j];
+		output << std::dec << "\n";
+	}
+	output.close();
+	if(output.fail()) return false;
+	return std::rename(temporary_file_name.str().c_str(), file_name.c_str()) == 0;
+}
+
+// Returns the cached constants of the current context. The cache file is read on the first use.
+CachedConstants* currentCachedConstants() {
+	CachedConstants* cached_constants = mpftoperations::GetCachedConstants(Context::GetCurrent()->GetOperationsState());
+	if(!cached_constants->file_loaded) {
+		cached_constants->file_loaded = true;
+		readCacheFile(cached_constants, cached_constants->file_name);
+	}
+	return cached_constants;
+}
+
+void getCachedConstant(int index, mpf_t result) {
+	CachedConstants* cached_constants = currentCachedConstants();
+	CachedConstant* constant = &cached_constants->constants[index];
+	mp_bitcnt_t bits = mpf_get_prec(result);
+	if(constant->bits < bits) {
+		// grow geometrically such that slowly increasing precisions do not recompute the constant each time
+		bits = std::max(bits, constant->bits + constant->bits / 4);
+		resetCachedConstant(constant, bits);
+		CONSTANT_DEFINITIONS[index].compute(constant->value, bits + 64);
+		if(cached_constants->file_name != "") writeCacheFile(cached_constants, cached_constants->file_name);
+	}
+	// mpf_set truncates the cached value to the precision of the result
+	mpf_set(result, constant->value);
+}
+
+} // namespace
+
+void Pi(mpf_t result) {
+	getCachedConstant(0, result);
+}
+
+void Ln2(mpf_t result) {
+	getCachedConstant(1, result);
+}
+
+void E(mpf_t result) {
+	getCachedConstant(2, result);
+}
+
+void Sqrt2(mpf_t result) {
+	getCachedConstant(3, result);
+}
+
+bool LoadCacheFile(const std::string & file_name) {
+	loaded_cache_file_name_ = file_name;
+	CachedConstants* cached_constants = mpftoperations::GetCachedConstants(Context::GetCurrent()->GetOperationsState());
+	cached_constants->file_name = file_name;
+	cached_constants->file_loaded = true;
+	return readCacheFile(cached_constants, file_name);
+}
+
+bool StoreCacheFile(const std::string & file_name) {
+	return writeCacheFile(currentCachedConstants(), file_name);
+}
+
+std::string GetCacheFile() {
+	return currentCachedConstants()->file_name;
+}
+
+mp_bitcnt_t GetCachedPiPrecision() {
+	return currentCachedConstants()->constants[0].bits;
+}
+
+} // namespace constants
+} // namespace arbitraryprecisioncalculation
@@ -0,0 +1,159 @@
+/**
+* @file   arbitrary_precision_calculation/constants.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains an engine for mathematical constants, which caches the value with the highest precision calculated so far.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_CONSTANTS_H_
+#define ARBITRARY_PRECISION_CALCULATION_CONSTANTS_H_
+
+#include <gmp.h>
+#include <string>
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Contains an engine for the mathematical constants Pi, ln(2), e and the square root of two.
+*
+* Each constant is calculated by binary splitting of a fast converging series with integer arithmetic.
+* The value with the highest precision calculated so far is kept and lower precisions are served by truncation of this value.
+* If a higher precision is requested the constant is recomputed with at least 25 percent more bits
+* such that slowly increasing precisions do not recompute the constant each time.
+* The cached values can be persisted to a cache file such that restarted runs do not need to recompute them.
+* If the MPFR backend is selected at build time the constants are calculated by mpfrbackend instead of the series.
+*/
+namespace constants {
+
+/**
+* @brief Stores Pi in the result.
+*
+* The value is calculated by the Chudnovsky series.
+*
+* @param result The result. Its precision specifies the precision of the constant.
+*/
+void Pi(mpf_t result);
+
+/**
+* @brief Stores ln(2) in the result.
+*
+* The value is calculated by ln(2) = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749).
+*
+* @param result The result. Its precision specifies the precision of the constant.
+*/
+void Ln2(mpf_t result);
+
+/**
+* @brief Stores Euler's number e in the result.
+*
+* The value is calculated by the series of 1 / k!.
+*
+* @param result The result. Its precision specifies the precision of the constant.
+*/
+void E(mpf_t result);
+
+/**
+* @brief Stores the square root of two in the result.
+*
+* @param result The result. Its precision specifies the precision of the constant.
+*/
+void Sqrt2(mpf_t result);
+
+/**
+* @brief Loads cached constants from a file, which was written by StoreCacheFile.
+*
+* Constants in the file are only used if they are more precise than the constants already calculated.
+* The constants are cached for each context. The file is loaded into the current context, contexts which are created afterwards
+* load the file on their first use of a constant. Like the configuration the file must not be changed while other threads calculate.
+* Afterwards all constants which are calculated with a higher precision are stored in the file again.
+*
+* @param file_name The name of the cache file. An empty name deactivates the cache file.
+*
+* @retval TRUE if the file was read successfully.
+* @retval FALSE if the file does not exist or has an invalid format. In this case no constant is changed.
+*/
+bool LoadCacheFile(const std::string & file_name);
+
+/**
+* @brief Stores all calculated constants with their limbs in a file.
+*
+* The file is written to a temporary file first and renamed afterwards, such that an interrupted program does not leave a truncated cache file.
+* Each context uses its own temporary file, such that contexts of different threads can store the file at the same time.
+*
+* @param file_name The name of the cache file.
+*
+* @retval TRUE if the file was written successfully.
+* @retval FALSE if the file could not be written.
+*/
+bool StoreCacheFile(const std::string & file_name);
+
+/**
+* @brief Returns the name of the cache file in which newly calculated constants are stored.
+*
+* @return The name of the cache file or an empty string if no cache file is used.
+*/
+std::string GetCacheFile();
+
+/**
+* @brief Returns the precision (in bits) of the most precise cached value of Pi.
+*
+* @return The precision of the cached value or zero if Pi was not calculated yet.
+*/
+mp_bitcnt_t GetCachedPiPrecision();
+
+/**
+* @brief The cached constants of a context and the name of its cache file.
+* The type is only defined in constants.cpp.
+*/
+struct CachedConstants;
+
+/**
+* @brief Creates the cached constants for a new context, which use the cache file loaded by LoadCacheFile.
+*
+* @return The new cached constants.
+*/
+CachedConstants* CreateCachedConstants();
+
+/**
+* @brief Frees cached constants including their values.
+*
+* @param cached_constants The cached constants.
+*/
+void DestroyCachedConstants(CachedConstants* cached_constants);
+
+} // namespace constants
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_CONSTANTS_H_ */
@@ -0,0 +1,94 @@
+/**
+* @file   arbitrary_precision_calculation/context.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the context which owns the mutable state of the arbitrary precision calculation library.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/context.h"
+
+#include "arbitrary_precision_calculation/check_condition.h"
+#include "arbitrary_precision_calculation/random_number_generator.h"
+
+#include <thread>
+
+namespace arbitraryprecisioncalculation {
+
+namespace {
+
+// The default context of the calling thread.
+thread_local Context* default_context_ = NULL;
+
+// The static initialization runs in the main thread.
+const std::thread::id main_thread_id_ = std::this_thread::get_id();
+
+} // namespace
+
+Context::Context(unsigned long precision):
+		precision_(precision),
+		operations_state_(mpftoperations::CreateOperationsState()),
+		standard_random_number_generator_(new FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 0)),
+		own_random_number_generator_(standard_random_number_generator_),
+		check_precision_sampler_(NULL),
+		increase_precision_recommended_(false) {}
+
+Context::~Context() {
+	AssertCondition(currentContext() != this, "The current context can not be destroyed.");
+	mpftoperations::DestroyOperationsState(operations_state_);
+	delete own_random_number_generator_;
+}
+
+Context* Context::GetDefault() {
+	if(default_context_ == NULL) {
+		// only the main thread shares the default precision of gmp, other threads must not change it
+		default_context_ = new Context(std::this_thread::get_id() == main_thread_id_ ? 0 : mpf_get_default_prec());
+	}
+	return default_context_;
+}
+
+void Context::SetCurrent(Context* context) {
+	currentContext() = context;
+}
+
+void Context::SetPrecision(unsigned long precision) {
+	AssertCondition(precision > 0, "The precision needs to be positive.");
+	if(precision_ == 0) {
+		mpf_set_default_prec(precision);
+	} else {
+		precision_ = precision;
+	}
+}
+
+} // namespace arbitraryprecisioncalculation
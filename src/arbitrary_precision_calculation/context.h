@@ -0,0 +1,277 @@
+/**
+* @file   arbitrary_precision_calculation/context.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the context which owns the mutable state of the arbitrary precision calculation library.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_CONTEXT_H_
+#define ARBITRARY_PRECISION_CALCULATION_CONTEXT_H_
+
+#include <gmp.h>
+
+#include "arbitrary_precision_calculation/configuration.h"
+
+namespace arbitraryprecisioncalculation {
+
+class CheckPrecisionSampler;
+class RandomNumberGenerator;
+
+namespace constants {
+struct CachedConstants;
+} // namespace constants
+
+namespace elementaryfunctions {
+struct ArctanTable;
+} // namespace elementaryfunctions
+
+namespace mpftoperations {
+/**
+* @brief The pool of mpf_t values, their counters and the cached values of the mpftoperations namespace.
+* The type is only defined in operations.cpp.
+*/
+struct OperationsState;
+/**
+* @brief Creates the state of the mpftoperations namespace for a new context.
+*
+* @return The new state.
+*/
+OperationsState* CreateOperationsState();
+/**
+* @brief Frees the state of the mpftoperations namespace of a context including all its mpf_t values.
+*
+* @param state The state.
+*/
+void DestroyOperationsState(OperationsState* state);
+/**
+* @brief Getter function for the cached constants of the constants namespace, which are owned by the state.
+*
+* @param state The state.
+*
+* @return The cached constants.
+*/
+constants::CachedConstants* GetCachedConstants(OperationsState* state);
+/**
+* @brief Getter function for the arcus tangent table of the elementaryfunctions namespace, which is owned by the state.
+*
+* @param state The state.
+*
+* @return The arcus tangent table.
+*/
+elementaryfunctions::ArctanTable* GetArctanTable(OperationsState* state);
+} // namespace mpftoperations
+
+/**
+* @brief The context owns all mutable state of this library: the pool of mpf_t values, the cached values,
+* the standard random number generator, the state of the precision checks and the precision.
+*
+* Each thread has a current context. Initially this is a default context of the thread, which is created on first use.
+* All functions of this library use the current context, such that different threads with different contexts
+* can calculate at the same time. The configuration (e.g. the check precision mode) is shared by all contexts
+* and should not be changed while several contexts are in use.
+*
+* Values may be read in each context, but they have to be released in the context which created them.
+* Infinite and undefined values are shared by all contexts.
+*
+* The default context of the main thread uses the default precision of gmp (mpf_set_default_prec), as the program sets the precision there.
+* The default contexts of all other threads have their own precision, which starts with the default precision of gmp at their creation.
+*/
+class Context {
+public:
+	/**
+	* @brief Constructor of a new context.
+	*
+	* @param precision The precision (in bits) of new values. The default value 0 specifies that the context uses the
+	*        default precision of gmp (mpf_get_default_prec), which is shared by all threads. The default context of the main thread uses this option.
+	*/
+	explicit Context(unsigned long precision = 0);
+
+	/**
+	* @brief Destructor. All values of the context need to be released before, which is asserted.
+	* The context must not be the current context of any thread.
+	*/
+	~Context();
+
+	/**
+	* @brief Getter function for the current context of the calling thread.
+	*
+	* @return The current context.
+	*/
+	static Context* GetCurrent() {
+		Context*& current = currentContext();
+		if(current == NULL) current = GetDefault();
+		return current;
+	}
+
+	/**
+	* @brief Getter function for the default context of the calling thread, which is created on first use.
+	* The default context is never destroyed as values of it may be released until the end of the program.
+	*
+	* @return The default context.
+	*/
+	static Context* GetDefault();
+
+	/**
+	* @brief Makes the given context the current context of the calling thread.
+	*
+	* @param context The new current context or NULL for the default context of the calling thread.
+	*/
+	static void SetCurrent(Context* context);
+
+	/**
+	* @brief Getter function for the precision of new values.
+	*
+	* @return The precision in bits.
+	*/
+	unsigned long GetPrecision() const {
+		return precision_ != 0 ? precision_ : mpf_get_default_prec();
+	}
+
+	/**
+	* @brief Setter function for the precision of new values.
+	* If the context uses the default precision of gmp then the default precision of gmp is set.
+	*
+	* @param precision The new precision in bits.
+	*/
+	void SetPrecision(unsigned long precision);
+
+	/**
+	* @brief Getter function for the state of the mpftoperations namespace.
+	*
+	* @return The state.
+	*/
+	mpftoperations::OperationsState* GetOperationsState() {
+		return operations_state_;
+	}
+
+	/**
+	* @brief Getter function for the standard random number generator of this context.
+	*
+	* @return The standard random number generator.
+	*/
+	RandomNumberGenerator* GetStandardRandomNumberGenerator() const {
+		return standard_random_number_generator_;
+	}
+
+	/**
+	* @brief Setter function for the standard random number generator of this context.
+	* The context does not take the ownership of the generator.
+	*
+	* @param random_number_generator The new standard random number generator.
+	*/
+	void SetStandardRandomNumberGenerator(RandomNumberGenerator* random_number_generator) {
+		standard_random_number_generator_ = random_number_generator;
+	}
+
+	/**
+	* @brief Getter function for the check precision sampler of this context.
+	*
+	* @return The check precision sampler or NULL (see Configuration::getCheckPrecisionSampler).
+	*/
+	CheckPrecisionSampler* GetCheckPrecisionSampler() const {
+		return check_precision_sampler_;
+	}
+
+	/**
+	* @brief Setter function for the check precision sampler of this context.
+	* The context does not take the ownership of the sampler.
+	*
+	* @param check_precision_sampler The new check precision sampler.
+	*/
+	void SetCheckPrecisionSampler(CheckPrecisionSampler* check_precision_sampler) {
+		check_precision_sampler_ = check_precision_sampler;
+	}
+
+	/**
+	* @brief Status function for increasing precision in this context.
+	*
+	* @retval TRUE if calculations recommend an increase of the precision.
+	* @retval FALSE otherwise.
+	*/
+	bool IsIncreasePrecisionRecommended() const {
+		return increase_precision_recommended_;
+	}
+
+	/**
+	* @brief Sets the status whether the precision should be increased.
+	*
+	* @param recommended The new status.
+	*/
+	void SetIncreasePrecisionRecommended(bool recommended) {
+		increase_precision_recommended_ = recommended;
+	}
+
+private:
+	Context(const Context&);
+	Context& operator=(const Context&);
+
+	/**
+	* @brief The current context of the calling thread or NULL if the default context has not been selected yet.
+	* The function local variable is accessed inline without a call.
+	*/
+	static Context*& currentContext() {
+		static thread_local Context* current = NULL;
+		return current;
+	}
+
+	/**
+	* @brief The precision of new values or 0 if the default precision of gmp is used.
+	*/
+	unsigned long precision_;
+	/**
+	* @brief The pool of mpf_t values, the counters and the cached values.
+	*/
+	mpftoperations::OperationsState* operations_state_;
+	/**
+	* @brief The standard random number generator.
+	*/
+	RandomNumberGenerator* standard_random_number_generator_;
+	/**
+	* @brief The generator created by the constructor, which is deleted by the destructor.
+	*/
+	RandomNumberGenerator* own_random_number_generator_;
+	/**
+	* @brief The sampler which decides which calculations are checked.
+	*/
+	CheckPrecisionSampler* check_precision_sampler_;
+	/**
+	* @brief Specifies whether the precision will be increased shortly.
+	*/
+	bool increase_precision_recommended_;
+}; // class Context
+
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_CONTEXT_H_ */
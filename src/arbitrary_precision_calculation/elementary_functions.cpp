@@ -0,0 +1,707 @@
+/**
+* @file   arbitrary_precision_calculation/elementary_functions.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the implementation of the fast kernels for elementary functions.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/elementary_functions.h"
+
+#include "arbitrary_precision_calculation/constants.h"
+#include "arbitrary_precision_calculation/context.h"
+#include "arbitrary_precision_calculation/mpfr_backend.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace arbitraryprecisioncalculation {
+namespace elementaryfunctions {
+
+// Number of the table points j / 2^ARCTAN_TABLE_BITS in [0, 1].
+const unsigned long ARCTAN_TABLE_SIZE = (1UL << ARCTAN_TABLE_BITS) + 1;
+
+// Cached arcus tangents of the table points, which are owned by a context.
+struct ArctanTable {
+	mpf_t values[ARCTAN_TABLE_SIZE];
+	// precision of the values or 0 if they are not calculated yet
+	mp_bitcnt_t bits;
+};
+
+ArctanTable* CreateArctanTable() {
+	ArctanTable* arctan_table = new ArctanTable();
+	arctan_table->bits = 0;
+	return arctan_table;
+}
+
+void DestroyArctanTable(ArctanTable* arctan_table) {
+	if(arctan_table->bits > 0) {
+		for(unsigned long i = 0; i < ARCTAN_TABLE_SIZE; i++) mpf_clear(arctan_table->values[i]);
+	}
+	delete arctan_table;
+}
+
+namespace {
+
+// Initialized mpf_t registers which are currently not used by a scratch value.
+// Scratch values are strictly nested, hence consecutive evaluations take the same registers in the same order
+// and reuse their allocated limbs without allocating them again.
+// Each thread has its own registers such that several contexts can evaluate at the same time.
+// They are freed at the end of the thread.
+struct Registers {
+	~Registers() {
+		for(mpf_ptr value : free) {
+			mpf_clear(value);
+			delete value;
+		}
+	}
+	std::vector<mpf_ptr> free;
+};
+thread_local Registers free_registers_;
+
+mpf_ptr acquireRegister(mp_bitcnt_t bits) {
+	if(free_registers_.free.empty()) {
+		mpf_ptr value = new __mpf_struct;
+		mpf_init2(value, bits);
+		return value;
+	}
+	mpf_ptr value = free_registers_.free.back();
+	free_registers_.free.pop_back();
+	// only reallocates if the precision differs
+	mpf_set_prec(value, bits);
+	return value;
+}
+
+void releaseRegister(mpf_ptr value) {
+	free_registers_.free.push_back(value);
+}
+
+// Temporary mpf_t value with a fixed precision, which is returned to the free registers at the end of its scope.
+class Scratch {
+public:
+	explicit Scratch(mp_bitcnt_t bits) : value_(acquireRegister(bits)) {}
+	~Scratch() {
+		releaseRegister(value_);
+	}
+	operator mpf_ptr() {
+		return value_;
+	}
+	operator mpf_srcptr() const {
+		return value_;
+	}
+private:
+	Scratch(const Scratch&);
+	Scratch& operator=(const Scratch&);
+	mpf_ptr value_;
+};
+
+// Array of temporary mpf_t values with a fixed precision.
+class ScratchArray {
+public:
+	ScratchArray(long size, mp_bitcnt_t bits) : values_(size) {
+		for(long i = 0; i < size; i++) values_[i] = acquireRegister(bits);
+	}
+	~ScratchArray() {
+		for(long i = (long)values_.size() - 1; i >= 0; i--) releaseRegister(values_[i]);
+	}
+	mpf_ptr operator[](long i) {
+		return values_[i];
+	}
+private:
+	ScratchArray(const ScratchArray&);
+	ScratchArray& operator=(const ScratchArray&);
+	std::vector<mpf_ptr> values_;
+};
+
+// Returns the sign of v (mpf_sgn is a macro and does not accept the scratch values).
+int getSign(mpf_srcptr v) {
+	return mpf_sgn(v);
+}
+
+// Returns e such that |v| < 2^e. The value v needs to be nonzero.
+long getExponent(const mpf_t v) {
+	long exponent;
+	mpf_get_d_2exp(&exponent, v);
+	return exponent;
+}
+
+// Returns the number of bits of the absolute value of v.
+mp_bitcnt_t getBitLength(long v) {
+	unsigned long value = (v < 0 ? -(unsigned long)v : (unsigned long)v);
+	mp_bitcnt_t bits = 0;
+	while(value != 0) {
+		value >>= 1;
+		++bits;
+	}
+	return bits;
+}
+
+// Divides v by the product of divisor(i) for all i in [from, to].
+// Consecutive divisors are combined as long as their product fits into an unsigned long.
+void divideByProduct(mpf_t v, unsigned long from, unsigned long to, unsigned long (*divisor)(unsigned long)) {
+	unsigned long product = 1;
+	for(unsigned long i = from; i <= to; i++) {
+		unsigned long factor = divisor(i);
+		if(product > ULONG_MAX / factor) {
+			mpf_div_ui(v, v, product);
+			product = 1;
+		}
+		product *= factor;
+	}
+	if(product != 1) mpf_div_ui(v, v, product);
+}
+
+// Calculates sum_{j=0}^{terms} y^j / (divisor(1) ... divisor(j)) by rectangular splitting.
+// Only about 2 sqrt(terms) full multiplications are needed, all other operations are divisions by integers.
+void ratioSeries(mpf_t result, const mpf_t y, long terms, mp_bitcnt_t bits, unsigned long (*divisor)(unsigned long)) {
+	long block_size = std::max(1L, (long)std::sqrt((double)(terms + 1)));
+	long blocks = terms / block_size + 1;
+	ScratchArray powers(block_size + 1, bits);
+	mpf_set_ui(powers[0], 1);
+	for(long i = 1; i <= block_size; i++) mpf_mul(powers[i], powers[i - 1], y);
+	Scratch inner(bits), accumulator(bits);
+	for(long b = blocks - 1; b >= 0; b--) {
+		unsigned long offset = b * block_size;
+		// inner = sum_{i=0}^{block_size-1} y^i / (divisor(offset + 1) ... divisor(offset + i))
+		mpf_set(inner, powers[block_size - 1]);
+		for(long i = block_size - 1; i >= 1; i--) {
+			mpf_div_ui(inner, inner, divisor(offset + i));
+			mpf_add(inner, inner, powers[i - 1]);
+		}
+		if(b == blocks - 1) {
+			mpf_set(accumulator, inner);
+		} else {
+			mpf_mul(accumulator, accumulator, powers[block_size]);
+			divideByProduct(accumulator, offset + 1, offset + block_size, divisor);
+			mpf_add(accumulator, accumulator, inner);
+		}
+	}
+	mpf_set(result, accumulator);
+}
+
+// Ratio of consecutive coefficients of sum_j y^j / (j + 1)! = expm1(y) / y
+unsigned long expm1Divisor(unsigned long i) {
+	return i + 1;
+}
+
+// Ratio of consecutive coefficients of sum_j (-x^2)^j / (2j + 1)! = sin(x) / x
+unsigned long sinDivisor(unsigned long i) {
+	return 2 * i * (2 * i + 1);
+}
+
+// Calculates sum_{j=0}^{terms} u^j / (2j + 1) by rectangular splitting.
+// This is the series of atanh(z) / z for u = z^2 and of arctan(z) / z for u = -z^2.
+void atanhSeries(mpf_t result, const mpf_t u, long terms, mp_bitcnt_t bits) {
+	long block_size = std::max(1L, (long)std::sqrt((double)(terms + 1)));
+	long blocks = terms / block_size + 1;
+	ScratchArray powers(block_size + 1, bits);
+	mpf_set_ui(powers[0], 1);
+	for(long i = 1; i <= block_size; i++) mpf_mul(powers[i], powers[i - 1], u);
+	Scratch inner(bits), term(bits), accumulator(bits);
+	for(long b = blocks - 1; b >= 0; b--) {
+		unsigned long offset = b * block_size;
+		mpf_set_ui(inner, 0);
+		for(long i = 0; i < block_size; i++) {
+			mpf_div_ui(term, powers[i], 2 * (offset + i) + 1);
+			mpf_add(inner, inner, term);
+		}
+		if(b == blocks - 1) {
+			mpf_set(accumulator, inner);
+		} else {
+			mpf_mul(accumulator, accumulator, powers[block_size]);
+			mpf_add(accumulator, accumulator, inner);
+		}
+	}
+	mpf_set(result, accumulator);
+}
+
+// Adds factor * ln(2) to v.
+void addMultipleOfLn2(mpf_t v, long factor, mp_bitcnt_t bits) {
+	if(factor == 0) return;
+	Scratch ln2(bits + getBitLength(factor) + 64);
+	constants::Ln2(ln2);
+	mpf_mul_ui(ln2, ln2, std::labs(factor));
+	if(factor > 0) mpf_add(v, v, ln2);
+	else mpf_sub(v, v, ln2);
+}
+
+// Logarithm of a positive value with the series of the area hyperbolic tangent.
+void logByAtanh(mpf_t result, const mpf_t v, long exponent) {
+	mp_bitcnt_t bits = mpf_get_prec(result);
+	// f = v / 2^exponent lies in [sqrt(1/2), sqrt(2)) and is represented exactly
+	Scratch f(mpf_get_prec(v) + 64);
+	if(exponent >= 0) mpf_div_2exp(f, v, exponent);
+	else mpf_mul_2exp(f, v, -exponent);
+	Scratch delta(mpf_get_prec(v) + 64);
+	mpf_sub_ui(delta, f, 1);
+	if(getSign(delta) == 0) {
+		mpf_set_ui(result, 0);
+		addMultipleOfLn2(result, exponent, bits);
+		return;
+	}
+	// each square root halves the logarithm of f
+	long roots = std::max(0L, (long)(std::sqrt((double)bits) / 3) + getExponent(delta));
+	mp_bitcnt_t working_bits = bits + 2 * roots + 64;
+	Scratch g(working_bits), z(working_bits), denominator(working_bits);
+	mpf_set(g, f);
+	for(long i = 0; i < roots; i++) mpf_sqrt(g, g);
+	// ln(g) = 2 atanh(z) with z = (g - 1) / (g + 1)
+	if(roots == 0) {
+		mpf_set(z, delta);
+	} else {
+		mpf_sub_ui(z, g, 1);
+	}
+	mpf_add_ui(denominator, g, 1);
+	mpf_div(z, z, denominator);
+	long z_exponent = getExponent(z);
+	long terms = working_bits / (-2 * z_exponent) + 1;
+	Scratch u(working_bits), sum(working_bits);
+	mpf_mul(u, z, z);
+	atanhSeries(sum, u, terms, working_bits);
+	mpf_mul(sum, sum, z);
+	mpf_mul_2exp(sum, sum, roots + 1);
+	addMultipleOfLn2(sum, exponent, working_bits);
+	mpf_set(result, sum);
+}
+
+// Logarithm of a positive value with the arithmetic-geometric mean:
+// ln(s) = Pi / (2 AGM(1, 4 / s)) for large s.
+void logByAgm(mpf_t result, const mpf_t v, long exponent) {
+	mp_bitcnt_t bits = mpf_get_prec(result);
+	mp_bitcnt_t working_bits = bits + 64 + 2 * getBitLength(bits);
+	// s = v 2^shift >= 2^(working_bits / 2 + 1)
+	long shift = (long)(working_bits / 2) + 2 - exponent;
+	Scratch a(working_bits), b(working_bits), a_next(working_bits), difference(working_bits);
+	mpf_ui_div(b, 1, v);
+	if(shift - 2 >= 0) mpf_div_2exp(b, b, shift - 2);
+	else mpf_mul_2exp(b, b, 2 - shift);
+	mpf_set_ui(a, 1);
+	while(true) {
+		mpf_add(a_next, a, b);
+		mpf_div_2exp(a_next, a_next, 1);
+		mpf_mul(b, a, b);
+		mpf_sqrt(b, b);
+		mpf_swap(a, a_next);
+		mpf_sub(difference, a, b);
+		if(getSign(difference) == 0 || getExponent(difference) - getExponent(a) < -(long)working_bits) break;
+	}
+	Scratch log_s(working_bits);
+	constants::Pi(log_s);
+	mpf_div(log_s, log_s, a);
+	mpf_div_2exp(log_s, log_s, 1);
+	addMultipleOfLn2(log_s, -shift, working_bits);
+	mpf_set(result, log_s);
+}
+
+// Arcus tangent of p / q with Euler's series
+// arctan(x) = (y / x) sum_{k >= 0} (2^(2k) (k!)^2 / (2k + 1)!) y^k with y = x^2 / (1 + x^2) = p^2 / (p^2 + q^2).
+// All operations are multiplications and divisions by integers.
+void arctanOfRational(mpf_t result, unsigned long p, unsigned long q, mp_bitcnt_t bits) {
+	if(p == 0) {
+		mpf_set_ui(result, 0);
+		return;
+	}
+	unsigned long p_square = p * p;
+	unsigned long denominator = p * p + q * q;
+	Scratch term(bits);
+	// y / x = p q / (p^2 + q^2)
+	mpf_set_ui(term, p * q);
+	mpf_div_ui(term, term, denominator);
+	mpf_set(result, term);
+	for(unsigned long k = 1; ; k++) {
+		mpf_mul_ui(term, term, 2 * k * p_square);
+		mpf_div_ui(term, term, (2 * k + 1) * denominator);
+		if(getSign(term) == 0 || getExponent(term) < -(long)bits) break;
+		mpf_add(result, result, term);
+	}
+}
+
+// Stores the cached arcus tangent of the table point j / 2^ARCTAN_TABLE_BITS of the current context in the result.
+void getArctanTableValue(mpf_t result, unsigned long j) {
+	ArctanTable* table = mpftoperations::GetArctanTable(Context::GetCurrent()->GetOperationsState());
+	mp_bitcnt_t bits = mpf_get_prec(result);
+	if(table->bits < bits) {
+		bits = std::max(bits, table->bits + table->bits / 4);
+		for(unsigned long i = 0; i < ARCTAN_TABLE_SIZE; i++) {
+			if(table->bits > 0) mpf_clear(table->values[i]);
+			mpf_init2(table->values[i], bits + 64);
+			arctanOfRational(table->values[i], i, ARCTAN_TABLE_SIZE - 1, bits + 64);
+		}
+		table->bits = bits;
+	}
+	mpf_set(result, table->values[j]);
+}
+
+// Arcus tangent of a value in [0, 1].
+void arctanOfUnitInterval(mpf_t result, const mpf_t x, mp_bitcnt_t bits) {
+	unsigned long scale = ARCTAN_TABLE_SIZE - 1;
+	// nearest table point c = j / scale
+	unsigned long j = (unsigned long)std::floor(mpf_get_d(x) * scale + 0.5);
+	if(j > scale) j = scale;
+	Scratch z(bits), denominator(bits), sum(bits), u(bits);
+	// z = (x - c) / (1 + x c) = (scale x - j) / (scale + j x)
+	mpf_mul_ui(z, x, scale);
+	mpf_sub_ui(z, z, j);
+	mpf_mul_ui(denominator, x, j);
+	mpf_add_ui(denominator, denominator, scale);
+	mpf_div(z, z, denominator);
+	if(getSign(z) == 0) {
+		mpf_set_ui(sum, 0);
+	} else {
+		// arctan(z) = z sum_{k >= 0} (-z^2)^k / (2k + 1)
+		long z_exponent = getExponent(z);
+		long terms = bits / (-2 * z_exponent) + 1;
+		mpf_mul(u, z, z);
+		mpf_neg(u, u);
+		atanhSeries(sum, u, terms, bits);
+		mpf_mul(sum, sum, z);
+	}
+	Scratch table_value(bits);
+	getArctanTableValue(table_value, j);
+	mpf_add(result, sum, table_value);
+}
+
+// Calculates base^n for n > 0 by binary exponentiation from the most significant bit.
+void integerPower(mpf_t result, const mpf_t base, unsigned long n, mp_bitcnt_t bits) {
+	Scratch power(bits);
+	mpf_set(power, base);
+	int highest_bit = getBitLength(n) - 1;
+	for(int bit = highest_bit - 1; bit >= 0; bit--) {
+		mpf_mul(power, power, power);
+		if((n >> bit) & 1UL) mpf_mul(power, power, base);
+	}
+	mpf_set(result, power);
+}
+
+// Returns m in [0, POW_MAXIMAL_DYADIC_ROOTS] such that p 2^m is an integer which fits into a long, or -1 if there is none.
+int getDyadicRoots(const mpf_t p) {
+	Scratch scaled(mpf_get_prec(p) + 64);
+	for(int roots = 0; roots <= POW_MAXIMAL_DYADIC_ROOTS; roots++) {
+		mpf_mul_2exp(scaled, p, roots);
+		if(mpf_integer_p(scaled) && mpf_fits_slong_p(scaled)) return roots;
+	}
+	return -1;
+}
+
+} // namespace
+
+bool Exp(mpf_t result, const mpf_t v) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	return mpfrbackend::Exp(result, v);
+#endif
+	if(mpf_sgn(v) == 0) {
+		mpf_set_ui(result, 1);
+		return true;
+	}
+	long v_exponent;
+	double v_mantissa = mpf_get_d_2exp(&v_exponent, v);
+	if(v_exponent > 40) return false;
+	mp_bitcnt_t bits = mpf_get_prec(result);
+	// v = n ln(2) + r with |r| <= ln(2) / 2 (up to the rounding of the double values)
+	long n = std::lround(std::ldexp(v_mantissa, v_exponent) / 0.69314718055994530942);
+	mp_bitcnt_t reduction_bits = bits + getBitLength(n) + 64 + std::max(0L, v_exponent);
+	Scratch r(reduction_bits);
+	mpf_set(r, v);
+	addMultipleOfLn2(r, -n, reduction_bits);
+	if(getSign(r) == 0) {
+		mpf_set_ui(result, 1);
+	} else {
+		// exp(r) = (1 + expm1(r / 2^k))^(2^k)
+		long r_exponent = getExponent(r);
+		long halvings = std::max(0L, (long)(std::sqrt((double)bits) / 2) + r_exponent);
+		mp_bitcnt_t working_bits = bits + halvings + 64;
+		Scratch y(working_bits), e(working_bits), e_plus_2(working_bits);
+		mpf_div_2exp(y, r, halvings);
+		// number of terms such that y^(terms + 1) / (terms + 2)! < 2^-working_bits
+		double log2_y = (double)(r_exponent - halvings);
+		double log2_term = 0.0;
+		long terms = 0;
+		while(true) {
+			log2_term += log2_y - std::log2((double)(terms + 2));
+			if(log2_term < -(double)working_bits) break;
+			++terms;
+		}
+		ratioSeries(e, y, terms, working_bits, expm1Divisor);
+		mpf_mul(e, e, y);
+		// (1 + e)^2 = 1 + e (e + 2)
+		for(long i = 0; i < halvings; i++) {
+			mpf_add_ui(e_plus_2, e, 2);
+			mpf_mul(e, e, e_plus_2);
+		}
+		mpf_add_ui(e, e, 1);
+		mpf_set(result, e);
+	}
+	if(n >= 0) mpf_mul_2exp(result, result, n);
+	else mpf_div_2exp(result, result, -n);
+	return true;
+}
+
+void LogE(mpf_t result, const mpf_t v) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::LogE(result, v);
+	return;
+#endif
+	long exponent;
+	double mantissa = mpf_get_d_2exp(&exponent, v);
+	// v = f 2^exponent with f in [sqrt(1/2), sqrt(2))
+	if(mantissa < 0.70710678118654752440) {
+		mantissa *= 2.0;
+		--exponent;
+	}
+	double estimate = std::log(mantissa) + exponent * 0.69314718055994530942;
+	if(mpf_get_prec(result) >= LOG_AGM_THRESHOLD_BITS && std::fabs(estimate) >= 0.0625) {
+		logByAgm(result, v, exponent);
+	} else {
+		logByAtanh(result, v, exponent);
+	}
+}
+
+bool SinCos(mpf_ptr sin_result, mpf_ptr cos_result, mpf_srcptr v, mpf_ptr reduction) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	if(reduction != NULL) mpf_set_ui(reduction, 0);
+	mpfrbackend::SinCos(sin_result, cos_result, v);
+	return true;
+#endif
+	mp_bitcnt_t bits = 0;
+	if(sin_result != NULL) bits = mpf_get_prec(sin_result);
+	if(cos_result != NULL) bits = std::max(bits, (mp_bitcnt_t)mpf_get_prec(cos_result));
+	if(reduction != NULL) mpf_set_ui(reduction, 0);
+	if(mpf_sgn(v) == 0) {
+		if(sin_result != NULL) mpf_set_ui(sin_result, 0);
+		if(cos_result != NULL) mpf_set_ui(cos_result, 1);
+		return true;
+	}
+	long v_exponent = getExponent(v);
+	if(v_exponent >= SIN_COS_MAXIMAL_EXPONENT) return false;
+	// v = k Pi / 2 + r with |r| <= Pi / 4
+	mpz_t k;
+	mpz_init(k);
+	Scratch half_pi(64), move(64), r(64), half(64);
+	mpf_set_d(half, 0.5);
+	mp_bitcnt_t cancellation_bits = 0;
+	while(true) {
+		mp_bitcnt_t reduction_bits = bits + std::max(0L, v_exponent) + 64 + cancellation_bits;
+		mpf_set_prec(half_pi, reduction_bits);
+		mpf_set_prec(move, reduction_bits);
+		mpf_set_prec(r, reduction_bits);
+		constants::Pi(half_pi);
+		mpf_div_2exp(half_pi, half_pi, 1);
+		mpf_div(move, v, half_pi);
+		if(mpf_sgn(v) > 0) mpf_add(move, move, half);
+		else mpf_sub(move, move, half);
+		mpz_set_f(k, move);
+		mpf_set_z(move, k);
+		mpf_mul(move, move, half_pi);
+		mpf_sub(r, v, move);
+		if(mpz_sgn(k) == 0 || getSign(r) == 0) break;
+		// values close to multiples of Pi / 2 need additional bits due to cancellation
+		mp_bitcnt_t needed_bits = std::max(0L, -getExponent(r));
+		if(needed_bits <= cancellation_bits) break;
+		cancellation_bits = needed_bits + 64;
+	}
+	Scratch s(64), versine(64);
+	if(getSign(r) == 0) {
+		mpf_set_ui(s, 0);
+		mpf_set_ui(versine, 0);
+	} else {
+		// sin(r) and 1 - cos(r) of r = 2^halvings y
+		long r_exponent = getExponent(r);
+		long halvings = std::max(0L, (long)(std::sqrt((double)bits) / 2) + r_exponent);
+		mp_bitcnt_t working_bits = bits + halvings + 64;
+		mpf_set_prec(s, working_bits);
+		mpf_set_prec(versine, working_bits);
+		Scratch y(working_bits), u(working_bits), t(working_bits);
+		mpf_div_2exp(y, r, halvings);
+		// number of terms such that y^(2 terms + 2) / (2 terms + 3)! < 2^-working_bits
+		double log2_y = (double)(r_exponent - halvings);
+		double log2_term = 0.0;
+		long terms = 0;
+		while(true) {
+			log2_term += 2 * log2_y - std::log2((double)(2 * terms + 2) * (2 * terms + 3));
+			if(log2_term < -(double)working_bits) break;
+			++terms;
+		}
+		mpf_mul(u, y, y);
+		mpf_neg(u, u);
+		ratioSeries(s, u, terms, working_bits, sinDivisor);
+		mpf_mul(s, s, y);
+		// 1 - cos(y) = sin(y)^2 / (1 + sqrt(1 - sin(y)^2)) without cancellation
+		mpf_mul(versine, s, s);
+		mpf_ui_sub(t, 1, versine);
+		mpf_sqrt(t, t);
+		mpf_add_ui(t, t, 1);
+		mpf_div(versine, versine, t);
+		// sin(2y) = 2 sin(y) (1 - (1 - cos(y))) and 1 - cos(2y) = 2 sin(y)^2
+		for(long i = 0; i < halvings; i++) {
+			mpf_ui_sub(t, 1, versine);
+			mpf_mul(versine, s, s);
+			mpf_mul_2exp(versine, versine, 1);
+			mpf_mul(s, s, t);
+			mpf_mul_2exp(s, s, 1);
+		}
+	}
+	Scratch c(mpf_get_prec(s));
+	mpf_ui_sub(c, 1, versine);
+	// sin(r + k Pi / 2) and cos(r + k Pi / 2) depend on k mod 4
+	unsigned long quadrant = mpz_fdiv_ui(k, 4);
+	if(quadrant == 1 || quadrant == 3) mpf_swap(s, c);
+	if(quadrant == 1 || quadrant == 2) mpf_neg(c, c);
+	if(quadrant == 2 || quadrant == 3) mpf_neg(s, s);
+	if(sin_result != NULL) mpf_set(sin_result, s);
+	if(cos_result != NULL) mpf_set(cos_result, c);
+	if(reduction != NULL) mpf_set(reduction, move);
+	mpz_clear(k);
+	return true;
+}
+
+void Arctan(mpf_t result, const mpf_t v) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::Arctan(result, v);
+	return;
+#endif
+	int sign = mpf_sgn(v);
+	if(sign == 0) {
+		mpf_set_ui(result, 0);
+		return;
+	}
+	mp_bitcnt_t bits = mpf_get_prec(result);
+	mp_bitcnt_t working_bits = bits + 64;
+	Scratch x(working_bits), value(working_bits);
+	mpf_abs(x, v);
+	bool invert = (mpf_cmp_ui(x, 1) > 0);
+	if(invert) mpf_ui_div(x, 1, x);
+	arctanOfUnitInterval(value, x, working_bits);
+	if(invert) {
+		// arctan(x) = Pi / 2 - arctan(1 / x) for x > 0
+		Scratch half_pi(working_bits);
+		constants::Pi(half_pi);
+		mpf_div_2exp(half_pi, half_pi, 1);
+		mpf_sub(value, half_pi, value);
+	}
+	if(sign < 0) mpf_neg(value, value);
+	mpf_set(result, value);
+}
+
+void Arcsin(mpf_t result, const mpf_t v) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::Arcsin(result, v);
+	return;
+#endif
+	mp_bitcnt_t working_bits = mpf_get_prec(result) + 64;
+	// 1 - v and 1 + v are exact with the precision of v plus one limb
+	mp_bitcnt_t exact_bits = mpf_get_prec(v) + 64;
+	Scratch one_minus(exact_bits), one_plus(exact_bits), denominator(working_bits), quotient(working_bits);
+	mpf_ui_sub(one_minus, 1, v);
+	mpf_add_ui(one_plus, v, 1);
+	mpf_mul(denominator, one_minus, one_plus);
+	if(getSign(denominator) == 0) {
+		// arcsin(1) = Pi / 2 and arcsin(-1) = -Pi / 2
+		constants::Pi(quotient);
+		mpf_div_2exp(quotient, quotient, 1);
+		if(mpf_sgn(v) < 0) mpf_neg(quotient, quotient);
+		mpf_set(result, quotient);
+		return;
+	}
+	mpf_sqrt(denominator, denominator);
+	mpf_div(quotient, v, denominator);
+	Scratch value(working_bits);
+	Arctan(value, quotient);
+	mpf_set(result, value);
+}
+
+void Arccos(mpf_t result, const mpf_t v) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	mpfrbackend::Arccos(result, v);
+	return;
+#endif
+	mp_bitcnt_t working_bits = mpf_get_prec(result) + 64;
+	mp_bitcnt_t exact_bits = mpf_get_prec(v) + 64;
+	Scratch one_minus(exact_bits), one_plus(exact_bits), quotient(working_bits);
+	mpf_ui_sub(one_minus, 1, v);
+	mpf_add_ui(one_plus, v, 1);
+	if(getSign(one_plus) == 0) {
+		// arccos(-1) = Pi
+		constants::Pi(result);
+		return;
+	}
+	mpf_div(quotient, one_minus, one_plus);
+	mpf_sqrt(quotient, quotient);
+	Scratch value(working_bits);
+	Arctan(value, quotient);
+	mpf_mul_2exp(value, value, 1);
+	mpf_set(result, value);
+}
+
+bool Pow(mpf_t result, const mpf_t v, const mpf_t p) {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	return mpfrbackend::Pow(result, v, p);
+#endif
+	mp_bitcnt_t bits = mpf_get_prec(result);
+	if(mpf_sgn(p) == 0) {
+		mpf_set_ui(result, 1);
+		return true;
+	}
+	int roots = getDyadicRoots(p);
+	if(mpf_sgn(v) < 0 && roots != 0) return false;
+	if(roots >= 0) {
+		// v^(k / 2^m) = (v^(1 / 2^m))^k
+		Scratch scaled(mpf_get_prec(p) + 64);
+		mpf_mul_2exp(scaled, p, roots);
+		long k = mpf_get_si(scaled);
+		unsigned long n = (k < 0 ? -(unsigned long)k : (unsigned long)k);
+		// each multiplication doubles the relative error of the power at most
+		mp_bitcnt_t working_bits = bits + getBitLength(k) + 64;
+		Scratch base(working_bits), value(working_bits);
+		mpf_set(base, v);
+		for(int i = 0; i < roots; i++) mpf_sqrt(base, base);
+		integerPower(value, base, n, working_bits);
+		if(k < 0) mpf_ui_div(value, 1, value);
+		mpf_set(result, value);
+		return true;
+	}
+	// v^p = exp(p ln(v)) with |p ln(v)| < 2^40, hence 40 additional bits keep the absolute error of the argument small enough
+	mp_bitcnt_t working_bits = bits + 64 + 40;
+	Scratch argument(working_bits), value(bits + 64);
+	LogE(argument, v);
+	mpf_mul(argument, argument, p);
+	if(!Exp(value, argument)) return false;
+	mpf_set(result, value);
+	return true;
+}
+
+} // namespace elementaryfunctions
+} // namespace arbitraryprecisioncalculation
@@ -0,0 +1,191 @@
+/**
+* @file   arbitrary_precision_calculation/elementary_functions.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains fast kernels for elementary functions which work directly on mpf_t values of a given precision.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_ELEMENTARY_FUNCTIONS_H_
+#define ARBITRARY_PRECISION_CALCULATION_ELEMENTARY_FUNCTIONS_H_
+
+#include <gmp.h>
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Contains fast kernels for elementary functions.
+*
+* The kernels calculate the result with the precision of the result variable.
+* Internally they use guard bits such that the result is accurate up to a few units in the last place.
+* In contrast to the functions in mpftoperations they do not use the mpf_t pool and do not check the precision of their internal additions.
+* If the MPFR backend is selected at build time the kernels delegate to the correctly rounded functions of mpfrbackend.
+*/
+namespace elementaryfunctions {
+
+/**
+* @brief Precision (in bits) from which on the logarithm is calculated by the arithmetic-geometric mean instead of a series.
+*/
+const mp_bitcnt_t LOG_AGM_THRESHOLD_BITS = 2560;
+
+/**
+* @brief Binary exponent from which on the sine and the cosine are not calculated by the fast kernel.
+*/
+const long SIN_COS_MAXIMAL_EXPONENT = 1024;
+
+/**
+* @brief Binary logarithm of the number of intervals of the table for the reduction of the arcus tangent.
+*
+* The arcus tangent of all multiples of 2<sup>-ARCTAN_TABLE_BITS</sup> in [0, 1] is cached.
+*/
+const int ARCTAN_TABLE_BITS = 5;
+
+/**
+* @brief Maximal number of square roots which are used to evaluate a power with a dyadic rational exponent k / 2<sup>m</sup>.
+*/
+const int POW_MAXIMAL_DYADIC_ROOTS = 8;
+
+/**
+* @brief Calculates the exponential function.
+*
+* The argument is reduced by the nearest multiple of ln(2) and a power of two.
+* The reduced argument is evaluated by a Taylor series with rectangular (Paterson-Stockmeyer) splitting
+* and the reduction is reverted by repeated squaring.
+*
+* @param result The result.
+* @param v The argument.
+*
+* @retval TRUE if the result was calculated.
+* @retval FALSE if the absolute value of the argument is too large (at least 2<sup>40</sup>). The result is unchanged in this case.
+*/
+bool Exp(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the natural logarithm of a positive value.
+*
+* The argument is reduced by its power of two exponent.
+* Below LOG_AGM_THRESHOLD_BITS the remaining factor is reduced by square roots and evaluated by the series of the area hyperbolic tangent.
+* From LOG_AGM_THRESHOLD_BITS on the logarithm is calculated by the arithmetic-geometric mean.
+*
+* @param result The result.
+* @param v The argument, which needs to be positive.
+*/
+void LogE(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the sine and the cosine of a value at once.
+*
+* The argument is reduced by the nearest multiple of Pi / 2, where Pi is cached and calculated with enough precision to avoid cancellation.
+* The reduced argument is halved several times (depending on the precision), the sine is evaluated by a Taylor series
+* with rectangular splitting and the halvings are reverted by the doubling formulas.
+*
+* @param sin_result The result for the sine or NULL if the sine is not needed.
+* @param cos_result The result for the cosine or NULL if the cosine is not needed.
+* @param v The argument.
+* @param reduction If not NULL then the subtracted multiple of Pi / 2 is stored here.
+*
+* @retval TRUE if the results were calculated.
+* @retval FALSE if the absolute value of the argument is at least 2<sup>SIN_COS_MAXIMAL_EXPONENT</sup>. The results are unchanged in this case.
+*/
+bool SinCos(mpf_ptr sin_result, mpf_ptr cos_result, mpf_srcptr v, mpf_ptr reduction);
+
+/**
+* @brief Calculates the arcus tangent.
+*
+* Arguments with an absolute value larger than one are reduced by arctan(x) = sign(x) Pi / 2 - arctan(1 / x).
+* The remaining argument x is reduced by the nearest cached table point c with the addition formula
+* arctan(x) = arctan(c) + arctan((x - c) / (1 + x c)) and the small remainder is evaluated by a series
+* with rectangular splitting, which only divides by integers.
+*
+* @param result The result.
+* @param v The argument.
+*/
+void Arctan(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the arcus sine of a value in [-1, 1] by arcsin(x) = arctan(x / sqrt((1 - x) (1 + x))).
+*
+* @param result The result.
+* @param v The argument, which needs to lie in [-1, 1].
+*/
+void Arcsin(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the arcus cosine of a value in [-1, 1] by arccos(x) = 2 arctan(sqrt((1 - x) / (1 + x))), which avoids cancellation close to one.
+*
+* @param result The result.
+* @param v The argument, which needs to lie in [-1, 1].
+*/
+void Arccos(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates v to the power of p.
+*
+* Integer exponents are evaluated by binary exponentiation.
+* Dyadic rational exponents p = k / 2<sup>m</sup> with m at most POW_MAXIMAL_DYADIC_ROOTS are evaluated by m square roots followed by binary exponentiation.
+* All other exponents are evaluated by exp(p ln(v)), where the logarithm is calculated with enough guard bits to compensate the amplification of its error by the exponential function.
+*
+* @param result The result.
+* @param v The base, which needs to be nonzero.
+* @param p The exponent.
+*
+* @retval TRUE if the result was calculated.
+* @retval FALSE if the base is negative and the exponent is no integer or if the result is too large or too small for the exponential function. The result is unchanged in this case.
+*/
+bool Pow(mpf_t result, const mpf_t v, const mpf_t p);
+
+/**
+* @brief The cached arcus tangents of the table points of a context (see ARCTAN_TABLE_BITS).
+* The type is only defined in elementary_functions.cpp.
+*/
+struct ArctanTable;
+
+/**
+* @brief Creates an empty arcus tangent table for a new context.
+*
+* @return The new table.
+*/
+ArctanTable* CreateArctanTable();
+
+/**
+* @brief Frees an arcus tangent table including its values.
+*
+* @param arctan_table The table.
+*/
+void DestroyArctanTable(ArctanTable* arctan_table);
+
+} // namespace elementaryfunctions
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_ELEMENTARY_FUNCTIONS_H_ */
@@ -0,0 +1,386 @@
+/**
+* @file   arbitrary_precision_calculation/mpf_value.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains owning value types for mpf_t values and vectors of mpf_t values.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_MPF_VALUE_H_
+#define ARBITRARY_PRECISION_CALCULATION_MPF_VALUE_H_
+
+#include <gmp.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arbitrary_precision_calculation/operations.h"
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief An owning handle for a single mpf_t value.
+*
+* The handle releases its value to the mpf_t pool when it is destroyed.
+* Moving a handle transfers the ownership without touching the value, copying a handle clones the value.
+* The special values infinity and undefined can be stored as well.
+* The functions Get, Adopt and Release are the interface to the functions which work on raw mpf_t pointers.
+*/
+class Mpf {
+public:
+	/**
+	* @brief Creates an empty handle.
+	*/
+	Mpf() : value_(NULL) {}
+	/**
+	* @brief Creates a handle for the supplied double value.
+	*
+	* @param value The double value.
+	*/
+	explicit Mpf(double value) : value_(mpftoperations::ToMpft(value)) {}
+	/**
+	* @brief Creates a handle which holds a clone of the value of the supplied handle.
+	*
+	* @param other The supplied handle.
+	*/
+	Mpf(const Mpf & other) : value_(other.value_ == NULL ? NULL : mpftoperations::Clone(other.value_)) {}
+	/**
+	* @brief Takes over the value of the supplied handle, which is empty afterwards.
+	*
+	* @param other The supplied handle.
+	*/
+	Mpf(Mpf && other) : value_(other.value_) {
+		other.value_ = NULL;
+	}
+	/**
+	* @brief The destructor releases the value.
+	*/
+	~Mpf() {
+		mpftoperations::ReleaseValue(value_);
+	}
+	/**
+	* @brief Replaces the value by a clone of the value of the supplied handle.
+	*
+	* @param other The supplied handle.
+	*
+	* @return This handle.
+	*/
+	Mpf & operator=(const Mpf & other) {
+		if(this != &other){
+			if(other.value_ == NULL) Reset(NULL);
+			else mpftoperations::CopyTo(&value_, other.value_);
+		}
+		return *this;
+	}
+	/**
+	* @brief Replaces the value by the value of the supplied handle, which is empty afterwards.
+	*
+	* @param other The supplied handle.
+	*
+	* @return This handle.
+	*/
+	Mpf & operator=(Mpf && other) {
+		if(this != &other){
+			Reset(other.value_);
+			other.value_ = NULL;
+		}
+		return *this;
+	}
+
+	/**
+	* @brief Creates a handle which takes the ownership of the supplied value.
+	*
+	* @param value The value which must not be released by the caller anymore.
+	*
+	* @return The handle.
+	*/
+	static Mpf Adopt(mpf_t* value) {
+		Mpf res;
+		res.value_ = value;
+		return res;
+	}
+	/**
+	* @brief Creates a handle which holds a clone of the supplied value.
+	*
+	* @param value The value, which stays in the ownership of the caller.
+	*
+	* @return The handle.
+	*/
+	static Mpf Copy(const mpf_t* value) {
+		return Adopt(mpftoperations::Clone(value));
+	}
+
+	/**
+	* @brief Returns the value without transferring the ownership.
+	*
+	* @return The value. It is valid as long as the handle is not changed.
+	*/
+	mpf_t* Get() const {
+		return value_;
+	}
+	/**
+	* @brief Returns the storage of the handle such that the destination-passing functions can write into it.
+	*
+	* @return The pointer to the stored value.
+	*/
+	mpf_t** GetDestination() {
+		return &value_;
+	}
+	/**
+	* @brief Transfers the ownership of the value to the caller. The handle is empty afterwards.
+	*
+	* @return The value, which needs to be released by the caller.
+	*/
+	mpf_t* Release() {
+		mpf_t* res = value_;
+		value_ = NULL;
+		return res;
+	}
+	/**
+	* @brief Releases the current value and takes the ownership of the supplied value.
+	*
+	* @param value The new value.
+	*/
+	void Reset(mpf_t* value) {
+		if(value != value_){
+			mpftoperations::ReleaseValue(value_);
+			value_ = value;
+		}
+	}
+	/**
+	* @brief Checks whether the handle holds no value.
+	*
+	* @return true if the handle is empty.
+	*/
+	bool IsEmpty() const {
+		return value_ == NULL;
+	}
+	/**
+	* @brief Converts the value to a string.
+	*
+	* @return The string representation.
+	*/
+	std::string ToString() const {
+		return mpftoperations::MpftToString(value_);
+	}
+
+	Mpf & operator+=(const Mpf & other) { mpftoperations::AddTo(&value_, value_, other.value_); return *this; }
+	Mpf & operator-=(const Mpf & other) { mpftoperations::SubtractTo(&value_, value_, other.value_); return *this; }
+	Mpf & operator*=(const Mpf & other) { mpftoperations::MultiplyTo(&value_, value_, other.value_); return *this; }
+	Mpf & operator*=(double other) { mpftoperations::MultiplyTo(&value_, value_, other); return *this; }
+	Mpf & operator/=(const Mpf & other) { mpftoperations::DivideTo(&value_, value_, other.value_); return *this; }
+
+private:
+	mpf_t* value_;
+};
+
+inline Mpf operator+(const Mpf & a, const Mpf & b) { return Mpf::Adopt(mpftoperations::Add(a.Get(), b.Get())); }
+inline Mpf operator-(const Mpf & a, const Mpf & b) { return Mpf::Adopt(mpftoperations::Subtract(a.Get(), b.Get())); }
+inline Mpf operator*(const Mpf & a, const Mpf & b) { return Mpf::Adopt(mpftoperations::Multiply(a.Get(), b.Get())); }
+inline Mpf operator*(const Mpf & a, double b) { return Mpf::Adopt(mpftoperations::Multiply(a.Get(), b)); }
+inline Mpf operator/(const Mpf & a, const Mpf & b) { return Mpf::Adopt(mpftoperations::Divide(a.Get(), b.Get())); }
+inline Mpf operator-(const Mpf & a) { return Mpf::Adopt(mpftoperations::Negate(a.Get())); }
+inline Mpf operator+(Mpf && a, const Mpf & b) { a += b; return std::move(a); }
+inline Mpf operator-(Mpf && a, const Mpf & b) { a -= b; return std::move(a); }
+inline Mpf operator*(Mpf && a, const Mpf & b) { a *= b; return std::move(a); }
+inline Mpf operator*(Mpf && a, double b) { a *= b; return std::move(a); }
+inline Mpf operator/(Mpf && a, const Mpf & b) { a /= b; return std::move(a); }
+
+inline bool operator<(const Mpf & a, const Mpf & b) { return mpftoperations::Compare(a.Get(), b.Get()) < 0; }
+inline bool operator<=(const Mpf & a, const Mpf & b) { return mpftoperations::Compare(a.Get(), b.Get()) <= 0; }
+inline bool operator>(const Mpf & a, const Mpf & b) { return mpftoperations::Compare(a.Get(), b.Get()) > 0; }
+inline bool operator>=(const Mpf & a, const Mpf & b) { return mpftoperations::Compare(a.Get(), b.Get()) >= 0; }
+inline bool operator==(const Mpf & a, const Mpf & b) { return mpftoperations::Compare(a.Get(), b.Get()) == 0; }
+inline bool operator!=(const Mpf & a, const Mpf & b) { return mpftoperations::Compare(a.Get(), b.Get()) != 0; }
+
+/**
+* @brief An owning handle for a vector of mpf_t values.
+*
+* The handle releases all entries to the mpf_t pool when it is destroyed.
+* Moving a handle transfers the ownership of all entries without touching them, copying a handle clones the entries.
+* The functions Get, Adopt and Release are the interface to the functions which work on vectors of raw mpf_t pointers.
+*/
+class MpfVector {
+public:
+	/**
+	* @brief Creates an empty vector.
+	*/
+	MpfVector() {}
+	/**
+	* @brief Creates a vector which holds clones of the entries of the supplied vector.
+	*
+	* @param other The supplied vector.
+	*/
+	MpfVector(const MpfVector & other) : values_(vectoroperations::Clone(other.values_)) {}
+	/**
+	* @brief Takes over the entries of the supplied vector, which is empty afterwards.
+	*
+	* @param other The supplied vector.
+	*/
+	MpfVector(MpfVector && other) : values_(std::move(other.values_)) {
+		other.values_.clear();
+	}
+	/**
+	* @brief The destructor releases all entries.
+	*/
+	~MpfVector() {
+		vectoroperations::ReleaseValues(values_);
+	}
+	/**
+	* @brief Replaces the entries by clones of the entries of the supplied vector.
+	*
+	* @param other The supplied vector.
+	*
+	* @return This vector.
+	*/
+	MpfVector & operator=(const MpfVector & other) {
+		if(this != &other) Reset(vectoroperations::Clone(other.values_));
+		return *this;
+	}
+	/**
+	* @brief Replaces the entries by the entries of the supplied vector, which is empty afterwards.
+	*
+	* @param other The supplied vector.
+	*
+	* @return This vector.
+	*/
+	MpfVector & operator=(MpfVector && other) {
+		if(this != &other){
+			Reset(std::move(other.values_));
+			other.values_.clear();
+		}
+		return *this;
+	}
+
+	/**
+	* @brief Creates a vector which takes the ownership of all supplied entries.
+	*
+	* @param values The entries which must not be released by the caller anymore.
+	*
+	* @return The vector.
+	*/
+	static MpfVector Adopt(std::vector<mpf_t*> values) {
+		MpfVector res;
+		res.values_ = std::move(values);
+		return res;
+	}
+	/**
+	* @brief Creates a vector which holds clones of the supplied entries.
+	*
+	* @param values The entries, which stay in the ownership of the caller.
+	*
+	* @return The vector.
+	*/
+	static MpfVector Copy(const std::vector<mpf_t*> & values) {
+		return Adopt(vectoroperations::Clone(values));
+	}
+
+	/**
+	* @brief Returns a non-owning view of the entries.
+	*
+	* @return The entries. They are valid as long as the vector is not changed.
+	*/
+	const std::vector<mpf_t*> & Get() const {
+		return values_;
+	}
+	/**
+	* @brief Returns the storage of the vector such that the destination-passing functions can write into it.
+	*
+	* @return The pointer to the stored entries.
+	*/
+	std::vector<mpf_t*>* GetDestination() {
+		return &values_;
+	}
+	/**
+	* @brief Transfers the ownership of all entries to the caller. The vector is empty afterwards.
+	*
+	* @return The entries, which need to be released by the caller.
+	*/
+	std::vector<mpf_t*> Release() {
+		std::vector<mpf_t*> res;
+		res.swap(values_);
+		return res;
+	}
+	/**
+	* @brief Releases the current entries and takes the ownership of the supplied entries.
+	*
+	* @param values The new entries.
+	*/
+	void Reset(std::vector<mpf_t*> values) {
+		vectoroperations::ReleaseValues(values_);
+		values_ = std::move(values);
+	}
+	/**
+	* @brief Getter function for the number of entries.
+	*
+	* @return The number of entries.
+	*/
+	unsigned int size() const {
+		return values_.size();
+	}
+	/**
+	* @brief Returns the entry at the specified index without transferring the ownership.
+	*
+	* @param index The index.
+	*
+	* @return The entry.
+	*/
+	mpf_t* operator[](unsigned int index) const {
+		return values_[index];
+	}
+
+	MpfVector & operator+=(const MpfVector & other) { vectoroperations::AddTo(&values_, values_, other.values_); return *this; }
+	MpfVector & operator-=(const MpfVector & other) { vectoroperations::SubtractTo(&values_, values_, other.values_); return *this; }
+	MpfVector & operator*=(const MpfVector & other) { vectoroperations::MultiplyTo(&values_, values_, other.values_); return *this; }
+	MpfVector & operator*=(const Mpf & other) { vectoroperations::MultiplyTo(&values_, values_, other.Get()); return *this; }
+	MpfVector & operator*=(double other) { vectoroperations::MultiplyTo(&values_, values_, other); return *this; }
+
+private:
+	std::vector<mpf_t*> values_;
+};
+
+inline MpfVector operator+(const MpfVector & a, const MpfVector & b) { return MpfVector::Adopt(vectoroperations::Add(a.Get(), b.Get())); }
+inline MpfVector operator-(const MpfVector & a, const MpfVector & b) { return MpfVector::Adopt(vectoroperations::Subtract(a.Get(), b.Get())); }
+inline MpfVector operator*(const MpfVector & a, const MpfVector & b) { return MpfVector::Adopt(vectoroperations::Multiply(a.Get(), b.Get())); }
+inline MpfVector operator*(const MpfVector & a, const Mpf & b) { return MpfVector::Adopt(vectoroperations::Multiply(a.Get(), b.Get())); }
+inline MpfVector operator*(const MpfVector & a, double b) { return MpfVector::Adopt(vectoroperations::Multiply(a.Get(), b)); }
+inline MpfVector operator+(MpfVector && a, const MpfVector & b) { a += b; return std::move(a); }
+inline MpfVector operator-(MpfVector && a, const MpfVector & b) { a -= b; return std::move(a); }
+inline MpfVector operator*(MpfVector && a, const MpfVector & b) { a *= b; return std::move(a); }
+inline MpfVector operator*(MpfVector && a, const Mpf & b) { a *= b; return std::move(a); }
+inline MpfVector operator*(MpfVector && a, double b) { a *= b; return std::move(a); }
+
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_MPF_VALUE_H_ */
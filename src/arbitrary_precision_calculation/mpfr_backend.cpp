@@ -0,0 +1,199 @@
+/**
+* @file   arbitrary_precision_calculation/mpfr_backend.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the implementation of the kernels of the optional MPFR backend.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "arbitrary_precision_calculation/mpfr_backend.h"
+
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+
+#include <algorithm>
+#include <cstdlib>
+#include <mpfr.h>
+
+namespace arbitraryprecisioncalculation {
+namespace mpfrbackend {
+
+namespace {
+
+// The exponent range of mpf_t values is much larger than the default exponent range of MPFR.
+// The exponent range of MPFR is a property of the thread.
+void extendExponentRange() {
+	static thread_local bool extended = false;
+	if(extended) return;
+	mpfr_set_emin(mpfr_get_emin_min());
+	mpfr_set_emax(mpfr_get_emax_max());
+	extended = true;
+}
+
+// MPFR value which holds a mpf_t argument exactly.
+class Argument {
+public:
+	Argument(mpf_srcptr v) {
+		extendExponentRange();
+		mpfr_init2(value_, std::max(1, std::abs(v->_mp_size)) * GMP_NUMB_BITS);
+		mpfr_set_f(value_, v, MPFR_RNDN);
+	}
+	~Argument() { mpfr_clear(value_); }
+	operator mpfr_ptr() { return value_; }
+private:
+	mpfr_t value_;
+};
+
+// MPFR value which holds more limbs than the mpf_t result can store.
+class Result {
+public:
+	Result(mpf_srcptr result) {
+		extendExponentRange();
+		mpfr_init2(value_, mpf_get_prec(result) + 2 * GMP_NUMB_BITS);
+		mpfr_clear_flags();
+	}
+	~Result() { mpfr_clear(value_); }
+	operator mpfr_ptr() { return value_; }
+	// Returns true if the value is a regular number in the exponent range of MPFR.
+	bool IsRepresentable() {
+		return !mpfr_nan_p(value_) && !mpfr_inf_p(value_) && !mpfr_overflow_p() && !mpfr_underflow_p();
+	}
+	// mpfr_get_f would round to mpf_get_prec bits although the result stores one more limb.
+	// Hence the value is converted exactly and truncated to the stored limbs like by the mpf_t arithmetic.
+	void Get(mpf_ptr result) {
+		mpf_t exact;
+		mpf_init2(exact, mpfr_get_prec(value_));
+		mpfr_get_f(exact, value_, MPFR_RNDN);
+		mpf_set(result, exact);
+		mpf_clear(exact);
+	}
+private:
+	mpfr_t value_;
+};
+
+} // namespace
+
+bool Exp(mpf_t result, const mpf_t v) {
+	Argument x(v);
+	Result y(result);
+	mpfr_exp(y, x, MPFR_RNDN);
+	if(!y.IsRepresentable()) return false;
+	y.Get(result);
+	return true;
+}
+
+void LogE(mpf_t result, const mpf_t v) {
+	Argument x(v);
+	Result y(result);
+	mpfr_log(y, x, MPFR_RNDN);
+	y.Get(result);
+}
+
+void SinCos(mpf_ptr sin_result, mpf_ptr cos_result, mpf_srcptr v) {
+	Argument x(v);
+	if(sin_result != NULL && cos_result != NULL) {
+		Result s(sin_result), c(cos_result);
+		mpfr_sin_cos(s, c, x, MPFR_RNDN);
+		s.Get(sin_result);
+		c.Get(cos_result);
+	} else if(sin_result != NULL) {
+		Result s(sin_result);
+		mpfr_sin(s, x, MPFR_RNDN);
+		s.Get(sin_result);
+	} else if(cos_result != NULL) {
+		Result c(cos_result);
+		mpfr_cos(c, x, MPFR_RNDN);
+		c.Get(cos_result);
+	}
+}
+
+void Arctan(mpf_t result, const mpf_t v) {
+	Argument x(v);
+	Result y(result);
+	mpfr_atan(y, x, MPFR_RNDN);
+	y.Get(result);
+}
+
+void Arcsin(mpf_t result, const mpf_t v) {
+	Argument x(v);
+	Result y(result);
+	mpfr_asin(y, x, MPFR_RNDN);
+	y.Get(result);
+}
+
+void Arccos(mpf_t result, const mpf_t v) {
+	Argument x(v);
+	Result y(result);
+	mpfr_acos(y, x, MPFR_RNDN);
+	y.Get(result);
+}
+
+bool Pow(mpf_t result, const mpf_t v, const mpf_t p) {
+	Argument x(v), e(p);
+	Result y(result);
+	// MPFR returns NaN for negative bases with non-integer exponents
+	mpfr_pow(y, x, e, MPFR_RNDN);
+	if(!y.IsRepresentable()) return false;
+	y.Get(result);
+	return true;
+}
+
+void Pi(mpf_t result) {
+	Result y(result);
+	mpfr_const_pi(y, MPFR_RNDN);
+	y.Get(result);
+}
+
+void Ln2(mpf_t result) {
+	Result y(result);
+	mpfr_const_log2(y, MPFR_RNDN);
+	y.Get(result);
+}
+
+void E(mpf_t result) {
+	Result y(result);
+	mpfr_set_ui(y, 1, MPFR_RNDN);
+	mpfr_exp(y, y, MPFR_RNDN);
+	y.Get(result);
+}
+
+void Sqrt2(mpf_t result) {
+	Result y(result);
+	mpfr_sqrt_ui(y, 2, MPFR_RNDN);
+	y.Get(result);
+}
+
+} // namespace mpfrbackend
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR */
@@ -0,0 +1,155 @@
+/**
+* @file   arbitrary_precision_calculation/mpfr_backend.h
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains the kernels of the optional MPFR backend which evaluate elementary functions and constants with correct rounding.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef ARBITRARY_PRECISION_CALCULATION_MPFR_BACKEND_H_
+#define ARBITRARY_PRECISION_CALCULATION_MPFR_BACKEND_H_
+
+#include <gmp.h>
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Contains the kernels of the optional MPFR backend.
+*
+* The backend is selected at build time by "make BACKEND=mpfr", which defines ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR and links against MPFR.
+* The values are still stored as mpf_t values, such that the interface of mpftoperations does not change.
+* Only the elementary functions and the constants are evaluated by MPFR because the conversions would dominate the costs of additions and multiplications.
+* The kernels convert the arguments exactly, evaluate the function with the precision of the result variable plus one limb and round the value to the nearest mpf_t value.
+* The functions of this namespace are only available if the backend is selected.
+*/
+namespace mpfrbackend {
+
+/**
+* @brief Calculates the exponential function.
+*
+* @param result The result.
+* @param v The argument.
+*
+* @retval TRUE if the result was calculated.
+* @retval FALSE if the result is not representable in the exponent range of MPFR. The result is unchanged in this case.
+*/
+bool Exp(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the natural logarithm.
+*
+* @param result The result.
+* @param v The argument, which has to be positive.
+*/
+void LogE(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the sine and the cosine of the same argument.
+*
+* The argument reduction of MPFR is exact, hence no reduction has to be precision checked.
+*
+* @param sin_result The sine of the argument or NULL if the sine is not requested.
+* @param cos_result The cosine of the argument or NULL if the cosine is not requested.
+* @param v The argument.
+*/
+void SinCos(mpf_ptr sin_result, mpf_ptr cos_result, mpf_srcptr v);
+
+/**
+* @brief Calculates the arcus tangent.
+*
+* @param result The result.
+* @param v The argument.
+*/
+void Arctan(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the arcus sine.
+*
+* @param result The result.
+* @param v The argument, which has to be in [-1, 1].
+*/
+void Arcsin(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the arcus cosine.
+*
+* @param result The result.
+* @param v The argument, which has to be in [-1, 1].
+*/
+void Arccos(mpf_t result, const mpf_t v);
+
+/**
+* @brief Calculates the power v<sup>p</sup>.
+*
+* @param result The result.
+* @param v The base.
+* @param p The exponent.
+*
+* @retval TRUE if the result was calculated.
+* @retval FALSE if the base is negative and the exponent is not an integer or if the result is not representable in the exponent range of MPFR. The result is unchanged in this case.
+*/
+bool Pow(mpf_t result, const mpf_t v, const mpf_t p);
+
+/**
+* @brief Calculates the constant Pi.
+*
+* @param result The result.
+*/
+void Pi(mpf_t result);
+
+/**
+* @brief Calculates the natural logarithm of two.
+*
+* @param result The result.
+*/
+void Ln2(mpf_t result);
+
+/**
+* @brief Calculates Euler's number e.
+*
+* @param result The result.
+*/
+void E(mpf_t result);
+
+/**
+* @brief Calculates the square root of two.
+*
+* @param result The result.
+*/
+void Sqrt2(mpf_t result);
+
+} // namespace mpfrbackend
+} // namespace arbitraryprecisioncalculation
+
+#endif /* ARBITRARY_PRECISION_CALCULATION_MPFR_BACKEND_H_ */
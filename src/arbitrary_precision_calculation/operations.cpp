@@ -41,17 +41,27 @@
 #include "arbitrary_precision_calculation/operations.h"
 
 #include <algorithm>
+#include <climits>
 #include <fstream>
-#include <queue>
+#include <iostream>
+#include <map>
 #include <sstream>
 #include <string.h>
-#include <unordered_set>
 #include <cmath>
 
 #include "arbitrary_precision_calculation/check_condition.h"
 #include "arbitrary_precision_calculation/configuration.h"
+#include "arbitrary_precision_calculation/constants.h"
+#include "arbitrary_precision_calculation/context.h"
+#include "arbitrary_precision_calculation/elementary_functions.h"
 
 namespace arbitraryprecisioncalculation {
+namespace mpftoperations {
+// Calculates the sine or the cosine of each element, where the reference implementation computes the constants
+// of the argument reduction only once for all elements.
+std::vector<mpf_t*> sinOrCosOfElements(const std::vector<mpf_t*> & a, bool cosine);
+} // namespace mpftoperations
+
 namespace vectoroperations {
 
 std::vector<mpf_t*> Add(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
@@ -103,24 +113,226 @@ std::vector<mpf_t*> Multiply(const std::vector<mpf_t*> & a, const std::vector<do
 
 std::vector<mpf_t*> Multiply(const std::vector<mpf_t*> & a, const double & b) {
 	mpf_t* mpf_t_b = mpftoperations::ToMpft(b);
-	std::vector<mpf_t*> bvec(a.size(), mpf_t_b);
-	std::vector<mpf_t*> res = vectoroperations::Multiply(a, bvec);
+	std::vector<mpf_t*> res = vectoroperations::Multiply(a, mpf_t_b);
 	mpftoperations::ReleaseValue(mpf_t_b);
 	return res;
 }
 
 std::vector<mpf_t*> Multiply(const std::vector<mpf_t*> & a, mpf_t* b) {
-	std::vector<mpf_t*> bvec(a.size(), b);
-	std::vector<mpf_t*> res = vectoroperations::Multiply(a, bvec);
+	std::vector<mpf_t*> res(a.size(), (mpf_t*)NULL);
+	for (unsigned int i = 0; i < a.size(); i++) {
+		res[i] = mpftoperations::Multiply(a[i], b);
+	}
+	return res;
+}
+
+// Applies the function to each element of the vector.
+// The fast kernels take their scratch registers from a pool and their constants from the constants engine,
+// hence consecutive elements reuse the limbs and the constants of the previous ones.
+std::vector<mpf_t*> applyElementWise(const std::vector<mpf_t*> & a, mpf_t* (*function)(mpf_t*)) {
+	std::vector<mpf_t*> res(a.size(), (mpf_t*)NULL);
+	for (unsigned int i = 0; i < a.size(); i++) {
+		res[i] = function(a[i]);
+	}
+	return res;
+}
+
+std::vector<mpf_t*> Sin(const std::vector<mpf_t*> & a) {
+	return mpftoperations::sinOrCosOfElements(a, false);
+}
+
+std::vector<mpf_t*> Cos(const std::vector<mpf_t*> & a) {
+	return mpftoperations::sinOrCosOfElements(a, true);
+}
+
+std::vector<mpf_t*> Exp(const std::vector<mpf_t*> & a) {
+	return applyElementWise(a, mpftoperations::Exp);
+}
+
+std::vector<mpf_t*> LogE(const std::vector<mpf_t*> & a) {
+	return applyElementWise(a, mpftoperations::LogE);
+}
+
+std::vector<mpf_t*> Sqrt(const std::vector<mpf_t*> & a) {
+	return applyElementWise(a, mpftoperations::Sqrt);
+}
+
+// Resizes the destination vector to the given size.
+// Surplus values are released and new entries are initialized with NULL.
+void prepareDestination(std::vector<mpf_t*>* result, unsigned int size) {
+	for (unsigned int i = size; i < result->size(); i++) {
+		mpftoperations::ReleaseValue((*result)[i]);
+	}
+	result->resize(size, (mpf_t*)NULL);
+}
+
+void AddTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Addition of vectors with different size has been executed.");
+	prepareDestination(result, a.size());
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::AddTo(&(*result)[i], a[i], b[i]);
+	}
+}
+
+void SubtractTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Subtraction of vectors with different size has been executed.");
+	prepareDestination(result, a.size());
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::SubtractTo(&(*result)[i], a[i], b[i]);
+	}
+}
+
+void DivideTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Division of vectors with different size has been executed.");
+	prepareDestination(result, a.size());
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::DivideTo(&(*result)[i], a[i], b[i]);
+	}
+}
+
+void MultiplyTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Multiplication of vectors with different size has been executed.");
+	prepareDestination(result, a.size());
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::MultiplyTo(&(*result)[i], a[i], b[i]);
+	}
+}
+
+void MultiplyTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const double & b) {
+	mpf_t* mpf_t_b = mpftoperations::ToMpft(b);
+	MultiplyTo(result, a, mpf_t_b);
+	mpftoperations::ReleaseValue(mpf_t_b);
+}
+
+void MultiplyTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const mpf_t* b) {
+	prepareDestination(result, a.size());
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::MultiplyTo(&(*result)[i], a[i], b);
+	}
+}
+
+void RandomizeTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a) {
+	prepareDestination(result, a.size());
+	RandomNumberGenerator* random = Configuration::getStandardRandomNumberGenerator();
+	mpf_t* random_value = NULL;
+	for (unsigned int i = 0; i < a.size(); i++) {
+		random->RandomMpftTo(&random_value);
+		mpftoperations::MultiplyTo(&(*result)[i], random_value, a[i]);
+	}
+	mpftoperations::ReleaseValue(random_value);
+}
+
+void FillRandom(std::vector<mpf_t*>* result, int dimensions) {
+	FillRandom(result, dimensions, Configuration::getStandardRandomNumberGenerator());
+}
+
+void FillRandom(std::vector<mpf_t*>* result, int dimensions, RandomNumberGenerator* random) {
+	prepareDestination(result, dimensions);
+	for (int i = 0; i < dimensions; i++) {
+		random->RandomMpftTo(&(*result)[i]);
+	}
+}
+
+void FillGaussianRandom(std::vector<mpf_t*>* result, int dimensions, double mu, double sigma) {
+	FillGaussianRandom(result, dimensions, mu, sigma, Configuration::getStandardRandomNumberGenerator());
+}
+
+void FillGaussianRandom(std::vector<mpf_t*>* result, int dimensions, double mu, double sigma, RandomNumberGenerator* random) {
+	prepareDestination(result, dimensions);
+	if (Configuration::getGaussianAlgorithm() == configuration::GAUSSIAN_ALGORITHM_POLAR) {
+		// both values of each pair are used, only the second value of the last pair
+		// is dropped for an odd number of entries
+		mpf_t* dropped = NULL;
+		for (int i = 0; i < dimensions; i += 2) {
+			mpf_t** second = (i + 1 < dimensions) ? &(*result)[i + 1] : &dropped;
+			mpftoperations::GaussianRandomPairTo(&(*result)[i], second, mu, sigma, random);
+		}
+		mpftoperations::ReleaseValue(dropped);
+	} else {
+		for (int i = 0; i < dimensions; i++) {
+			mpf_t* value = mpftoperations::GetGaussianRandomMpft(mu, sigma, random);
+			mpftoperations::ReleaseValue((*result)[i]);
+			(*result)[i] = value;
+		}
+	}
+}
+
+void AxpyInPlace(std::vector<mpf_t*>* y, const mpf_t* alpha, const std::vector<mpf_t*> & x) {
+	AssertCondition(y->size() == x.size(), "Axpy of vectors with different size has been executed.");
+	ScaleAdd(y, *y, alpha, x);
+}
+
+void ScaleAdd(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & x, const mpf_t* alpha, const std::vector<mpf_t*> & y) {
+	AssertCondition(x.size() == y.size(), "Scaled addition of vectors with different size has been executed.");
+	prepareDestination(result, x.size());
+	mpf_t* scaled = NULL;
+	for (unsigned int i = 0; i < x.size(); i++) {
+		mpftoperations::MultiplyTo(&scaled, y[i], alpha);
+		mpftoperations::AddTo(&(*result)[i], x[i], scaled);
+	}
+	mpftoperations::ReleaseValue(scaled);
+}
+
+void Axpby(std::vector<mpf_t*>* result, const mpf_t* alpha, const std::vector<mpf_t*> & x, const mpf_t* beta, const std::vector<mpf_t*> & y) {
+	AssertCondition(x.size() == y.size(), "Axpby of vectors with different size has been executed.");
+	prepareDestination(result, x.size());
+	mpf_t* scaled_x = NULL;
+	mpf_t* scaled_y = NULL;
+	for (unsigned int i = 0; i < x.size(); i++) {
+		mpftoperations::MultiplyTo(&scaled_x, x[i], alpha);
+		mpftoperations::MultiplyTo(&scaled_y, y[i], beta);
+		mpftoperations::AddTo(&(*result)[i], scaled_x, scaled_y);
+	}
+	mpftoperations::ReleaseValue(scaled_x);
+	mpftoperations::ReleaseValue(scaled_y);
+}
+
+void LinearCombination3(std::vector<mpf_t*>* result, const mpf_t* alpha, const std::vector<mpf_t*> & a,
+		const mpf_t* beta, const std::vector<mpf_t*> & b, const mpf_t* gamma, const std::vector<mpf_t*> & c) {
+	AssertCondition(a.size() == b.size() && a.size() == c.size(), "Linear combination of vectors with different size has been executed.");
+	prepareDestination(result, a.size());
+	mpf_t* partial_sum = NULL;
+	mpf_t* scaled = NULL;
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::MultiplyTo(&partial_sum, a[i], alpha);
+		mpftoperations::MultiplyTo(&scaled, b[i], beta);
+		mpftoperations::AddTo(&partial_sum, partial_sum, scaled);
+		mpftoperations::MultiplyTo(&scaled, c[i], gamma);
+		mpftoperations::AddTo(&(*result)[i], partial_sum, scaled);
+	}
+	mpftoperations::ReleaseValue(partial_sum);
+	mpftoperations::ReleaseValue(scaled);
+}
+
+mpf_t* Dot(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Dot product of vectors with different size has been executed.");
+	mpf_t* res = mpftoperations::ToMpft(0.0);
+	mpf_t* product = NULL;
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::MultiplyTo(&product, a[i], b[i]);
+		mpftoperations::AddTo(&res, product, res);
+	}
+	mpftoperations::ReleaseValue(product);
+	return res;
+}
+
+mpf_t* SquaredDistance(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b) {
+	AssertCondition(a.size() == b.size(), "Distance of vectors with different size has been calculated.");
+	mpf_t* res = mpftoperations::ToMpft(0.0);
+	mpf_t* difference = NULL;
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpftoperations::SubtractTo(&difference, a[i], b[i]);
+		mpftoperations::MultiplyTo(&difference, difference, difference);
+		mpftoperations::AddTo(&res, difference, res);
+	}
+	mpftoperations::ReleaseValue(difference);
 	return res;
 }
 
 mpf_t* Add(const std::vector<mpf_t*> & a){
 	mpf_t* res = mpftoperations::ToMpft(0.0);
 	for(unsigned int i = 0; i < a.size(); i++){
-		mpf_t* tmp = res;
-		res = mpftoperations::Add(a[i], tmp);
-		mpftoperations::ReleaseValue(tmp);
+		mpftoperations::AddTo(&res, a[i], res);
 	}
 	return res;
 }
@@ -167,6 +379,14 @@ std::vector<mpf_t*> Clone(const std::vector<mpf_t*> & a) {
 	return res;
 }
 
+void MarkExact(const std::vector<mpf_t*> & a) {
+	for (unsigned int i = 0; i < a.size(); i++) {
+		if(!mpftoperations::IsInfinite(a[i]) && !mpftoperations::IsUndefined(a[i])) {
+			mpftoperations::SetBallRadiusExponent(a[i], mpftoperations::BALL_RADIUS_EXACT);
+		}
+	}
+}
+
 std::vector<mpf_t*> Randomize(const std::vector<mpf_t*> & a) {
 	std::vector<mpf_t*> randomVector = GetRandomVector(a.size());
 	std::vector<mpf_t*> res = vectoroperations::Multiply(a, randomVector);
@@ -175,10 +395,8 @@ std::vector<mpf_t*> Randomize(const std::vector<mpf_t*> & a) {
 }
 
 std::vector<mpf_t*> GetRandomVector(int dimensions) {
-	std::vector<mpf_t*> res(dimensions, (mpf_t*) NULL);
-	for(int i = 0; i < dimensions; i++){
-		res[i] = mpftoperations::GetRandomMpft();
-	}
+	std::vector<mpf_t*> res;
+	FillRandom(&res, dimensions);
 	return res;
 }
 
@@ -200,15 +418,11 @@ bool Equals(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b){
 
 // orthogonally projects the vector vec on the vector projection_vector
 std::vector<mpf_t*> OrthogonalProjection(const std::vector<mpf_t*> & vec, const std::vector<mpf_t*> & projection_vector){
-	std::vector<mpf_t*> tmp_v1, tmp_v2, result;
-	mpf_t* tmp_m1;
-	mpf_t* tmp_m2;
+	std::vector<mpf_t*> result;
+	mpf_t* tmp_m1 = Dot(vec, projection_vector);
+	mpf_t* tmp_m2 = Dot(projection_vector, projection_vector);
 	mpf_t* tmp_m3;
-	tmp_v1 = Multiply(vec, projection_vector);
-	tmp_m1 = Add(tmp_v1);
-	tmp_v2 = Multiply(projection_vector, projection_vector);
-	tmp_m2 = Add(tmp_v2);
-	if(mpftoperations::Compare(tmp_m2, 0.0) == 0) {
+	if(mpftoperations::IsZero(tmp_m2)) {
 		tmp_m3 = mpftoperations::Clone(tmp_m1);
 	} else {
 		tmp_m3 = mpftoperations::Divide(tmp_m1, tmp_m2);
@@ -217,16 +431,11 @@ std::vector<mpf_t*> OrthogonalProjection(const std::vector<mpf_t*> & vec, const
 	mpftoperations::ReleaseValue(tmp_m1);
 	mpftoperations::ReleaseValue(tmp_m2);
 	mpftoperations::ReleaseValue(tmp_m3);
-	vectoroperations::ReleaseValues(tmp_v1);
-	vectoroperations::ReleaseValues(tmp_v2);
 	return result;
 }
 
 mpf_t* SquaredEuclideanLength(const std::vector<mpf_t*> & vec){
-	std::vector<mpf_t*> help = Multiply(vec, vec);
-	mpf_t* res = Add(help);
-	ReleaseValues(help);
-	return res;
+	return Dot(vec, vec);
 }
 
 void Sort(std::vector<mpf_t*> * vec){
@@ -241,34 +450,268 @@ void Sort(std::vector<mpf_t*> * vec){
 
 namespace mpftoperations {
 
-int number_of_mpf_t_values_in_use_ = 0;
-int number_of_mpf_t_values_cached_ = 0;
-bool statistical_calculations_active_ = false;
-int statistical_calculations_active_depth_ = 0;
-std::unordered_set<mpf_t*> available_mpf_t_;
-std::queue<mpf_t*> available_mpf_t_queue_;
-int last_number_of_added_mpf_t_pointers_ = 1;
+// Each mpf_t handed out by GetResultPointer lives inside a slot of a slab.
+// The value is the first member such that a mpf_t* can be converted back to its slot.
+struct MpftPoolSlot {
+	mpf_t value;
+	// number of limbs (mpf_t precision) the limb storage of the value was initialized with
+	// or 0 if the value currently owns no limb storage
+	mp_size_t allocated_precision;
+	bool in_use;
+	// error radius of the value in the ball arithmetic (see GetBallRadiusExponent)
+	long radius_exponent;
+	// state of the context which created the slot, the value has to be released there
+	OperationsState* owner;
+};
+
+// State of the mpftoperations namespace, which is owned by a context.
+struct OperationsState {
+	int number_of_mpf_t_values_in_use;
+	int maximal_number_of_mpf_t_values_in_use;
+	int number_of_mpf_t_values_pooled;
+	int number_of_mpf_t_values_cached;
+	bool statistical_calculations_active;
+	int statistical_calculations_active_depth;
+	bool mpf_t_pool_debug_mode;
+	// all slabs of slots with their sizes
+	std::vector<std::pair<MpftPoolSlot*, int> > slabs;
+	// released slots without limb storage
+	std::vector<MpftPoolSlot*> uninitialized_slots;
+	// released slots with attached limb storage, indexed by the number of allocated limbs
+	std::vector<std::vector<MpftPoolSlot*> > initialized_slots_by_precision;
+	int last_number_of_added_mpf_t_pointers;
+	unsigned long current_default_precision_bits;
+	mp_size_t current_default_precision_limbs;
+	// Sum of the operands of the exponent based precision check.
+	// It is kept outside of the pool such that no values are allocated during the check.
+	mpf_t exponent_check_sum;
+	mp_size_t exponent_check_sum_allocated_precision;
+	int number_of_precision_check_disagreements;
+	// true while the random value is drawn which decides whether an addition is checked,
+	// the additions of this drawing are not checked themselves
+	bool drawing_precision_check_sample;
+	std::map<std::string, long long> undecidable_comparisons;
+	mpf_t* pi_cached;
+	unsigned int pi_cached_precision;
+	mpf_t* e_cached;
+	unsigned int e_cached_precision;
+	constants::CachedConstants* cached_constants;
+	elementaryfunctions::ArctanTable* arctan_table;
+};
+
+OperationsState* CreateOperationsState() {
+	OperationsState* state = new OperationsState();
+	state->number_of_mpf_t_values_in_use = 0;
+	state->maximal_number_of_mpf_t_values_in_use = 0;
+	state->number_of_mpf_t_values_pooled = 0;
+	state->number_of_mpf_t_values_cached = 0;
+	state->statistical_calculations_active = false;
+	state->statistical_calculations_active_depth = 0;
+	state->mpf_t_pool_debug_mode = false;
+	state->last_number_of_added_mpf_t_pointers = 1;
+	state->current_default_precision_bits = 0;
+	state->current_default_precision_limbs = 0;
+	state->exponent_check_sum_allocated_precision = 0;
+	state->number_of_precision_check_disagreements = 0;
+	state->drawing_precision_check_sample = false;
+	state->pi_cached = NULL;
+	state->pi_cached_precision = 1;
+	state->e_cached = NULL;
+	state->e_cached_precision = 1;
+	state->cached_constants = constants::CreateCachedConstants();
+	state->arctan_table = elementaryfunctions::CreateArctanTable();
+	return state;
+}
+
+void clearSlot(MpftPoolSlot* slot);
+
+void DestroyOperationsState(OperationsState* state) {
+	for(unsigned int i = 0; i < state->slabs.size(); i++) {
+		for(int j = 0; j < state->slabs[i].second; j++) {
+			MpftPoolSlot* slot = state->slabs[i].first + j;
+			// the cached values of pi and e are owned by the state itself
+			AssertCondition(!slot->in_use || &slot->value == state->pi_cached || &slot->value == state->e_cached,
+					"All values of a context need to be released before the context is destroyed.");
+			if(slot->allocated_precision > 0) clearSlot(slot);
+		}
+		delete[] state->slabs[i].first;
+	}
+	if(state->exponent_check_sum_allocated_precision > 0) {
+		state->exponent_check_sum->_mp_prec = state->exponent_check_sum_allocated_precision;
+		mpf_clear(state->exponent_check_sum);
+	}
+	constants::DestroyCachedConstants(state->cached_constants);
+	elementaryfunctions::DestroyArctanTable(state->arctan_table);
+	delete state;
+}
+
+constants::CachedConstants* GetCachedConstants(OperationsState* state) {
+	return state->cached_constants;
+}
+
+elementaryfunctions::ArctanTable* GetArctanTable(OperationsState* state) {
+	return state->arctan_table;
+}
+
+inline OperationsState& state() {
+	return *Context::GetCurrent()->GetOperationsState();
+}
+
+// The special values are shared by all contexts. They are not part of any pool.
+struct SpecialValue {
+	SpecialValue() {
+		mpf_init(slot.value);
+		slot.allocated_precision = slot.value[0]._mp_prec;
+		slot.in_use = true;
+		slot.radius_exponent = BALL_RADIUS_EXACT;
+		slot.owner = NULL;
+	}
+	MpftPoolSlot slot;
+};
+
+SpecialValue plus_infinity_;
+SpecialValue minus_infinity_;
+SpecialValue undefined_;
+
+
+// Returns true if the elementary functions are evaluated by the kernels in elementary_functions.h.
+// The kernels of the MPFR backend are reached through them, hence they are always used with this backend.
+inline bool useElementaryFunctionKernels() {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	return true;
+#else
+	return Configuration::getElementaryFunctionAlgorithm() == configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST;
+#endif
+}
+
+// Returns true if Pi and e are supplied by the constants namespace.
+inline bool useConstantsEngine() {
+#ifdef ARBITRARY_PRECISION_CALCULATION_BACKEND_MPFR
+	return true;
+#else
+	return Configuration::getConstantAlgorithm() == configuration::CONSTANT_ALGORITHM_ENGINE;
+#endif
+}
+
+inline MpftPoolSlot* getSlot(mpf_t* value) {
+	return reinterpret_cast<MpftPoolSlot*>(value);
+}
+
+// calculates the number of limbs mpf_init would use for the precision of the current context
+inline mp_size_t getDefaultPrecisionLimbs(OperationsState& state) {
+	unsigned long bits = Context::GetCurrent()->GetPrecision();
+	if(bits != state.current_default_precision_bits){
+		state.current_default_precision_bits = bits;
+		state.current_default_precision_limbs = (bits + 2 * GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+	}
+	return state.current_default_precision_limbs;
+}
+
+inline mp_size_t getDefaultPrecisionLimbs() {
+	return getDefaultPrecisionLimbs(state());
+}
+
+void clearSlot(MpftPoolSlot* slot) {
+	// restore the precision of the allocation such that gmp frees the correct amount of memory
+	slot->value[0]._mp_prec = slot->allocated_precision;
+	mpf_clear(slot->value);
+	slot->allocated_precision = 0;
+}
+
+// Prepares a slot whose value has exactly the specified precision (in limbs) and is set to zero.
+mpf_t* getResultPointerWithPrecision(OperationsState& state, mp_size_t precision) {
+	++state.number_of_mpf_t_values_in_use;
+	if(state.number_of_mpf_t_values_in_use > state.maximal_number_of_mpf_t_values_in_use) {
+		state.maximal_number_of_mpf_t_values_in_use = state.number_of_mpf_t_values_in_use;
+	}
+	MpftPoolSlot* slot = NULL;
+	if(precision < (mp_size_t)state.initialized_slots_by_precision.size()
+			&& !state.initialized_slots_by_precision[precision].empty()) {
+		slot = state.initialized_slots_by_precision[precision].back();
+		state.initialized_slots_by_precision[precision].pop_back();
+		--state.number_of_mpf_t_values_pooled;
+		// equivalent to mpf_init with already attached limb storage (mpf_set_prec_raw)
+		slot->value[0]._mp_prec = precision;
+		slot->value[0]._mp_size = 0;
+		slot->value[0]._mp_exp = 0;
+	} else {
+		if (state.uninitialized_slots.empty()) {
+			state.last_number_of_added_mpf_t_pointers *= 2;
+			MpftPoolSlot* next_slots = new MpftPoolSlot[state.last_number_of_added_mpf_t_pointers];
+			state.slabs.push_back(std::make_pair(next_slots, state.last_number_of_added_mpf_t_pointers));
+			for (int i = state.last_number_of_added_mpf_t_pointers - 1; i >= 0; i--) {
+				next_slots[i].allocated_precision = 0;
+				next_slots[i].in_use = false;
+				next_slots[i].owner = &state;
+				state.uninitialized_slots.push_back(next_slots + i);
+			}
+		}
+		slot = state.uninitialized_slots.back();
+		state.uninitialized_slots.pop_back();
+		mpf_init2(slot->value, (precision - 1) * GMP_NUMB_BITS);
+		AssertConditionAtLevel(ASSERTION_LEVEL_CHEAP, slot->value[0]._mp_prec == precision, "Internal Error. Precision of new generated mpf_t is not valid.");
+		slot->allocated_precision = precision;
+	}
+	if(state.mpf_t_pool_debug_mode) {
+		AssertConditionAtLevel(ASSERTION_LEVEL_CHEAP, !slot->in_use, "Internal Error. New generated mpf_t pointer is not valid.");
+	}
+	slot->in_use = true;
+	slot->radius_exponent = BALL_RADIUS_EXACT;
+	return &(slot->value);
+}
+
+mpf_t* getResultPointerWithPrecision(mp_size_t precision) {
+	return getResultPointerWithPrecision(state(), precision);
+}
 
 int GetNumberOfMpftValuesInUse() {
-	return number_of_mpf_t_values_in_use_;
+	return state().number_of_mpf_t_values_in_use;
+}
+
+int GetMaximalNumberOfMpftValuesInUse() {
+	return state().maximal_number_of_mpf_t_values_in_use;
+}
+
+int GetNumberOfMpftValuesPooled() {
+	return state().number_of_mpf_t_values_pooled;
+}
+
+void TrimMpftPool() {
+	for(unsigned int precision = 0; precision < state().initialized_slots_by_precision.size(); precision++) {
+		for(MpftPoolSlot* slot : state().initialized_slots_by_precision[precision]) {
+			clearSlot(slot);
+			state().uninitialized_slots.push_back(slot);
+		}
+		state().number_of_mpf_t_values_pooled -= state().initialized_slots_by_precision[precision].size();
+		std::vector<MpftPoolSlot*>().swap(state().initialized_slots_by_precision[precision]);
+	}
+	AssertCondition(state().number_of_mpf_t_values_pooled == 0, "Internal Error. Trim of mpf_t pool failed.");
+}
+
+void SetMpftPoolDebugMode(bool active) {
+	state().mpf_t_pool_debug_mode = active;
+}
+
+bool IsMpftPoolDebugModeActive() {
+	return state().mpf_t_pool_debug_mode;
 }
 
 int GetNumberOfMpftValuesCached() {
-	return number_of_mpf_t_values_cached_;
+	return state().number_of_mpf_t_values_cached;
 }
 
 void ChangeNumberOfMpftValuesCached(int change){
-	number_of_mpf_t_values_cached_ += change;
+	state().number_of_mpf_t_values_cached += change;
 }
 
 void StatisticalCalculationsStart(){
-	++statistical_calculations_active_depth_;
-	statistical_calculations_active_ = true;
+	++state().statistical_calculations_active_depth;
+	state().statistical_calculations_active = true;
 }
 
 void StatisticalCalculationsEnd() {
-	if( 0 == --statistical_calculations_active_depth_ )
-		statistical_calculations_active_ = false;
+	if( 0 == --state().statistical_calculations_active_depth )
+		state().statistical_calculations_active = false;
 }
 
 
@@ -286,27 +729,49 @@ mpf_t* subtract_NO_CHECK(const mpf_t* a, const mpf_t* b) {
 }
 
 void IncreasePrecision(){
-	int curprec = mpf_get_default_prec();
-	mpf_set_default_prec(curprec + 10);
+	Context* context = Context::GetCurrent();
+	context->SetPrecision(context->GetPrecision() + 10);
 }
 
 mpf_t* GetResultPointer() {
-	++number_of_mpf_t_values_in_use_;
-	if (available_mpf_t_queue_.empty()) {
-		last_number_of_added_mpf_t_pointers_ *= 2;
-		mpf_t *next_mpf_t = new mpf_t[last_number_of_added_mpf_t_pointers_];
-		for (int i = 0; i < last_number_of_added_mpf_t_pointers_; i++) {
-			available_mpf_t_.insert(next_mpf_t + i);
-			available_mpf_t_queue_.push(next_mpf_t + i);
-		}
-	}
+	OperationsState& current_state = state();
+	return getResultPointerWithPrecision(current_state, getDefaultPrecisionLimbs(current_state));
+}
 
-	mpf_t* res = available_mpf_t_queue_.front();
-	available_mpf_t_queue_.pop();
-	AssertCondition(available_mpf_t_.find(res) != available_mpf_t_.end(), "Internal Error. New generated mpf_t pointer is not valid.");
-	available_mpf_t_.erase(res);
-	mpf_init(*res);
-	return res;
+// The precision (in limbs) of a result of an operation on the supplied finite operand:
+// the maximum of the precision of the operand and of the current context.
+inline mp_size_t resultPrecision(const mpf_t* a) {
+	return std::max(getDefaultPrecisionLimbs(), (mp_size_t)(*a)->_mp_prec);
+}
+
+inline mp_size_t resultPrecision(const mpf_t* a, const mpf_t* b) {
+	return std::max(resultPrecision(a), (mp_size_t)(*b)->_mp_prec);
+}
+
+unsigned long GetPrecision(const mpf_t* value) {
+	if(IsInfinite(value) || IsUndefined(value)) return 0;
+	return mpf_get_prec(*value);
+}
+
+bool IsEquivalentPrecision(unsigned long precision1, unsigned long precision2) {
+	// gmp only uses the number of limbs, the precision in bits is rounded up to full limbs
+	return (precision1 + 2 * GMP_NUMB_BITS - 1) / GMP_NUMB_BITS == (precision2 + 2 * GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+}
+
+void UpgradePrecision(mpf_t* value) {
+	if(IsInfinite(value) || IsUndefined(value)) return;
+	mp_size_t precision = getDefaultPrecisionLimbs();
+	MpftPoolSlot* slot = getSlot(value);
+	if((*value)->_mp_prec >= precision) return;
+	if(slot->allocated_precision < precision) {
+		// mpf_set_prec keeps the value while it reallocates the limb storage
+		(*value)->_mp_prec = slot->allocated_precision;
+		mpf_set_prec(*value, (precision - 1) * GMP_NUMB_BITS);
+		AssertCondition((*value)->_mp_prec == precision, "Internal Error. Upgrade of precision failed.");
+		slot->allocated_precision = precision;
+	} else {
+		(*value)->_mp_prec = precision;
+	}
 }
 
 mpf_t* ToMpft(double v) {
@@ -380,38 +845,76 @@ void ReleaseValue(mpf_t* a) {
 	if (IsUndefined(a)){
 		return;
 	}
-	AssertCondition(available_mpf_t_.find(a) == available_mpf_t_.end(), "Multiple frees on same mpf_t.");
-	number_of_mpf_t_values_in_use_--;
-	mpf_clear(*a);
-	available_mpf_t_queue_.push(a);
-	available_mpf_t_.insert(a);
+	MpftPoolSlot* slot = getSlot(a);
+	OperationsState& current_state = state();
+	AssertConditionAtLevel(ASSERTION_LEVEL_CHEAP, slot->owner == &current_state, "A mpf_t value has to be released in the context which created it.");
+	if(current_state.mpf_t_pool_debug_mode) {
+		AssertConditionAtLevel(ASSERTION_LEVEL_CHEAP, slot->in_use, "Multiple frees on same mpf_t.");
+	}
+	slot->in_use = false;
+	current_state.number_of_mpf_t_values_in_use--;
+	if(slot->allocated_precision != getDefaultPrecisionLimbs(current_state)) {
+		// the precision has been changed meanwhile, hence limbs of this size will rarely be requested again
+		// (only results of operands with a higher precision than the default precision are larger)
+		clearSlot(slot);
+		current_state.uninitialized_slots.push_back(slot);
+		return;
+	}
+	if(slot->allocated_precision >= (mp_size_t)current_state.initialized_slots_by_precision.size()) {
+		current_state.initialized_slots_by_precision.resize(slot->allocated_precision + 1);
+	}
+	current_state.initialized_slots_by_precision[slot->allocated_precision].push_back(slot);
+	++current_state.number_of_mpf_t_values_pooled;
 }
 
-inline void checkPrecisionOnAdd(const mpf_t* a, const mpf_t* b){
-	if(Configuration::isIncreasePrecisionRecommended()) return;
-	if(Configuration::getCheckPrecisionProbability() <= 0)return;
-	bool doit = (Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS ||
-			(Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS
-			 && !statistical_calculations_active_));
-	if(!doit)return;
-	{
-		if(IsInfinite(a) || IsInfinite(b)) return;
-		if(IsUndefined(a) || IsUndefined(b)) return;
+// Returns a value with the supplied precision (in limbs) which can be used to store a result.
+// The supplied previous result is reused if its limb storage is large enough.
+inline mpf_t* getDestination(mpf_t* previous, mp_size_t precision) {
+	if(previous == NULL || IsInfinite(previous) || IsUndefined(previous)
+			|| getSlot(previous)->allocated_precision < precision) {
+		return getResultPointerWithPrecision(precision);
 	}
-	if(Configuration::getCheckPrecisionProbability() < 1){
-		double memCheckPrecisionProbability = Configuration::getCheckPrecisionProbability();
-		if(memCheckPrecisionProbability < 1.0){
-			Configuration::setCheckPrecisionProbability(0.0);
-		}
-		mpf_t* rand_value = GetRandomMpft();
-		Configuration::setCheckPrecisionProbability(memCheckPrecisionProbability);
-		doit = (mpftoperations::Compare(rand_value, Configuration::getCheckPrecisionProbability()) < 0);
-		mpftoperations::ReleaseValue(rand_value);
+	(*previous)->_mp_prec = precision;
+	return previous;
+}
+
+// Stores the value in the destination and releases the previously stored value if it is not reused.
+inline void setResult(mpf_t** result, mpf_t* value) {
+	if(*result != value) {
+		ReleaseValue(*result);
+		*result = value;
+	}
+}
+
+// mpf_t representation of a finite double value without heap allocation.
+class DoubleMpft {
+public:
+	explicit DoubleMpft(double value) {
+		value_[0]._mp_prec = kLimbs - 1;
+		value_[0]._mp_size = 0;
+		value_[0]._mp_exp = 0;
+		value_[0]._mp_d = limbs_;
+		mpf_set_d(value_, value);
+	}
+	const mpf_t* Get() const {
+		return &value_;
 	}
-	if(!doit)return;
+private:
+	DoubleMpft(const DoubleMpft&) = delete;
+	DoubleMpft& operator=(const DoubleMpft&) = delete;
+	static const int kLimbs = 4;
+	mpf_t value_;
+	mp_limb_t limbs_[kLimbs];
+};
 
+// Original precision check: The smallest absolute value of a, b and the result is scaled down
+// by the precision safety margin and added to the largest absolute value.
+// If subtract is true then the precision of the calculation a - b is checked instead of a + b.
+bool checkPrecisionByTrialAddition(const mpf_t* a, const mpf_t* b, bool subtract) {
+	bool recommended = false;
 	mpf_t* tmp = GetResultPointer();
-	mpf_add(*tmp, *a, *b);
+	if(subtract) mpf_sub(*tmp, *a, *b);
+	else mpf_add(*tmp, *a, *b);
 	std::vector<mpf_t*> v = {Abs(tmp), Abs(a), Abs(b)};
 	ReleaseValue(tmp);
 	std::sort(v.begin(), v.end(), [](mpf_t* a, mpf_t* b)
@@ -422,14 +925,14 @@ inline void checkPrecisionOnAdd(const mpf_t* a, const mpf_t* b){
 
 	if(mpf_cmp_d(*v[0], 0.0) == 0){
 		if(mpf_cmp(*v[1], *v[2]) != 0){
-			Configuration::RecommendIncreasePrecision();
+			recommended = true;
 		}
 	} else {
 		mpf_t* small = mpftoperations::Multiply2Exp(v[0], -Configuration::getPrecisionSafetyMargin());
 		mpf_t* addVal = GetResultPointer();
 		mpf_add(*addVal, *small, *v[2]);
 		if(mpf_cmp(*addVal, *v[2]) == 0){
-			Configuration::RecommendIncreasePrecision();
+			recommended = true;
 		}
 		ReleaseValue(small);
 		ReleaseValue(addVal);
@@ -437,6 +940,413 @@ inline void checkPrecisionOnAdd(const mpf_t* a, const mpf_t* b){
 	for(int i = 0; i < 3; i++){
 		ReleaseValue(v[i]);
 	}
+	return recommended;
+}
+
+// Sets view to the absolute value of v truncated to the given number of limbs as done by mpf_abs.
+// The view shares the limbs of v.
+inline void setTruncatedAbsoluteView(mpf_t view, const mpf_t* v, mp_size_t limbs) {
+	mp_size_t size = std::abs((*v)->_mp_size);
+	view->_mp_d = (*v)->_mp_d;
+	if(size > limbs) {
+		view->_mp_d += size - limbs;
+		size = limbs;
+	}
+	view->_mp_size = size;
+	view->_mp_exp = (*v)->_mp_exp;
+	view->_mp_prec = limbs - 1;
+}
+
+// Checks whether the view which keeps the given number of limbs has a nonzero limb beyond the
+// precision limbs (one limb less) which are used by mpf_add.
+inline bool hasDroppedLimb(const mpf_t view, mp_size_t kept_limbs) {
+	return view->_mp_size == kept_limbs && view->_mp_d[0] != 0;
+}
+
+// Returns e such that 2^(e-1) <= |v| < 2^e for a nonzero value v.
+inline long getBitExponent(const mpf_t v) {
+	mp_limb_t top = v->_mp_d[std::abs(v->_mp_size) - 1];
+	long bits = 0;
+	while(top != 0) {
+		top >>= 1;
+		++bits;
+	}
+	return (long)(v->_mp_exp - 1) * GMP_NUMB_BITS + bits;
+}
+
+// Exponent based precision check: Derives the decision of the trial addition from the
+// limb exponents of the largest absolute value and the scaled down smallest absolute value.
+// The trial addition yields the largest value unchanged if and only if the scaled down value
+// lies completely below the precision limbs of the largest value which are used by mpf_add
+// and the largest value has no nonzero limb beyond these precision limbs.
+// The sum is the already calculated result of a + b (or a - b). It is only recalculated if it
+// is not given or if its precision differs from the precision which is used by the trial addition.
+bool checkPrecisionByExponent(const mpf_t* a, const mpf_t* b, bool subtract, const mpf_t* sum) {
+	OperationsState& current_state = state();
+	mp_size_t precision = getDefaultPrecisionLimbs(current_state);
+	if(sum == NULL || (*sum)->_mp_prec != precision) {
+		if(current_state.exponent_check_sum_allocated_precision < precision) {
+			if(current_state.exponent_check_sum_allocated_precision > 0) {
+				current_state.exponent_check_sum->_mp_prec = current_state.exponent_check_sum_allocated_precision;
+				mpf_clear(current_state.exponent_check_sum);
+			}
+			mpf_init2(current_state.exponent_check_sum, (precision - 1) * GMP_NUMB_BITS);
+			current_state.exponent_check_sum_allocated_precision = precision;
+		}
+		current_state.exponent_check_sum->_mp_prec = precision;
+		if(subtract) mpf_sub(current_state.exponent_check_sum, *a, *b);
+		else mpf_add(current_state.exponent_check_sum, *a, *b);
+		sum = &current_state.exponent_check_sum;
+	}
+
+	const mpf_t* values[3] = {sum, a, b};
+	for(int i = 0; i < 3; i++) {
+		if((*values[i])->_mp_size == 0) {
+			// either one or all of the values are zero, the increase is recommended if the
+			// absolute values of the other values differ within the limbs kept by mpf_abs
+			mp_size_t kept_limbs = precision + 1;
+			mpf_t views[2];
+			setTruncatedAbsoluteView(views[0], values[(i + 1) % 3], kept_limbs);
+			setTruncatedAbsoluteView(views[1], values[(i + 2) % 3], kept_limbs);
+			return mpf_cmp(views[0], views[1]) != 0;
+		}
+	}
+	// the smallest absolute value has the smallest bit exponent and the largest absolute value
+	// has the largest limb exponent, the truncation by mpf_abs does not change them
+	long small_bit_exponent = std::min(getBitExponent(*sum), std::min(getBitExponent(*a), getBitExponent(*b)))
+			- Configuration::getPrecisionSafetyMargin();
+	long large_limb_exponent = std::max((*sum)->_mp_exp, std::max((*a)->_mp_exp, (*b)->_mp_exp));
+	long numerator = small_bit_exponent - 1;
+	long small_limb_exponent = (numerator >= 0 ? numerator / GMP_NUMB_BITS : -((-numerator + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS)) + 1;
+	if(large_limb_exponent - small_limb_exponent < (long)precision) return false;
+	// the scaled down value is dropped, mpf_add also drops the limb of the largest value beyond
+	// the precision limbs, hence the largest value stays unchanged if and only if this limb is zero
+	mp_size_t kept_limbs = precision + 1;
+	mpf_t largest;
+	mpf_t candidate;
+	bool found = false;
+	for(int i = 0; i < 3; i++) {
+		if((*values[i])->_mp_exp != large_limb_exponent) continue;
+		setTruncatedAbsoluteView(candidate, values[i], kept_limbs);
+		// values with equal limb exponents only need to be ordered if their dropped limbs differ
+		if(!found || (hasDroppedLimb(candidate, kept_limbs) != hasDroppedLimb(largest, kept_limbs)
+				&& mpf_cmp(candidate, largest) > 0)) {
+			setTruncatedAbsoluteView(largest, values[i], kept_limbs);
+			found = true;
+		}
+	}
+	return !hasDroppedLimb(largest, kept_limbs);
+}
+
+// If subtract is true then the precision of the calculation a - b is checked instead of a + b.
+// Checks whether precision checks are executed for additions of finite values (apart from sampling).
+inline bool precisionChecksOnAddActive(){
+	if(Configuration::isIncreasePrecisionRecommended()) return false;
+	if(state().drawing_precision_check_sample) return false;
+	if(Configuration::getCheckPrecisionProbability() <= 0)return false;
+	return (Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS ||
+			(Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS
+			 && !state().statistical_calculations_active));
+}
+
+// Decides whether the precision of the addition of a and b is checked. The random value of the sampling is drawn here.
+inline bool precisionCheckOnAddDue(const mpf_t* a, const mpf_t* b){
+	bool doit = precisionChecksOnAddActive();
+	if(!doit)return false;
+	{
+		if(IsInfinite(a) || IsInfinite(b)) return false;
+		if(IsUndefined(a) || IsUndefined(b)) return false;
+	}
+	CheckPrecisionSampler* sampler = Configuration::getCheckPrecisionSampler();
+	if(Configuration::getCheckPrecisionProbability() < 1 && sampler != NULL){
+		doit = sampler->ShouldCheck(Configuration::getCheckPrecisionProbability());
+	} else if(Configuration::getCheckPrecisionProbability() < 1){
+		// the flag belongs to the current context, hence other threads are not affected
+		OperationsState& current_state = state();
+		current_state.drawing_precision_check_sample = true;
+		mpf_t* rand_value = GetRandomMpft();
+		current_state.drawing_precision_check_sample = false;
+		doit = (mpftoperations::Compare(rand_value, Configuration::getCheckPrecisionProbability()) < 0);
+		mpftoperations::ReleaseValue(rand_value);
+	}
+	return doit;
+}
+
+// Checks the precision of the addition of a and b (or a - b if subtract is true), which has to be due (see precisionCheckOnAddDue).
+// The sum is the already calculated result or NULL if it is not available.
+inline void checkPrecisionOfSum(const mpf_t* a, const mpf_t* b, bool subtract, const mpf_t* sum){
+	bool recommended = false;
+	switch(Configuration::getCheckPrecisionAlgorithm()) {
+		case configuration::CHECK_PRECISION_ALGORITHM_EXPONENT:
+			recommended = checkPrecisionByExponent(a, b, subtract, sum);
+			break;
+		case configuration::CHECK_PRECISION_ALGORITHM_REGRESSION:
+			recommended = checkPrecisionByTrialAddition(a, b, subtract);
+			if(recommended != checkPrecisionByExponent(a, b, subtract, sum)) {
+				++state().number_of_precision_check_disagreements;
+				std::cerr << "Precision checks disagree on " << MpftToString(a) << (subtract ? " - " : " + ") << MpftToString(b)
+					<< ": trial addition " << (recommended ? "recommends" : "does not recommend")
+					<< " an increase of the precision." << std::endl;
+			}
+			break;
+		default:
+			recommended = checkPrecisionByTrialAddition(a, b, subtract);
+			break;
+	}
+	CheckPrecisionSampler* sampler = Configuration::getCheckPrecisionSampler();
+	if(sampler != NULL){
+		sampler->ReportCheckResult(recommended);
+	}
+	if(recommended){
+		Configuration::RecommendIncreasePrecision();
+	}
+}
+
+// Checks the precision of the addition of a and b (or a - b if subtract is true) before the result is calculated.
+inline void checkPrecisionOnAdd(const mpf_t* a, const mpf_t* b, bool subtract = false){
+	if(precisionCheckOnAddDue(a, b)) checkPrecisionOfSum(a, b, subtract, NULL);
+}
+
+int GetNumberOfPrecisionCheckDisagreements() {
+	return state().number_of_precision_check_disagreements;
+}
+
+bool CheckPrecisionOnAddRecommendsIncrease(const mpf_t* a, const mpf_t* b, configuration::CheckPrecisionAlgorithm algorithm) {
+	if(IsInfinite(a) || IsInfinite(b) || IsUndefined(a) || IsUndefined(b)) return false;
+	if(algorithm == configuration::CHECK_PRECISION_ALGORITHM_EXPONENT) return checkPrecisionByExponent(a, b, false, NULL);
+	return checkPrecisionByTrialAddition(a, b, false);
+}
+
+// Ball arithmetic: Each value carries a radius exponent r such that the distance to the exact value is at most 2^r.
+// The radius of a result is computed from the operands before the result is stored, as the result may replace an operand.
+
+inline bool ballArithmeticActive() {
+	return Configuration::getCheckPrecisionMode() == configuration::CHECK_PRECISION_BALL;
+}
+
+inline long radiusOf(const mpf_t* v) {
+	return getSlot(const_cast<mpf_t*>(v))->radius_exponent;
+}
+
+// Returns e such that |v| < 2^e or BALL_RADIUS_EXACT if v is zero, such that products with zero vanish.
+inline long magnitudeOf(const mpf_t* v) {
+	mp_size_t size = std::abs((*v)->_mp_size);
+	if(size == 0) return BALL_RADIUS_EXACT;
+	mp_limb_t top = (*v)->_mp_d[size - 1];
+	long bits = 0;
+	while(top != 0) {
+		top >>= 1;
+		++bits;
+	}
+	return (long)((*v)->_mp_exp - 1) * GMP_NUMB_BITS + bits;
+}
+
+// Returns the limb with index k (counted from the most significant limb) of the mantissa of the nonzero value v
+// after the mantissa has been shifted such that its highest bit is set.
+inline mp_limb_t normalizedLimb(const mpf_t* v, mp_size_t k) {
+	mp_size_t size = std::abs((*v)->_mp_size);
+	const mp_limb_t* limbs = (*v)->_mp_d;
+	int shift = GMP_NUMB_BITS - (int)(magnitudeOf(v) - ((long)(*v)->_mp_exp - 1) * GMP_NUMB_BITS);
+	mp_limb_t high = (k < size) ? limbs[size - 1 - k] : 0;
+	if(shift == 0) return high;
+	mp_limb_t low = (k + 1 < size) ? limbs[size - 2 - k] : 0;
+	return (high << shift) | (low >> (GMP_NUMB_BITS - shift));
+}
+
+// Compares the normalized mantissas of the nonzero values a and b, i.e. |a| and |b| scaled to [1/2, 1).
+inline int compareMantissas(const mpf_t* a, const mpf_t* b) {
+	mp_size_t size = std::max(std::abs((*a)->_mp_size), std::abs((*b)->_mp_size));
+	for(mp_size_t k = 0; k < size; k++) {
+		mp_limb_t limb_a = normalizedLimb(a, k);
+		mp_limb_t limb_b = normalizedLimb(b, k);
+		if(limb_a != limb_b) return (limb_a < limb_b) ? -1 : 1;
+	}
+	return 0;
+}
+
+// Returns true if b lies strictly between a / 2 and 2 a. The exponents and mantissas
+// of the finite values are inspected directly, hence no temporary values are needed.
+inline bool isBetweenHalfAndDouble(const mpf_t* a, const mpf_t* b) {
+	int sign = mpf_sgn(*a);
+	if(sign == 0 || sign != mpf_sgn(*b)) return false;
+	long exponent_difference = magnitudeOf(b) - magnitudeOf(a);
+	if(exponent_difference == 0) return true;
+	if(exponent_difference == 1) return compareMantissas(b, a) < 0; // |b| < 2 |a|
+	if(exponent_difference == -1) return compareMantissas(b, a) > 0; // |b| > |a| / 2
+	return false;
+}
+
+inline bool isRadiusBound(long r) {
+	return r != BALL_RADIUS_EXACT && r != BALL_RADIUS_UNBOUNDED;
+}
+
+// 2^result >= 2^a + 2^b
+inline long addRadii(long a, long b) {
+	if(a == BALL_RADIUS_EXACT) return b;
+	if(b == BALL_RADIUS_EXACT) return a;
+	if(a == BALL_RADIUS_UNBOUNDED || b == BALL_RADIUS_UNBOUNDED) return BALL_RADIUS_UNBOUNDED;
+	return std::max(a, b) + 1;
+}
+
+// 2^result >= 2^a * 2^b
+inline long multiplyRadii(long a, long b) {
+	if(a == BALL_RADIUS_EXACT || b == BALL_RADIUS_EXACT) return BALL_RADIUS_EXACT;
+	if(a == BALL_RADIUS_UNBOUNDED || b == BALL_RADIUS_UNBOUNDED) return BALL_RADIUS_UNBOUNDED;
+	return a + b;
+}
+
+// 2^result >= 2^r * 2^shift
+inline long shiftRadius(long r, long shift) {
+	return isRadiusBound(r) ? r + shift : r;
+}
+
+inline long radiusOfSum(const mpf_t* a, const mpf_t* b) {
+	return addRadii(radiusOf(a), radiusOf(b));
+}
+
+// |(a + da)(b + db) - ab| <= |a| |db| + |b| |da| + |da| |db|
+inline long radiusOfProduct(const mpf_t* a, const mpf_t* b) {
+	long a_radius = radiusOf(a);
+	long b_radius = radiusOf(b);
+	return addRadii(addRadii(multiplyRadii(magnitudeOf(a), b_radius), multiplyRadii(magnitudeOf(b), a_radius)),
+			multiplyRadii(a_radius, b_radius));
+}
+
+// |(a + da) / (b + db) - a / b| <= (|da| + |a / b| |db|) / (|b| / 2) as long as |db| <= |b| / 2
+inline long radiusOfQuotient(const mpf_t* a, const mpf_t* b) {
+	long a_radius = radiusOf(a);
+	long b_radius = radiusOf(b);
+	long b_magnitude = magnitudeOf(b);
+	if(b_radius == BALL_RADIUS_UNBOUNDED || (b_radius != BALL_RADIUS_EXACT && b_radius > b_magnitude - 2)) return BALL_RADIUS_UNBOUNDED;
+	long quotient_magnitude = shiftRadius(magnitudeOf(a), 1 - b_magnitude);
+	return shiftRadius(addRadii(a_radius, multiplyRadii(quotient_magnitude, b_radius)), 2 - b_magnitude);
+}
+
+// |sqrt(v + dv) - sqrt(v)| <= |dv| / sqrt(v) and <= sqrt(|dv|)
+inline long radiusOfSquareRoot(const mpf_t* v) {
+	long radius = radiusOf(v);
+	if(!isRadiusBound(radius)) return radius;
+	long magnitude = magnitudeOf(v);
+	if(magnitude == BALL_RADIUS_EXACT || radius > magnitude - 2) {
+		return radius >= 0 ? (radius + 1) / 2 : -((-radius) / 2);
+	}
+	long root_magnitude = magnitude >= 1 ? (magnitude - 1) / 2 : -((2 - magnitude) / 2);
+	return radius - root_magnitude;
+}
+
+// |floor(v + dv) - floor(v)| <= |dv| + 1 and the same holds for ceil
+inline long radiusOfRounding(const mpf_t* v) {
+	long radius = radiusOf(v);
+	return radius == BALL_RADIUS_EXACT ? radius : addRadii(radius, 0);
+}
+
+// Stores the radius of a finite result. The rounding error of the operation is added to the propagated radius.
+// Results of elementary functions pass a larger error in units in the last place.
+inline void setRadius(mpf_t* result, long propagated_radius, int error_bits = 1) {
+	long magnitude = magnitudeOf(result);
+	long rounding = (magnitude == BALL_RADIUS_EXACT) ? BALL_RADIUS_EXACT : magnitude - (long)mpf_get_prec(*result) + error_bits;
+	getSlot(result)->radius_exponent = addRadii(propagated_radius, rounding);
+}
+
+// Stores the radius of a result unless it is infinite or undefined.
+inline void setRadiusOfValue(mpf_t* result, long propagated_radius, int error_bits = 1) {
+	if(IsInfinite(result) || IsUndefined(result)) return;
+	setRadius(result, propagated_radius, error_bits);
+}
+
+inline long bitLengthOf(unsigned long v) {
+	long bits = 0;
+	while(v != 0) {
+		v >>= 1;
+		++bits;
+	}
+	return bits;
+}
+
+// Returns the smallest integer which is at least n / 2.
+inline long halfRoundedUp(long n) {
+	return n >= 0 ? (n + 1) / 2 : -((-n) / 2);
+}
+
+// Elementary functions are computed by series whose truncation adds some units in the last place.
+const int ELEMENTARY_FUNCTION_ERROR_BITS = 4;
+
+// |exp(v + dv) - exp(v)| <= exp(v) (exp(|dv|) - 1) <= 2 exp(v) |dv| as long as |dv| <= 1
+inline long radiusOfExp(const mpf_t* result, const mpf_t* v) {
+	long radius = radiusOf(v);
+	if(!isRadiusBound(radius)) return radius;
+	if(radius > 0) return BALL_RADIUS_UNBOUNDED;
+	return shiftRadius(multiplyRadii(magnitudeOf(result), radius), 1);
+}
+
+// |log(v + dv) - log(v)| <= |dv| / (|v| - |dv|) <= 2 |dv| / |v| as long as |dv| <= |v| / 2
+inline long radiusOfLogE(const mpf_t* v) {
+	long radius = radiusOf(v);
+	if(!isRadiusBound(radius)) return radius;
+	long magnitude = magnitudeOf(v);
+	if(magnitude == BALL_RADIUS_EXACT || radius > magnitude - 2) return BALL_RADIUS_UNBOUNDED;
+	return radius - (magnitude - 2);
+}
+
+// |arcsin(v + dv) - arcsin(v)| <= |dv| / sqrt(1 - |v| - |dv|) <= |dv| sqrt(2 / (1 - |v|)) as long as |dv| <= (1 - |v|) / 2
+// The same holds for arccos.
+inline long radiusOfArcsine(const mpf_t* v) {
+	long radius = radiusOf(v);
+	if(!isRadiusBound(radius)) return radius;
+	mpf_t* distance = GetResultPointer();
+	mpf_abs(*distance, *v);
+	mpf_ui_sub(*distance, 1, *distance);
+	long magnitude = mpf_sgn(*distance) > 0 ? magnitudeOf(distance) : BALL_RADIUS_EXACT;
+	ReleaseValue(distance);
+	if(magnitude == BALL_RADIUS_EXACT || radius > magnitude - 2) return BALL_RADIUS_UNBOUNDED;
+	return radius + halfRoundedUp(2 - magnitude);
+}
+
+// |(v + dv)^p - v^p| <= |p| |dv| max |v + dv|^(p - 1) <= 2 |p| |dv| |v^p / v| as long as (|p| + 1) |dv| <= |v| / 2
+inline long radiusOfIntegerPower(const mpf_t* result, const mpf_t* v, int p) {
+	long radius = radiusOf(v);
+	if(!isRadiusBound(radius) || p == 0) return p == 0 ? BALL_RADIUS_EXACT : radius;
+	long magnitude = magnitudeOf(v);
+	unsigned long exponent = p < 0 ? 0ul - (unsigned long)p : (unsigned long)p;
+	if(magnitude == BALL_RADIUS_EXACT || radius + bitLengthOf(exponent + 1) > magnitude - 2) return BALL_RADIUS_UNBOUNDED;
+	return radius + bitLengthOf(exponent) + magnitudeOf(result) - magnitude + 2;
+}
+
+// v^p = exp(p log|v|), hence the argument of exp changes by at most s <= 2 (|p| + |dp|) |dv| / |v| + |log(v + dv)| |dp|
+// as long as |dv| <= |v| / 2 and |v^p| changes by at most 2 |v^p| s as long as s <= 1 / 2.
+inline long radiusOfPower(const mpf_t* result, const mpf_t* v, const mpf_t* p) {
+	long v_radius = radiusOf(v);
+	long p_radius = radiusOf(p);
+	if(v_radius == BALL_RADIUS_EXACT && p_radius == BALL_RADIUS_EXACT) return BALL_RADIUS_EXACT;
+	if(v_radius == BALL_RADIUS_UNBOUNDED || p_radius == BALL_RADIUS_UNBOUNDED) return BALL_RADIUS_UNBOUNDED;
+	long v_magnitude = magnitudeOf(v);
+	if(v_magnitude == BALL_RADIUS_EXACT || (v_radius != BALL_RADIUS_EXACT && v_radius > v_magnitude - 2)) return BALL_RADIUS_UNBOUNDED;
+	// |log(v + dv)| <= (|e_v| + 1) log(2) + log(2) with e_v the magnitude of v
+	long log_magnitude = bitLengthOf((unsigned long)std::labs(v_magnitude) + 2);
+	long exponent_magnitude = addRadii(magnitudeOf(p), p_radius);
+	long argument_radius = addRadii(shiftRadius(multiplyRadii(exponent_magnitude, v_radius), 2 - v_magnitude),
+			multiplyRadii(log_magnitude, p_radius));
+	if(!isRadiusBound(argument_radius)) return argument_radius;
+	if(argument_radius > -1) return BALL_RADIUS_UNBOUNDED;
+	return shiftRadius(multiplyRadii(magnitudeOf(result), argument_radius), 1);
+}
+
+long GetBallRadiusExponent(const mpf_t* value) {
+	if(IsInfinite(value) || IsUndefined(value)) return BALL_RADIUS_UNBOUNDED;
+	return radiusOf(value);
+}
+
+void SetBallRadiusExponent(mpf_t* value, long radius_exponent) {
+	AssertCondition(!IsInfinite(value) && !IsUndefined(value), "Only finite values have an error radius.");
+	getSlot(value)->radius_exponent = radius_exponent;
+}
+
+const std::map<std::string, long long> & GetUndecidableComparisons() {
+	return state().undecidable_comparisons;
+}
+
+void ResetUndecidableComparisons() {
+	state().undecidable_comparisons.clear();
 }
 
 mpf_t* Add(const mpf_t* a, const mpf_t* b) {
@@ -454,9 +1364,11 @@ mpf_t* Add(const mpf_t* a, const mpf_t* b) {
 			return GetUndefined();
 		}
 	}
-	checkPrecisionOnAdd(a, b);
-	mpf_t* res = GetResultPointer();
+	bool check = precisionCheckOnAddDue(a, b);
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(a, b));
 	mpf_add(*res, *a, *b);
+	if(check) checkPrecisionOfSum(a, b, false, res);
+	if(ballArithmeticActive()) setRadius(res, radiusOfSum(a, b));
 	return res;
 }
 
@@ -476,14 +1388,15 @@ mpf_t* Multiply2Exp(const mpf_t* a, int p){
 	}
 	mpf_t* res = NULL;
 	if(p < 0){
-		res = GetResultPointer();
+		res = getResultPointerWithPrecision(resultPrecision(a));
 		mpf_div_2exp(*res, *a, -p);
 	} else if(p > 0){
-		res = GetResultPointer();
+		res = getResultPointerWithPrecision(resultPrecision(a));
 		mpf_mul_2exp(*res, *a,  p);
 	} else {
 		res = Clone(a);
 	}
+	if(ballArithmeticActive() && p != 0) setRadius(res, shiftRadius(radiusOf(a), p));
 	return res;
 }
 
@@ -500,24 +1413,26 @@ mpf_t* Multiply(const mpf_t* a, const mpf_t* b) {
 				return GetPlusInfinity();
 			}
 		}
-		if(Compare(b, 0.0) == 0){
+		if(IsZero(b)){
 			return GetUndefined();
 		}
-		if(IsPlusInfinity(a) ^ (Compare(b, 0.0) > 0)){
+		if(IsPlusInfinity(a) ^ (Sign(b) > 0)){
 			return GetMinusInfinity();
 		} else {
 			return GetPlusInfinity();
 		}
 	}
-	mpf_t* res = GetResultPointer();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(a, b));
 	mpf_mul(*res, *a, *b);
+	if(ballArithmeticActive()) setRadius(res, radiusOfProduct(a, b));
 	return res;
 }
 
 mpf_t* Multiply(const mpf_t* a, const double b) {
-	mpf_t* res = GetResultPointer();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(a));
 	mpf_t* mpf_t_b = ToMpft(b);
 	mpf_mul(*res, *a, *mpf_t_b);
+	if(ballArithmeticActive()) setRadius(res, radiusOfProduct(a, mpf_t_b));
 	ReleaseValue(mpf_t_b);
 	return res;
 }
@@ -533,28 +1448,30 @@ mpf_t* Divide(const mpf_t* a, const mpf_t* b) {
 		if(IsInfinite(b)){
 			return ToMpft(0.0);
 		}
-		if(Compare(b, 0.0) == 0){
+		if(IsZero(b)){
 			return GetUndefined();
 		}
-		if(IsPlusInfinity(a) ^ (Compare(b, 0.0) > 0)){
+		if(IsPlusInfinity(a) ^ (Sign(b) > 0)){
 			return GetMinusInfinity();
 		} else {
 			return GetPlusInfinity();
 		}
 	}
-	if(Compare(b, 0.0) == 0){
+	if(IsZero(b)){
 		return GetUndefined();
 	}
-	mpf_t* res = GetResultPointer();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(a, b));
 	mpf_div(*res, *a, *b);
+	if(ballArithmeticActive()) setRadius(res, radiusOfQuotient(a, b));
 	return res;
 }
 
 mpf_t* Abs(const mpf_t* v) {
 	if(IsUndefined(v))return GetUndefined();
 	if(IsInfinite(v))return GetPlusInfinity();
-	mpf_t* res = GetResultPointer();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(v));
 	mpf_abs(*res, *v);
+	getSlot(res)->radius_exponent = radiusOf(v);
 	return res;
 }
 
@@ -564,11 +1481,30 @@ mpf_t* Negate(const mpf_t* v) {
 		if(IsPlusInfinity(v))return GetMinusInfinity();
 		else return GetPlusInfinity();
 	}
-	mpf_t* res = GetResultPointer();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(v));
 	mpf_neg(*res, *v);
+	getSlot(res)->radius_exponent = radiusOf(v);
 	return res;
 }
 
+// Copies the finite value v into res such that res is an exact clone of v.
+inline void copyValue(mpf_t* res, const mpf_t* v) {
+	mpf_set(*res, *v);
+	AssertConditionAtLevel(ASSERTION_LEVEL_CHEAP, (*res)->_mp_prec >= (*v)->_mp_prec, "Cloning of mpf_t failed.");
+	(*res)->_mp_prec = (*v)->_mp_prec;
+
+	// check actual equality
+	if(IsAssertionLevelActive(ASSERTION_LEVEL_PARANOID)) {
+		AssertCondition((*v)->_mp_size == (*res)->_mp_size, "Cloning of mpf_t failed.");
+		AssertCondition((*v)->_mp_prec == (*res)->_mp_prec, "Cloning of mpf_t failed.");
+		AssertCondition((*v)->_mp_exp == (*res)->_mp_exp, "Cloning of mpf_t failed.");
+		for(int i = 0; i < std::abs((*v)->_mp_size); i++){
+			AssertCondition((*v)->_mp_d[i] == (*res)->_mp_d[i], "Cloning of mpf_t failed.");
+		}
+	}
+	getSlot(res)->radius_exponent = getSlot(const_cast<mpf_t*>(v))->radius_exponent;
+}
+
 mpf_t* Clone(const mpf_t* v) {
 	if(IsPlusInfinity(v)){
 		return GetPlusInfinity();
@@ -579,24 +1515,21 @@ mpf_t* Clone(const mpf_t* v) {
 	if(IsUndefined(v)){
 		return GetUndefined();
 	}
-	mpf_t* res = GetResultPointer();
-	mpf_set(*res, *v);
-	AssertCondition((*res)->_mp_prec >= (*v)->_mp_prec, "Cloning of mpf_t failed.");
-	(*res)->_mp_prec = (*v)->_mp_prec;
-
-	// check actual equality
-	AssertCondition((*v)->_mp_size == (*res)->_mp_size, "Cloning of mpf_t failed.");
-	AssertCondition((*v)->_mp_prec == (*res)->_mp_prec, "Cloning of mpf_t failed.");
-	AssertCondition((*v)->_mp_exp == (*res)->_mp_exp, "Cloning of mpf_t failed.");
-	for(int i = 0; i < std::abs((*v)->_mp_size); i++){
-		AssertCondition((*v)->_mp_d[i] == (*res)->_mp_d[i], "Cloning of mpf_t failed.");
-	}
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(v));
+	copyValue(res, v);
 	return res;
 }
 
 // the generation of gaussian noise (random variable with normal
 // distribution) is done by minor variation of Box Muller method.
 mpf_t* GetGaussianRandomMpft(double mu, double sigma, RandomNumberGenerator* random){
+	if(Configuration::getGaussianAlgorithm() == configuration::GAUSSIAN_ALGORITHM_POLAR) {
+		mpf_t* first = NULL;
+		mpf_t* second = NULL;
+		GaussianRandomPairTo(&first, &second, mu, sigma, random);
+		ReleaseValue(second);
+		return first;
+	}
 	mpf_t* u = NULL;
 	mpf_t* x = NULL;
 	mpf_t* y = NULL;
@@ -605,7 +1538,7 @@ mpf_t* GetGaussianRandomMpft(double mu, double sigma, RandomNumberGenerator* ran
 	do {
 		ReleaseValue(u);
 		u = GetRandomMpft(random);
-	} while( Compare(u, 0.0) <= 0 );
+	} while( Sign(u) <= 0 );
 	do {
 		ReleaseValue(x);
 		ReleaseValue(y);
@@ -628,7 +1561,7 @@ mpf_t* GetGaussianRandomMpft(double mu, double sigma, RandomNumberGenerator* ran
 		len2_xy = mpftoperations::Add(tmp1, tmp2); // len2_xy = x * x + y * y
 		ReleaseValue(tmp1);
 		ReleaseValue(tmp2);
-	} while( Compare(len2_xy, 0.0) == 0  || Compare(len2_xy, 1.0) > 0 );
+	} while( IsZero(len2_xy) || CompareD(len2_xy, 1.0) > 0 );
 	mpf_t* len_xy = Sqrt(len2_xy);
 	mpf_t* len_inverse = Divide(one, len_xy); // = 1 / sqrt(x * x + y * y)
 	mpf_t* tmp = Multiply(len_inverse, x);
@@ -670,6 +1603,39 @@ mpf_t* GetGaussianRandomMpft(double mu, double sigma){
 	return GetGaussianRandomMpft(mu, sigma, Configuration::getStandardRandomNumberGenerator());
 }
 
+// polar method of Marsaglia: a point (x,y) which is uniformly distributed
+// in the unit disc is scaled by sqrt(-2 log(s) / s) with s = x * x + y * y.
+// The coordinates of the result are independent standard normal values.
+void GaussianRandomPairTo(mpf_t** first, mpf_t** second, double mu, double sigma, RandomNumberGenerator* random){
+	mpf_t* one = ToMpft(1.0);
+	mpf_t* square = NULL;
+	mpf_t* len2_xy = NULL;
+	do {
+		random->RandomMpftTo(first);
+		Multiply2ExpTo(first, *first, 1);
+		SubtractTo(first, *first, one); // x = rand(0.0, 1.0) * 2.0 - 1.0
+		random->RandomMpftTo(second);
+		Multiply2ExpTo(second, *second, 1);
+		SubtractTo(second, *second, one); // y = rand(0.0, 1.0) * 2.0 - 1.0
+		MultiplyTo(&square, *first, *first);
+		MultiplyTo(&len2_xy, *second, *second);
+		AddTo(&len2_xy, len2_xy, square); // len2_xy = x * x + y * y
+	} while( IsZero(len2_xy) || CompareD(len2_xy, 1.0) >= 0 );
+	mpf_t* scale = LogE(len2_xy);
+	MultiplyTo(&scale, scale, -2.0 * sigma * sigma);
+	DivideTo(&scale, scale, len2_xy);
+	SqrtTo(&scale, scale); // = sigma * sqrt(-2 log(len2_xy) / len2_xy)
+	SetTo(&square, mu);
+	MultiplyTo(first, *first, scale);
+	AddTo(first, *first, square);
+	MultiplyTo(second, *second, scale);
+	AddTo(second, *second, square);
+	ReleaseValue(one);
+	ReleaseValue(square);
+	ReleaseValue(len2_xy);
+	ReleaseValue(scale);
+}
+
 mpf_t* Randomize(mpf_t* v) {
 	return Randomize(v, Configuration::getStandardRandomNumberGenerator());
 }
@@ -689,6 +1655,52 @@ mpf_t* GetRandomMpft(RandomNumberGenerator* random){
 	return random->RandomMpft();
 }
 
+bool PrecisionChecksOnAdditionsActive() {
+	return precisionChecksOnAddActive();
+}
+
+void SetFractionBitsTo(mpf_t** result, const unsigned long long* words, int number_of_words, int bits_per_word) {
+	AssertCondition(bits_per_word >= 1 && bits_per_word <= 64 && number_of_words >= 0, "Invalid number of random bits.");
+	mp_size_t limbs = ((mp_size_t)number_of_words * bits_per_word + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+	mpf_t* res = getDestination(*result, std::max(getDefaultPrecisionLimbs(), limbs));
+	mp_limb_t* d = (*res)->_mp_d;
+	// the bits are written from the most significant limb downwards
+	mp_size_t next_limb = limbs - 1;
+	mp_limb_t current = 0;
+	int free_bits = GMP_NUMB_BITS;
+	for (int i = 0; i < number_of_words; i++) {
+		int remaining_bits = bits_per_word;
+		while (remaining_bits > 0) {
+			int taken_bits = std::min(remaining_bits, free_bits);
+			unsigned long long chunk = words[i] >> (remaining_bits - taken_bits);
+			if (taken_bits < 64) chunk &= (1ULL << taken_bits) - 1;
+			current |= (mp_limb_t)chunk << (free_bits - taken_bits);
+			free_bits -= taken_bits;
+			remaining_bits -= taken_bits;
+			if (free_bits == 0) {
+				d[next_limb--] = current;
+				current = 0;
+				free_bits = GMP_NUMB_BITS;
+			}
+		}
+	}
+	if (free_bits < GMP_NUMB_BITS) {
+		d[next_limb--] = current;
+	}
+	// normalization: leading zero limbs reduce the exponent and trailing zero limbs are dropped
+	mp_size_t high = limbs;
+	while (high > 0 && d[high - 1] == 0) --high;
+	mp_size_t low = 0;
+	while (low < high && d[low] == 0) ++low;
+	if (low > 0) {
+		for (mp_size_t i = low; i < high; i++) d[i - low] = d[i];
+	}
+	(*res)->_mp_size = (int)(high - low);
+	(*res)->_mp_exp = (high > low) ? -(mp_exp_t)(limbs - high) : 0;
+	getSlot(res)->radius_exponent = BALL_RADIUS_EXACT;
+	setResult(result, res);
+}
+
 double MpftToDouble(mpf_t* v) {
 	if(IsUndefined(v))return NAN;
 	if(IsInfinite(v)){
@@ -725,7 +1737,7 @@ mpf_t* Pow(mpf_t* v, double p){
 	return res;
 }
 
-mpf_t* Pow(mpf_t* v, int p) {
+mpf_t* computePow(mpf_t* v, int p) {
 	if(IsUndefined(v)){
 		return GetUndefined();
 	}
@@ -750,24 +1762,39 @@ mpf_t* Pow(mpf_t* v, int p) {
 		return res;
 	}
 	// not using mpf_pow_ui because it produces different output on different versions!!
-    if(p == 0) {
-        return ToMpft(1);
-    }
-    if(p == 1) {
-        return Clone(v);
-    }
-    mpf_t* square_v = Multiply(v, v);
-    mpf_t* res = Pow(square_v, p / 2);
-    ReleaseValue(square_v);
-    if(p % 2 == 1){
-        mpf_t* tmp = Multiply(res, v);
-        std::swap(tmp, res);
-        ReleaseValue(tmp);
-    }
+	if(p == 0) {
+		return ToMpft(1);
+	}
+	// v^p = s_K * s_k1 * s_k2 * ... with s_k = v^(2^k) and K > k1 > k2 > ...
+	// The factors are multiplied in this order such that the results of the former recursive implementation are reproduced.
+	if(p == 1) {
+		return Clone(v);
+	}
+	// the square is updated in place, only the squares which are factors are kept
+	mpf_t* factors[sizeof(int) * CHAR_BIT];
+	int number_of_factors = 0;
+	if(p & 1) factors[number_of_factors++] = v;
+	mpf_t* square = Multiply(v, v);
+	for(int bit = 1; (p >> (bit + 1)) > 0; bit++) {
+		if((p >> bit) & 1) factors[number_of_factors++] = Clone(square);
+		MultiplyTo(&square, square, square);
+	}
+	mpf_t* res = square;
+	for(int i = number_of_factors - 1; i >= 0; i--) {
+		MultiplyTo(&res, res, factors[i]);
+		// the argument itself is not released
+		if(factors[i] != v) ReleaseValue(factors[i]);
+	}
 	return res;
 }
 
-mpf_t* Pow(mpf_t* v, mpf_t* p) {
+mpf_t* Pow(mpf_t* v, int p) {
+	mpf_t* res = computePow(v, p);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOfIntegerPower(res, v, p), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+mpf_t* computePow(mpf_t* v, mpf_t* p) {
 	if(IsUndefined(v) || IsUndefined(p)){
 		return GetUndefined();
 	}
@@ -775,9 +1802,9 @@ mpf_t* Pow(mpf_t* v, mpf_t* p) {
 		return GetUndefined();
 	}
 	if(IsInfinite(v)){
-		if(Compare(p,0.0) < 0){
+		if(Sign(p) < 0){
 			return ToMpft(0.0);
-		} else if(Compare(p, 0.0) == 0){
+		} else if(IsZero(p)){
 			return ToMpft(1.0);
 		} else if(IsPlusInfinity(v)){
 			return GetPlusInfinity();
@@ -785,16 +1812,23 @@ mpf_t* Pow(mpf_t* v, mpf_t* p) {
 			return GetUndefined();
 		}
 	}
-	if(Compare(p, 0.0) == 0) {
+	if(IsZero(p)) {
 		return ToMpft(1.0);
 	}
-	if(Compare(v, 0.0) == 0) {
+	if(IsZero(v)) {
 		return ToMpft(0.0);
 	}
-	if(Compare(v, 1.0) == 0) {
+	if(CompareD(v, 1.0) == 0) {
 		return ToMpft(1.0);
 	}
-	if(Compare(p, 0.0) < 0) {
+	if(useElementaryFunctionKernels()){
+		mpf_t* res = GetResultPointer();
+		if(elementaryfunctions::Pow(*res, *v, *p)) return res;
+		ReleaseValue(res);
+		// negative bases are only defined for integer exponents
+		if(Sign(v) < 0 && !mpf_integer_p(*p)) return GetUndefined();
+	}
+	if(Sign(p) < 0) {
 		mpf_t* n1 = ToMpft(1.0);
 		mpf_t* v_tmp = Divide(n1, v);
 		mpf_t* p_tmp = Negate(p);
@@ -804,7 +1838,7 @@ mpf_t* Pow(mpf_t* v, mpf_t* p) {
 		ReleaseValue(p_tmp);
 		return res;
 	}
-	if(Compare(p, 1.0) >= 0) {
+	if(CompareD(p, 1.0) >= 0) {
 		std::vector<mpf_t*> powers;
 		powers.push_back(Clone(v));
 		std::vector<mpf_t*> exponents;
@@ -840,7 +1874,7 @@ mpf_t* Pow(mpf_t* v, mpf_t* p) {
 		return res;
 	}
 	// 0 < p < 1, v != 0, v != 1
-	if(Compare(v, 0.0) < 0){
+	if(Sign(v) < 0){
 		return mpftoperations::GetUndefined();
 	}
 	// 0 < p < 1, v > 0, v != 1
@@ -849,21 +1883,21 @@ mpf_t* Pow(mpf_t* v, mpf_t* p) {
 		mpf_t* res = ToMpft(1.0);
 		mpf_t* v_tmp = Clone(v);
 		mpf_t* p_tmp = Clone(p);
-		while(Compare(v, 0.5) < 0 || Compare(v, 1.5) > 0){
+		while(CompareD(v, 0.5) < 0 || CompareD(v, 1.5) > 0){
 			mpf_t* n_v = Sqrt(v_tmp);
 			mpf_t* n_p = Add(p_tmp, p_tmp);
 			ReleaseValue(v_tmp);
 			ReleaseValue(p_tmp);
 			v_tmp = n_v;
 			p_tmp = n_p;
-			if(Compare(p_tmp, 1.0) >= 0) {
+			if(CompareD(p_tmp, 1.0) >= 0) {
 				mpf_t* tmp = Multiply(res, v_tmp);
 				std::swap(tmp, res);
 				ReleaseValue(tmp);
 				tmp =  Subtract(p_tmp, n1);
 				std::swap(tmp, p_tmp);
 				ReleaseValue(tmp);
-				if(Compare(p_tmp, 0.0) == 0) {
+				if(IsZero(p_tmp)) {
 					ReleaseValue(n1);
 					ReleaseValue(v_tmp);
 					ReleaseValue(p_tmp);
@@ -917,60 +1951,250 @@ mpf_t* Pow(mpf_t* v, mpf_t* p) {
 	}
 }
 
-mpf_t* Max(mpf_t* a, mpf_t* b) {
-	if(IsPlusInfinity(a) || IsPlusInfinity(b))return GetPlusInfinity();
-	if(IsUndefined(a) || IsUndefined(b))return GetUndefined();
-	if(IsMinusInfinity(a))return Clone(b);
-	if(IsMinusInfinity(b))return Clone(a);
-	mpf_t* res = GetResultPointer();
-	if (Compare(a, b) <= 0) {
-		mpf_set(*res, *b);
-	} else {
-		mpf_set(*res, *a);
+mpf_t* Pow(mpf_t* v, mpf_t* p) {
+	mpf_t* res = computePow(v, p);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOfPower(res, v, p), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+mpf_t* Max(mpf_t* a, mpf_t* b) {
+	if(IsPlusInfinity(a) || IsPlusInfinity(b))return GetPlusInfinity();
+	if(IsUndefined(a) || IsUndefined(b))return GetUndefined();
+	if(IsMinusInfinity(a))return Clone(b);
+	if(IsMinusInfinity(b))return Clone(a);
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(a, b));
+	if (Compare(a, b) <= 0) {
+		mpf_set(*res, *b);
+	} else {
+		mpf_set(*res, *a);
+	}
+	return res;
+}
+
+mpf_t* Min(mpf_t* a, mpf_t* b) {
+	if(IsMinusInfinity(a) || IsMinusInfinity(b))return GetMinusInfinity();
+	if(IsUndefined(a) || IsUndefined(b))return GetUndefined();
+	if(IsPlusInfinity(a))return Clone(b);
+	if(IsPlusInfinity(b))return Clone(a);
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(a, b));
+	if (Compare(a, b) >= 0) {
+		mpf_set(*res, *b);
+	} else {
+		mpf_set(*res, *a);
+	}
+	return res;
+}
+
+mpf_t* Floor(mpf_t* v) {
+	if(IsUndefined(v)) return GetUndefined();
+	if(IsMinusInfinity(v)) return GetMinusInfinity();
+	if(IsPlusInfinity(v)) return GetPlusInfinity();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(v));
+	mpf_floor(*res, *v);
+	getSlot(res)->radius_exponent = radiusOfRounding(v);
+	return res;
+}
+
+mpf_t* Ceil(mpf_t* v) {
+	if(IsUndefined(v)) return GetUndefined();
+	if(IsMinusInfinity(v)) return GetMinusInfinity();
+	if(IsPlusInfinity(v)) return GetPlusInfinity();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(v));
+	mpf_ceil(*res, *v);
+	getSlot(res)->radius_exponent = radiusOfRounding(v);
+	return res;
+}
+
+mpf_t* Sqrt(mpf_t* num) {
+	if(IsUndefined(num))return GetUndefined();
+	if(IsPlusInfinity(num))return GetPlusInfinity();
+	if(IsMinusInfinity(num))return GetUndefined();
+	if(Sign(num) < 0)return GetUndefined();
+	mpf_t* res = getResultPointerWithPrecision(resultPrecision(num));
+	mpf_sqrt(*res, *num);
+	if(ballArithmeticActive()) setRadius(res, radiusOfSquareRoot(num));
+	return res;
+}
+
+void AddTo(mpf_t** result, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		setResult(result, Add(a, b));
+		return;
+	}
+	bool check = precisionCheckOnAddDue(a, b);
+	// the result may replace an operand, then the check has to be done before the calculation
+	bool operand_replaced = (*result == a || *result == b);
+	if(check && operand_replaced) checkPrecisionOfSum(a, b, false, NULL);
+	long radius = ballArithmeticActive() ? radiusOfSum(a, b) : BALL_RADIUS_EXACT;
+	mpf_t* res = getDestination(*result, resultPrecision(a, b));
+	mpf_add(*res, *a, *b);
+	if(check && !operand_replaced) checkPrecisionOfSum(a, b, false, res);
+	if(ballArithmeticActive()) setRadius(res, radius);
+	setResult(result, res);
+}
+
+void SubtractTo(mpf_t** result, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		setResult(result, Subtract(a, b));
+		return;
+	}
+	bool check = precisionCheckOnAddDue(a, b);
+	// the result may replace an operand, then the check has to be done before the calculation
+	bool operand_replaced = (*result == a || *result == b);
+	if(check && operand_replaced) checkPrecisionOfSum(a, b, true, NULL);
+	long radius = ballArithmeticActive() ? radiusOfSum(a, b) : BALL_RADIUS_EXACT;
+	mpf_t* res = getDestination(*result, resultPrecision(a, b));
+	mpf_sub(*res, *a, *b);
+	if(check && !operand_replaced) checkPrecisionOfSum(a, b, true, res);
+	if(ballArithmeticActive()) setRadius(res, radius);
+	setResult(result, res);
+}
+
+void Multiply2ExpTo(mpf_t** result, const mpf_t* a, int p) {
+	if(IsUndefined(a) || IsInfinite(a) || p == 0){
+		setResult(result, Multiply2Exp(a, p));
+		return;
+	}
+	long radius = ballArithmeticActive() ? shiftRadius(radiusOf(a), p) : BALL_RADIUS_EXACT;
+	mpf_t* res = getDestination(*result, resultPrecision(a));
+	if(p < 0){
+		mpf_div_2exp(*res, *a, -p);
+	} else {
+		mpf_mul_2exp(*res, *a, p);
+	}
+	if(ballArithmeticActive()) setRadius(res, radius);
+	setResult(result, res);
+}
+
+void MultiplyTo(mpf_t** result, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b)){
+		setResult(result, Multiply(a, b));
+		return;
+	}
+	long radius = ballArithmeticActive() ? radiusOfProduct(a, b) : BALL_RADIUS_EXACT;
+	mpf_t* res = getDestination(*result, resultPrecision(a, b));
+	mpf_mul(*res, *a, *b);
+	if(ballArithmeticActive()) setRadius(res, radius);
+	setResult(result, res);
+}
+
+void MultiplyTo(mpf_t** result, const mpf_t* a, const double b) {
+	if(IsUndefined(a) || IsInfinite(a) || !std::isfinite(b)){
+		setResult(result, Multiply(a, b));
+		return;
+	}
+	DoubleMpft mpf_t_b(b);
+	// the double value is exact, hence only the radius of a is scaled
+	long radius = ballArithmeticActive() ? multiplyRadii(radiusOf(a), magnitudeOf(mpf_t_b.Get())) : BALL_RADIUS_EXACT;
+	mpf_t* res = getDestination(*result, resultPrecision(a));
+	mpf_mul(*res, *a, *mpf_t_b.Get());
+	if(ballArithmeticActive()) setRadius(res, radius);
+	setResult(result, res);
+}
+
+void DivideTo(mpf_t** result, const mpf_t* a, const mpf_t* b) {
+	if(IsUndefined(a) || IsUndefined(b) || IsInfinite(a) || IsInfinite(b) || IsZero(b)){
+		setResult(result, Divide(a, b));
+		return;
+	}
+	long radius = ballArithmeticActive() ? radiusOfQuotient(a, b) : BALL_RADIUS_EXACT;
+	mpf_t* res = getDestination(*result, resultPrecision(a, b));
+	mpf_div(*res, *a, *b);
+	if(ballArithmeticActive()) setRadius(res, radius);
+	setResult(result, res);
+}
+
+void AbsTo(mpf_t** result, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		setResult(result, Abs(v));
+		return;
+	}
+	long radius = radiusOf(v);
+	mpf_t* res = getDestination(*result, resultPrecision(v));
+	mpf_abs(*res, *v);
+	getSlot(res)->radius_exponent = radius;
+	setResult(result, res);
+}
+
+void NegateTo(mpf_t** result, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		setResult(result, Negate(v));
+		return;
+	}
+	long radius = radiusOf(v);
+	mpf_t* res = getDestination(*result, resultPrecision(v));
+	mpf_neg(*res, *v);
+	getSlot(res)->radius_exponent = radius;
+	setResult(result, res);
+}
+
+void CopyTo(mpf_t** result, const mpf_t* v) {
+	if(*result == v) return;
+	if(IsUndefined(v) || IsInfinite(v)){
+		setResult(result, Clone(v));
+		return;
+	}
+	mpf_t* res = getDestination(*result, resultPrecision(v));
+	copyValue(res, v);
+	setResult(result, res);
+}
+
+void SetTo(mpf_t** result, double v) {
+	if(!std::isfinite(v)){
+		setResult(result, ToMpft(v));
+		return;
 	}
-	return res;
+	mpf_t* res = getDestination(*result, getDefaultPrecisionLimbs());
+	mpf_set_d(*res, v);
+	getSlot(res)->radius_exponent = BALL_RADIUS_EXACT;
+	setResult(result, res);
 }
 
-mpf_t* Min(mpf_t* a, mpf_t* b) {
-	if(IsMinusInfinity(a) || IsMinusInfinity(b))return GetMinusInfinity();
-	if(IsUndefined(a) || IsUndefined(b))return GetUndefined();
-	if(IsPlusInfinity(a))return Clone(b);
-	if(IsPlusInfinity(b))return Clone(a);
-	mpf_t* res = GetResultPointer();
-	if (Compare(a, b) >= 0) {
-		mpf_set(*res, *b);
-	} else {
-		mpf_set(*res, *a);
+void SqrtTo(mpf_t** result, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v) || Sign(v) < 0){
+		setResult(result, Sqrt(const_cast<mpf_t*>(v)));
+		return;
 	}
-	return res;
+	long radius = ballArithmeticActive() ? radiusOfSquareRoot(v) : BALL_RADIUS_EXACT;
+	mpf_t* res = getDestination(*result, resultPrecision(v));
+	mpf_sqrt(*res, *v);
+	if(ballArithmeticActive()) setRadius(res, radius);
+	setResult(result, res);
 }
 
-mpf_t* Floor(mpf_t* v) {
-	if(IsUndefined(v)) return GetUndefined();
-	if(IsMinusInfinity(v)) return GetMinusInfinity();
-	if(IsPlusInfinity(v)) return GetPlusInfinity();
-	mpf_t* res = GetResultPointer();
+void FloorTo(mpf_t** result, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		setResult(result, Floor(const_cast<mpf_t*>(v)));
+		return;
+	}
+	long radius = radiusOfRounding(v);
+	mpf_t* res = getDestination(*result, resultPrecision(v));
 	mpf_floor(*res, *v);
-	return res;
+	getSlot(res)->radius_exponent = radius;
+	setResult(result, res);
 }
 
-mpf_t* Ceil(mpf_t* v) {
-	if(IsUndefined(v)) return GetUndefined();
-	if(IsMinusInfinity(v)) return GetMinusInfinity();
-	if(IsPlusInfinity(v)) return GetPlusInfinity();
-	mpf_t* res = GetResultPointer();
+void CeilTo(mpf_t** result, const mpf_t* v) {
+	if(IsUndefined(v) || IsInfinite(v)){
+		setResult(result, Ceil(const_cast<mpf_t*>(v)));
+		return;
+	}
+	long radius = radiusOfRounding(v);
+	mpf_t* res = getDestination(*result, resultPrecision(v));
 	mpf_ceil(*res, *v);
-	return res;
+	getSlot(res)->radius_exponent = radius;
+	setResult(result, res);
 }
 
-mpf_t* Sqrt(mpf_t* num) {
-	if(IsUndefined(num))return GetUndefined();
-	if(IsPlusInfinity(num))return GetPlusInfinity();
-	if(IsMinusInfinity(num))return GetUndefined();
-	if(Compare(num, 0.0) < 0)return GetUndefined();
-	mpf_t* res = GetResultPointer();
-	mpf_sqrt(*res, *num);
-	return res;
+void RandomizeTo(mpf_t** result, const mpf_t* v) {
+	RandomizeTo(result, v, Configuration::getStandardRandomNumberGenerator());
+}
+
+void RandomizeTo(mpf_t** result, const mpf_t* v, RandomNumberGenerator* random) {
+	mpf_t* tmp = NULL;
+	random->RandomMpftTo(&tmp);
+	MultiplyTo(result, tmp, v);
+	ReleaseValue(tmp);
 }
 
 mpf_t* cos_taylor(mpf_t* num){
@@ -1066,7 +2290,7 @@ mpf_t* arctan_taylor(mpf_t* num){
 	return res;
 }
 
-mpf_t* Arctan(mpf_t* num){
+mpf_t* computeArctan(mpf_t* num){
 	if(IsUndefined(num))return GetUndefined();
 	if(IsInfinite(num)){
 		mpf_t* pi = GetPi();
@@ -1078,7 +2302,12 @@ mpf_t* Arctan(mpf_t* num){
 		mpftoperations::ReleaseValue(pi_half);
 		return res;
 	}
-	if(Compare(num, 0.0) < 0) {
+	if(useElementaryFunctionKernels()){
+		mpf_t* res = GetResultPointer();
+		elementaryfunctions::Arctan(*res, *num);
+		return res;
+	}
+	if(Sign(num) < 0) {
 		// arctan is symmetric to the origin
 		mpf_t* nnum = Negate(num);
 		mpf_t* nres = Arctan(nnum);
@@ -1086,7 +2315,7 @@ mpf_t* Arctan(mpf_t* num){
 		ReleaseValue(nnum);
 		ReleaseValue(nres);
 		return res;
-	} else if(Compare(num, 0.5) > 0) {
+	} else if(CompareD(num, 0.5) > 0) {
 		// application of formula:
 		// arctan(x)=2*arctan(x/(1+sqrt(1+x*x)))
 		// this leads to smaller arguments such that
@@ -1112,30 +2341,41 @@ mpf_t* Arctan(mpf_t* num){
 	}
 }
 
-mpf_t* Arcsin(mpf_t* num){
+mpf_t* Arctan(mpf_t* num){
+	mpf_t* res = computeArctan(num);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOf(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+mpf_t* computeArcsin(mpf_t* num){
 	if(IsUndefined(num))return GetUndefined();
 	if(IsInfinite(num))return GetUndefined();
 	// case num = -1 or num = +1
-	if(Compare(num, 1.0) == 0
-			|| Compare(num, -1.0) == 0) {
+	if(CompareD(num, 1.0) == 0
+			|| CompareD(num, -1.0) == 0) {
 		mpf_t* pi = GetPi();
 		mpf_t* n2 = ToMpft(2.0);
 		mpf_t* res = Divide(pi, n2);
 		ReleaseValue(pi);
 		ReleaseValue(n2);
-		if(Compare(num, -1.0) == 0){
+		if(CompareD(num, -1.0) == 0){
 			mpf_t* tmp = Negate(res);
 			ReleaseValue(res);
 			res = tmp;
 		}
 		return res;
 	}
-	if(Compare(num, -1.0) < 0){
+	if(CompareD(num, -1.0) < 0){
 		return GetUndefined();
 	}
-	if(Compare(num,  1.0) > 0){
+	if(CompareD(num, 1.0) > 0){
 		return GetUndefined();
 	}
+	if(useElementaryFunctionKernels()){
+		mpf_t* res = GetResultPointer();
+		elementaryfunctions::Arcsin(*res, *num);
+		return res;
+	}
 	// application of formula:
 	// arcsin(x) = arctan(x / sqrt(1 - x * x))
 	mpf_t* n1 = ToMpft(1.0);
@@ -1152,7 +2392,20 @@ mpf_t* Arcsin(mpf_t* num){
 	return res;
 }
 
-mpf_t* Arccos(mpf_t* num){
+mpf_t* Arcsin(mpf_t* num){
+	mpf_t* res = computeArcsin(num);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOfArcsine(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+mpf_t* computeArccos(mpf_t* num){
+	if(useElementaryFunctionKernels()){
+		if(IsUndefined(num) || IsInfinite(num))return GetUndefined();
+		if(CompareD(num, -1.0) < 0 || CompareD(num, 1.0) > 0)return GetUndefined();
+		mpf_t* res = GetResultPointer();
+		elementaryfunctions::Arccos(*res, *num);
+		return res;
+	}
 	mpf_t* pi = GetPi();
 	mpf_t* n2 = ToMpft(2.0);
 	mpf_t* pi_d2 = Divide(pi, n2);
@@ -1165,9 +2418,54 @@ mpf_t* Arccos(mpf_t* num){
 	return res;
 }
 
+mpf_t* Arccos(mpf_t* num){
+	mpf_t* res = computeArccos(num);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOfArcsine(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+// Calculates the sine and the cosine with the fast kernel if it is activated.
+// The subtraction of the multiple of Pi / 2 is precision checked as in the reference implementation of Sin.
+// Returns false if the fast kernel is not activated or does not support the argument.
+bool sinCosFast(mpf_t* num, mpf_t** sin_result, mpf_t** cos_result){
+	if(!useElementaryFunctionKernels()) return false;
+	if(IsUndefined(num) || IsInfinite(num)) return false;
+	mpf_t* s = (sin_result != NULL ? GetResultPointer() : NULL);
+	mpf_t* c = (cos_result != NULL ? GetResultPointer() : NULL);
+	mpf_t* reduction = GetResultPointer();
+	if(!elementaryfunctions::SinCos(s != NULL ? *s : NULL, c != NULL ? *c : NULL, *num, *reduction)){
+		ReleaseValue(s);
+		ReleaseValue(c);
+		ReleaseValue(reduction);
+		return false;
+	}
+	if(mpf_sgn(*reduction) != 0){
+		checkPrecisionOnAdd(num, reduction, true);
+	}
+	ReleaseValue(reduction);
+	if(sin_result != NULL) *sin_result = s;
+	if(cos_result != NULL) *cos_result = c;
+	return true;
+}
+
+void computeSinCos(mpf_t* num, mpf_t** sin_result, mpf_t** cos_result){
+	if(sinCosFast(num, sin_result, cos_result)) return;
+	*sin_result = Sin(num);
+	*cos_result = Cos(num);
+}
+
+void SinCos(mpf_t* num, mpf_t** sin_result, mpf_t** cos_result){
+	computeSinCos(num, sin_result, cos_result);
+	if(ballArithmeticActive()) {
+		setRadiusOfValue(*sin_result, radiusOf(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+		setRadiusOfValue(*cos_result, radiusOf(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+	}
+}
+
 mpf_t* Tan(mpf_t* num){
-	mpf_t* nume = Sin(num);
-	mpf_t* deno = Cos(num);
+	mpf_t* nume = NULL;
+	mpf_t* deno = NULL;
+	SinCos(num, &nume, &deno);
 	// division by zero produces undefined value
 	mpf_t* res = Divide(nume, deno);
 	mpftoperations::ReleaseValue(nume);
@@ -1175,44 +2473,52 @@ mpf_t* Tan(mpf_t* num){
 	return res;
 }
 
-mpf_t* Cos(mpf_t* num){
-	if(IsUndefined(num))return GetUndefined();
-	if(IsInfinite(num))return GetUndefined();
-	// application of formula:
-	// cos(alpha) = sin(alpha + pi / 2)
-	mpf_t* pi = GetPi();
-	mpf_t* pi_half = Multiply2Exp(pi, -1);
-	mpf_t* nnum = Add(num, pi_half); // DO PRECISION CHECK HERE!!
-	mpf_t* res = Sin(nnum);
-	ReleaseValue(nnum);
-	ReleaseValue(pi_half);
-	ReleaseValue(pi);
-	return res;
+// The constants of the argument reduction of the reference implementation of Sin.
+// The vector functions share them between the elements (see sinOrCosOfElements).
+struct SinReductionConstants {
+	mpf_t* pi;
+	mpf_t* pi_half;
+	mpf_t* pi_d4;
+	mpf_t* n1d2;
+	mpf_t* n2_pi;
+};
+
+SinReductionConstants* createSinReductionConstants(){
+	SinReductionConstants* constants = new SinReductionConstants();
+	constants->pi = GetPi();
+	mpf_t* n1 = ToMpft(1.0);
+	constants->pi_half = Multiply2Exp(constants->pi, -1);
+	constants->pi_d4 = Multiply2Exp(constants->pi_half, -1);
+	constants->n1d2 = Multiply2Exp(n1, -1);
+	constants->n2_pi = Multiply2Exp(constants->pi, 1);
+	ReleaseValue(n1);
+	return constants;
 }
 
-mpf_t* Sin(mpf_t* num){
-	if(IsUndefined(num))return GetUndefined();
-	if(IsInfinite(num))return GetUndefined();
+void releaseSinReductionConstants(SinReductionConstants* constants){
+	ReleaseValue(constants->pi);
+	ReleaseValue(constants->pi_half);
+	ReleaseValue(constants->pi_d4);
+	ReleaseValue(constants->n1d2);
+	ReleaseValue(constants->n2_pi);
+	delete constants;
+}
+
+// Calculates the sine of a defined and finite value with the reference implementation.
+mpf_t* sinWithConstants(mpf_t* num, const SinReductionConstants & constants){
 	num = Clone(num);
-	mpf_t* pi = GetPi();
-	mpf_t* minus_pi = Negate(pi);
-	mpf_t* n1 = ToMpft(1.0);
-	mpf_t* pi_half = Multiply2Exp(pi, -1);
-	mpf_t* pi_d4 = Multiply2Exp(pi_half, -1);
-	mpf_t* n1d2 = Multiply2Exp(n1, -1);
-	mpf_t* n2_pi = Multiply2Exp(pi, 1);
 	mpf_t* absnum = Abs(num);
 
 	// move in interval -pi..pi
-	if(mpf_cmp(*absnum, *pi) > 0){
+	if(mpf_cmp(*absnum, *constants.pi) > 0){
 		// use formula
 		// sin(alpha) = sin(alpha + m * 2 * pi)
 		// for all integers m
-		mpf_t* num_d_pi = Divide(num, n2_pi);
-		mpf_t* num_d_pi_phalf = add_NO_CHECK(num_d_pi, n1d2);
+		mpf_t* num_d_pi = Divide(num, constants.n2_pi);
+		mpf_t* num_d_pi_phalf = add_NO_CHECK(num_d_pi, constants.n1d2);
 		mpf_t* num_d_pi_round = GetResultPointer();
 		mpf_floor(*num_d_pi_round, *num_d_pi_phalf);
-		mpf_t* move = Multiply(num_d_pi_round, n2_pi);
+		mpf_t* move = Multiply(num_d_pi_round, constants.n2_pi);
 		mpf_t* nnum = Subtract(num, move); // DO PRECISION CHECK HERE!!
 		ReleaseValue(num);
 		ReleaseValue(num_d_pi);
@@ -1224,24 +2530,18 @@ mpf_t* Sin(mpf_t* num){
 		absnum = Abs(num);
 	}
 
-	if(mpf_cmp(*absnum, *pi) > 0){
+	if(mpf_cmp(*absnum, *constants.pi) > 0){
 		// happens only if initial num is very large
 		mpf_t* res = Sin(num);
 		ReleaseValue(num);
-		ReleaseValue(pi);
-		ReleaseValue(minus_pi);
-		ReleaseValue(n1);
-		ReleaseValue(pi_half);
-		ReleaseValue(pi_d4);
-		ReleaseValue(n1d2);
-		ReleaseValue(n2_pi);
 		ReleaseValue(absnum);
 		return res;
 	}
+	ReleaseValue(absnum);
 
 	// move in interval 0 .. pi
 	bool doNegate = false;
-	if(Compare(num, 0.0) < 0){
+	if(Sign(num) < 0){
 		// application of formula:
 		// sin(alpha) = -sin(-alpha)
 		doNegate = true;
@@ -1250,33 +2550,24 @@ mpf_t* Sin(mpf_t* num){
 		num = nnum;
 	}
 	// move in interval 0 .. pi/2
-	if(mpf_cmp(*num, *pi_half) > 0){
+	if(mpf_cmp(*num, *constants.pi_half) > 0){
 		// application of formula:
 		// sin(alpha) = sin(pi - alpha)
-		mpf_t* nnum = Subtract(pi, num); // DO PRECISION CHECK HERE!!
+		mpf_t* nnum = Subtract(constants.pi, num); // DO PRECISION CHECK HERE!!
 		ReleaseValue(num);
 		num = nnum;
 	}
 	// move in interval 0 .. pi/4
 	bool doCosinus = false;
-	if(mpf_cmp(*num, *pi_d4) > 0){
+	if(mpf_cmp(*num, *constants.pi_d4) > 0){
 		// application of formula:
 		// sin(alpha) = cos(alpha - pi / 2)
 		doCosinus = true;
-		mpf_t* nnum = Subtract(pi_half, num); // DO PRECISION CHECK HERE!!
+		mpf_t* nnum = Subtract(constants.pi_half, num); // DO PRECISION CHECK HERE!!
 		ReleaseValue(num);
 		num = nnum;
 	}
 
-	ReleaseValue(pi);
-	ReleaseValue(minus_pi);
-	ReleaseValue(n1);
-	ReleaseValue(pi_half);
-	ReleaseValue(pi_d4);
-	ReleaseValue(n1d2);
-	ReleaseValue(n2_pi);
-	ReleaseValue(absnum);
-
 	mpf_t* res = NULL;
 
 	if(doCosinus)res = cos_taylor(num);
@@ -1291,26 +2582,106 @@ mpf_t* Sin(mpf_t* num){
 	return res;
 }
 
-int Compare(const mpf_t* a, const double b){
+// Calculates the cosine of a defined and finite value with the reference implementation.
+mpf_t* cosWithConstants(mpf_t* num, const SinReductionConstants & constants){
+	// application of formula:
+	// cos(alpha) = sin(alpha + pi / 2)
+	mpf_t* nnum = Add(num, constants.pi_half); // DO PRECISION CHECK HERE!!
+	mpf_t* res = NULL;
+	if(!sinCosFast(nnum, &res, NULL)) res = sinWithConstants(nnum, constants);
+	ReleaseValue(nnum);
+	return res;
+}
+
+mpf_t* computeCos(mpf_t* num){
+	if(IsUndefined(num))return GetUndefined();
+	if(IsInfinite(num))return GetUndefined();
+	mpf_t* res = NULL;
+	if(sinCosFast(num, NULL, &res)) return res;
+	SinReductionConstants* constants = createSinReductionConstants();
+	res = cosWithConstants(num, *constants);
+	releaseSinReductionConstants(constants);
+	return res;
+}
+
+mpf_t* Cos(mpf_t* num){
+	mpf_t* res = computeCos(num);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOf(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+mpf_t* computeSin(mpf_t* num){
+	if(IsUndefined(num))return GetUndefined();
+	if(IsInfinite(num))return GetUndefined();
+	mpf_t* res = NULL;
+	if(sinCosFast(num, &res, NULL)) return res;
+	SinReductionConstants* constants = createSinReductionConstants();
+	res = sinWithConstants(num, *constants);
+	releaseSinReductionConstants(constants);
+	return res;
+}
+
+mpf_t* Sin(mpf_t* num){
+	mpf_t* res = computeSin(num);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOf(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+std::vector<mpf_t*> sinOrCosOfElements(const std::vector<mpf_t*> & a, bool cosine){
+	std::vector<mpf_t*> res(a.size(), (mpf_t*)NULL);
+	// the reduction constants are created for the first element which needs them
+	SinReductionConstants* constants = NULL;
+	for (unsigned int i = 0; i < a.size(); i++) {
+		mpf_t* num = a[i];
+		if(IsUndefined(num) || IsInfinite(num)) {
+			res[i] = GetUndefined();
+		} else if(!sinCosFast(num, cosine ? NULL : &res[i], cosine ? &res[i] : NULL)) {
+			if(constants == NULL) constants = createSinReductionConstants();
+			res[i] = cosine ? cosWithConstants(num, *constants) : sinWithConstants(num, *constants);
+		}
+		if(ballArithmeticActive()) setRadiusOfValue(res[i], radiusOf(num), ELEMENTARY_FUNCTION_ERROR_BITS);
+	}
+	if(constants != NULL) releaseSinReductionConstants(constants);
+	return res;
+}
+
+int CompareD(const mpf_t* a, const double b){
 	AssertCondition(!IsUndefined(a) && !std::isnan(b), "Comparisons with undefined values are not possible. Please check whether your functions or statistics can produce undefined values.");
-	if(std::isfinite(b)){
-		if(IsPlusInfinity(a)){
-			return 1;
-		} else if(IsMinusInfinity(a)){
-			return -1;
+	if(std::isinf(b)){
+		if(b > 0){
+			return IsPlusInfinity(a) ? 0 : -1;
 		} else {
-			return mpf_cmp_d(*a, b);
+			return IsMinusInfinity(a) ? 0 : 1;
 		}
-	} else {
-		mpf_t* tmp_b = ToMpft(b);
-		int res = Compare(a,tmp_b);
-		ReleaseValue(tmp_b);
-		return res;
 	}
+	if(IsPlusInfinity(a)){
+		return 1;
+	} else if(IsMinusInfinity(a)){
+		return -1;
+	}
+	return mpf_cmp_d(*a, b);
+}
+
+int Sign(const mpf_t* v){
+	AssertCondition(!IsUndefined(v), "Comparisons with undefined values are not possible. Please check whether your functions or statistics can produce undefined values.");
+	if(IsPlusInfinity(v)){
+		return 1;
+	} else if(IsMinusInfinity(v)){
+		return -1;
+	}
+	return mpf_sgn(*v);
+}
+
+bool IsZero(const mpf_t* v){
+	return Sign(v) == 0;
+}
+
+int Compare(const mpf_t* a, const double b){
+	return CompareD(a, b);
 }
 
 int Compare(const double a, const mpf_t* b){
-	return -Compare(b, a);
+	return -CompareD(b, a);
 }
 
 int Compare(const mpf_t* a, const mpf_t* b){
@@ -1337,13 +2708,7 @@ int Compare(const mpf_t* a, const mpf_t* b){
 
 	if(mpf_cmp(*a, *b) == 0)return 0;
 
-	mpf_t* a1 = Multiply2Exp(a, -1);
-	mpf_t* a2 = Multiply2Exp(a, 1);
-	if(mpf_cmp(*a2, *a1) < 0)std::swap(a1,a2);
-	bool inside = ((mpf_cmp(*a1, *b) < 0) && (mpf_cmp(*b, *a2) < 0));
-	mpftoperations::ReleaseValue(a1);
-	mpftoperations::ReleaseValue(a2);
-	if(!inside){
+	if(!isBetweenHalfAndDouble(a, b)){
 		return mpf_cmp(*a, *b);
 	}
 	// if values are close difference has to be calculated
@@ -1354,22 +2719,32 @@ int Compare(const mpf_t* a, const mpf_t* b){
 	return res;
 }
 
-mpf_t* mpft_plus_infinity_cached_ = NULL;
-mpf_t* GetPlusInfinity(){
-	if(mpft_plus_infinity_cached_ == NULL){
-		mpft_plus_infinity_cached_ = GetResultPointer();
-		ChangeNumberOfMpftValuesCached(1);
+int Compare(const mpf_t* a, const mpf_t* b, const char* context){
+	int res = Compare(a, b);
+	if(!ballArithmeticActive() || res == 0 || IsInfinite(a) || IsInfinite(b)) return res;
+	long radius = radiusOfSum(a, b);
+	if(radius == BALL_RADIUS_EXACT) return res;
+	bool undecidable = (radius == BALL_RADIUS_UNBOUNDED);
+	if(!undecidable) {
+		// the balls overlap iff |a - b| <= 2^radius and the magnitude e of the difference guarantees |a - b| >= 2^(e - 1)
+		mpf_t* diff = GetResultPointer();
+		mpf_sub(*diff, *a, *b);
+		undecidable = (magnitudeOf(diff) - 1 <= radius);
+		ReleaseValue(diff);
+	}
+	if(undecidable) {
+		Configuration::RecommendIncreasePrecision();
+		state().undecidable_comparisons[context]++;
 	}
-	return mpft_plus_infinity_cached_;
+	return res;
+}
+
+mpf_t* GetPlusInfinity(){
+	return &plus_infinity_.slot.value;
 }
 
-mpf_t* mpft_minus_infinity_cached_ = NULL;
 mpf_t* GetMinusInfinity(){
-	if(mpft_minus_infinity_cached_ == NULL) {
-		mpft_minus_infinity_cached_ = GetResultPointer();
-		ChangeNumberOfMpftValuesCached(1);
-	}
-	return mpft_minus_infinity_cached_;
+	return &minus_infinity_.slot.value;
 }
 
 bool IsPlusInfinity(const mpf_t* v){
@@ -1382,28 +2757,27 @@ bool IsInfinite(const mpf_t* v){
 	return IsPlusInfinity(v) || IsMinusInfinity(v);
 }
 
-mpf_t* mpft_undefined_ = NULL;
 mpf_t* GetUndefined(){
-	if(mpft_undefined_ == NULL){
-		mpft_undefined_ = GetResultPointer();
-		ChangeNumberOfMpftValuesCached(1);
-	}
-	return mpft_undefined_;
+	return &undefined_.slot.value;
 }
 
 bool IsUndefined(const mpf_t* v){
 	return v == GetUndefined();
 }
 
-mpf_t* pi_cached_ = NULL;
-unsigned int pi_cached_precision_ = 1;
-mpf_t* GetPi(){
-	if(pi_cached_ == NULL || mpf_get_default_prec() != pi_cached_precision_){
-		if(pi_cached_ == NULL)number_of_mpf_t_values_cached_++;
+mpf_t* computePi(){
+	if(useConstantsEngine()){
+		mpf_t* res = GetResultPointer();
+		constants::Pi(*res);
+		return res;
+	}
+	// the cached value is reused as long as the additional bits of the precision do not change the result
+	if(state().pi_cached == NULL || !IsEquivalentPrecision(Context::GetCurrent()->GetPrecision(), state().pi_cached_precision)){
+		if(state().pi_cached == NULL)state().number_of_mpf_t_values_cached++;
 		// calculate Pi with Bailey-Borwein-Plouffe formula
-		ReleaseValue(pi_cached_);
-		pi_cached_ = NULL;
-		pi_cached_precision_ = mpf_get_default_prec();
+		ReleaseValue(state().pi_cached);
+		state().pi_cached = NULL;
+		state().pi_cached_precision = Context::GetCurrent()->GetPrecision();
 		mpf_t* n16 = ToMpft(16.0);
 		mpf_t* n8 = ToMpft(8.0);
 		mpf_t* n6 = ToMpft(6.0);
@@ -1464,24 +2838,39 @@ mpf_t* GetPi(){
 		ReleaseValue(n1d16);
 		ReleaseValue(mul);
 		ReleaseValue(k8);
-		pi_cached_ = res;
+		state().pi_cached = res;
 	}
-	return Clone(pi_cached_);
+	return Clone(state().pi_cached);
 }
 
-mpf_t* e_cached = NULL;
-unsigned int e_cached_precision = 1;
-mpf_t* GetE(){
-	if(e_cached == NULL || mpf_get_default_prec() != e_cached_precision){
-		if(e_cached == NULL)number_of_mpf_t_values_cached_++;
-		ReleaseValue(e_cached);
-		e_cached = NULL;
-		e_cached_precision = mpf_get_default_prec();
+mpf_t* GetPi(){
+	mpf_t* res = computePi();
+	if(ballArithmeticActive()) setRadiusOfValue(res, BALL_RADIUS_EXACT, ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
+mpf_t* computeE(){
+	if(useConstantsEngine()){
+		mpf_t* res = GetResultPointer();
+		constants::E(*res);
+		return res;
+	}
+	if(state().e_cached == NULL || !IsEquivalentPrecision(Context::GetCurrent()->GetPrecision(), state().e_cached_precision)){
+		if(state().e_cached == NULL)state().number_of_mpf_t_values_cached++;
+		ReleaseValue(state().e_cached);
+		state().e_cached = NULL;
+		state().e_cached_precision = Context::GetCurrent()->GetPrecision();
 		mpf_t* n1 = ToMpft(1.0);
-		e_cached = Exp(n1);
+		state().e_cached = Exp(n1);
 		ReleaseValue(n1);
 	}
-	return Clone(e_cached);
+	return Clone(state().e_cached);
+}
+
+mpf_t* GetE(){
+	mpf_t* res = computeE();
+	if(ballArithmeticActive()) setRadiusOfValue(res, BALL_RADIUS_EXACT, ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
 }
 
 mpf_t* exp_taylor(mpf_t* v){
@@ -1511,11 +2900,16 @@ mpf_t* exp_taylor(mpf_t* v){
 	return res;
 }
 
-mpf_t* Exp(mpf_t* v){
+mpf_t* computeExp(mpf_t* v){
 	if(IsUndefined(v))return GetUndefined();
 	if(IsPlusInfinity(v))return GetPlusInfinity();
 	if(IsMinusInfinity(v))return ToMpft(0.0);
-	if(Compare(v, -1.0) < 0 || Compare(v, 1.0) > 0){
+	if(useElementaryFunctionKernels()){
+		mpf_t* res = GetResultPointer();
+		if(elementaryfunctions::Exp(*res, *v)) return res;
+		ReleaseValue(res);
+	}
+	if(CompareD(v, -1.0) < 0 || CompareD(v, 1.0) > 0){
 		mpf_t* v_half = Multiply2Exp(v, -1);
 		mpf_t* res_half = Exp(v_half);
 		mpf_t* res = Multiply(res_half, res_half);
@@ -1527,6 +2921,12 @@ mpf_t* Exp(mpf_t* v){
 	}
 }
 
+mpf_t* Exp(mpf_t* v){
+	mpf_t* res = computeExp(v);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOfExp(res, v), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
 mpf_t* logE_taylor(mpf_t* v){
 	mpf_t* n1 = ToMpft(1.0);
 	mpf_t* x = Subtract(n1, v);
@@ -1555,13 +2955,18 @@ mpf_t* logE_taylor(mpf_t* v){
 	return res;
 }
 
-mpf_t* LogE(mpf_t* v){
+mpf_t* computeLogE(mpf_t* v){
 	if(IsUndefined(v))return GetUndefined();
 	if(IsPlusInfinity(v))return GetPlusInfinity();
 	if(IsMinusInfinity(v))return GetUndefined();
-	if(Compare(v, 0.0) < 0)return GetUndefined();
-	if(Compare(v, 0.0) ==  0)return GetMinusInfinity();
-	if(Compare(v, 0.99) < 0 || Compare(v, 1.01) > 0){
+	if(Sign(v) < 0)return GetUndefined();
+	if(IsZero(v))return GetMinusInfinity();
+	if(useElementaryFunctionKernels()){
+		mpf_t* res = GetResultPointer();
+		elementaryfunctions::LogE(*res, *v);
+		return res;
+	}
+	if(CompareD(v, 0.99) < 0 || CompareD(v, 1.01) > 0){
 		mpf_t* sqv = Sqrt(v);
 		mpf_t* n2 = ToMpft(2);
 		mpf_t* res_sq = LogE(sqv);
@@ -1575,13 +2980,19 @@ mpf_t* LogE(mpf_t* v){
 	}
 }
 
+mpf_t* LogE(mpf_t* v){
+	mpf_t* res = computeLogE(v);
+	if(ballArithmeticActive()) setRadiusOfValue(res, radiusOfLogE(v), ELEMENTARY_FUNCTION_ERROR_BITS);
+	return res;
+}
+
 double Log2Double(mpf_t* v) {
 	if(IsUndefined(v))return NAN;
 	if(IsPlusInfinity(v))return INFINITY;
 	if(IsMinusInfinity(v))return NAN;
-	if(Compare(v, 0.0) < 0)return NAN;
-	if(Compare(v, 0.0) ==  0)return -INFINITY;
-	AssertCondition(Compare(v, 0.0) > 0, "");
+	if(Sign(v) < 0)return NAN;
+	if(IsZero(v))return -INFINITY;
+	AssertCondition(Sign(v) > 0, "");
 	if(Compare(v, 1e-300) < 0 || Compare(v, 1e300) > 0){
 		mpf_t* sq = Sqrt(v);
 		double res = Log2Double(sq);
@@ -1591,50 +3002,233 @@ double Log2Double(mpf_t* v) {
 	return std::log(mpftoperations::MpftToDouble(v)) / std::log(2.0);
 }
 
+// Returns the decimal digits of the non negative exponent with leading zeros up to the minimal number of digits.
+// This avoids the construction of a stream for each conversion.
+std::string exponentDigits(unsigned long exponent, unsigned int minimal_digits) {
+	std::string digits;
+	do {
+		digits += (char)('0' + exponent % 10);
+		exponent /= 10;
+	} while(exponent > 0);
+	if(digits.size() < minimal_digits) digits.append(minimal_digits - digits.size(), '0');
+	return std::string(digits.rbegin(), digits.rend());
+}
+
+// Converts the finite value in the format of gmp_printf("%.*Fe") with the output precision.
+// If the output precision is -1 then the digits of the current precision are used and trailing zeros are removed.
+// The conversion is reentrant, as it uses only local buffers instead of a buffer shared by all calls.
+// The radix conversion itself is done by mpf_get_str, hence its cost equals the one of gmp_printf.
+std::string mpftToDecimalString(const mpf_t* v) {
+	int output_precision = Configuration::getOutputPrecision();
+	bool remove_trailing_zeros = (output_precision == -1);
+	if(remove_trailing_zeros){
+		output_precision = Context::GetCurrent()->GetPrecision() / log(10.0) * log(2.0);
+	}
+	// mpf_get_str rounds to the same digits as gmp_printf and omits trailing zeros, which are added below
+	std::vector<char> buffer(output_precision + 3);
+	mp_exp_t exponent;
+	mpf_get_str(&buffer[0], &exponent, 10, output_precision + 1, *v);
+	const char* digits = &buffer[0];
+	std::string res;
+	res.reserve(output_precision + 10);
+	if(*digits == '-'){
+		res += '-';
+		++digits;
+	}
+	int number_of_digits = strlen(digits);
+	if(number_of_digits == 0){
+		digits = "0";
+		number_of_digits = 1;
+		exponent = 1;
+	}
+	res += digits[0];
+	int fraction_digits = output_precision;
+	if(remove_trailing_zeros && output_precision > 0){
+		// at least one digit after the decimal point is kept
+		fraction_digits = std::max(number_of_digits - 1, 1);
+	}
+	if(fraction_digits > 0){
+		res += '.';
+		res.append(digits + 1, number_of_digits - 1);
+		res.append(fraction_digits - (number_of_digits - 1), '0');
+	}
+	long decimal_exponent = exponent - 1;
+	res += (decimal_exponent < 0 ? "e-" : "e+");
+	res += exponentDigits(std::abs(decimal_exponent), 2);
+	return res;
+}
+
+// Converts the finite value exactly to the format [-]0x1[.<hex digits>]p<+|-><binary exponent> (like printf("%a")),
+// where trailing zeros are omitted. Zero is converted to 0x0p+0.
+std::string mpftToHexadecimalString(const mpf_t* v) {
+	static const char HEX_DIGITS[] = "0123456789abcdef";
+	int size = std::abs((*v)->_mp_size);
+	if(size == 0) return "0x0p+0";
+	// shift the leading one bit out of the mantissa such that the remaining bits form the hex digits after the point
+	int leading_zeros = 0;
+	while(((*v)->_mp_d[size - 1] << leading_zeros) >> (GMP_NUMB_BITS - 1) == 0) leading_zeros++;
+	std::vector<mp_limb_t> fraction(size, 0);
+	if(leading_zeros + 1 < GMP_NUMB_BITS){
+		mpn_lshift(&fraction[0], (*v)->_mp_d, size, leading_zeros + 1);
+	} else {
+		std::copy((*v)->_mp_d, (*v)->_mp_d + size - 1, fraction.begin() + 1);
+	}
+	std::string digits;
+	digits.reserve(size * (GMP_NUMB_BITS / 4));
+	for(int i = size - 1; i >= 0; i--){
+		for(int shift = GMP_NUMB_BITS - 4; shift >= 0; shift -= 4){
+			digits += HEX_DIGITS[(fraction[i] >> shift) & 15];
+		}
+	}
+	digits.erase(digits.find_last_not_of('0') + 1);
+	// value = 0.<mantissa> * 2^(GMP_NUMB_BITS * exp) = 1.<digits> * 2^(GMP_NUMB_BITS * exp - leading_zeros - 1)
+	long binary_exponent = (long)GMP_NUMB_BITS * (*v)->_mp_exp - leading_zeros - 1;
+	std::string res((*v)->_mp_size < 0 ? "-0x1" : "0x1");
+	if(!digits.empty()) res += '.' + digits;
+	res += (binary_exponent < 0 ? "p-" : "p+");
+	res += exponentDigits(std::abs(binary_exponent), 1);
+	return res;
+}
+
 std::string MpftToString(const mpf_t* v){
 	if(IsUndefined(v))return "nan";
 	if(IsPlusInfinity(v))return "inf";
 	if(IsMinusInfinity(v))return "-inf";
-	static char* buf = NULL;
-	static int buf_size = 0;
-	if(buf == NULL){
-		AssertCondition(buf_size == 0, "Initialization failed.");
-		buf_size = 10;
-		buf = (char*) malloc(buf_size * sizeof(char));
-	}
-	AssertCondition(buf_size != 0, "Initialization failed.");
-	int string_size;
-	int output_precision = Configuration::getOutputPrecision();
-	if(output_precision == -1){
-		output_precision = mpf_get_default_prec() / log(10.0) * log(2.0);
-	}
-	while (true) {
-		string_size = gmp_snprintf(buf, buf_size, "%.*Fe", output_precision, *v);
-		if( string_size < buf_size ){
-			break;
-		}
-		free (buf);
-		buf_size *= 2;
-		buf = (char*) malloc(buf_size * sizeof(char));
-	}
-	AssertCondition(string_size == (int)strlen(buf), "");
-	if(Configuration::getOutputPrecision() == -1){
-		int e_pos = string_size - 1;
-		while(e_pos > 0 && buf[e_pos] != 'e')--e_pos;
-		if((buf[1] == '.' || buf[2] == '.') && e_pos > 1 && buf[e_pos - 1] == '0'){
-			int zeros = 1;
-			while(buf[e_pos - 1 - zeros] == '0')++zeros;
-			if(buf[e_pos - 1 - zeros] == '.')--zeros;
-			for(int copy_pos = e_pos; copy_pos <= string_size; copy_pos++){
-				buf[copy_pos - zeros] = buf[copy_pos];
-			}
+	if(Configuration::getOutputFormat() == configuration::OUTPUT_FORMAT_HEXADECIMAL){
+		return mpftToHexadecimalString(v);
+	}
+	return mpftToDecimalString(v);
+}
+
+mpf_t* HexadecimalStringToMpft(const std::string & value){
+	if(value == "nan")return GetUndefined();
+	if(value == "inf")return GetPlusInfinity();
+	if(value == "-inf")return GetMinusInfinity();
+	bool negative = (value.size() > 0 && value[0] == '-');
+	size_t position = (negative ? 1 : 0);
+	AssertCondition(value.compare(position, 2, "0x") == 0, "Invalid hexadecimal representation of mpf_t value.");
+	position += 2;
+	std::string mantissa;
+	long fraction_digits = 0;
+	bool fraction = false;
+	for(; position < value.size() && value[position] != 'p'; position++){
+		if(value[position] == '.'){
+			AssertCondition(!fraction, "Invalid hexadecimal representation of mpf_t value.");
+			fraction = true;
+		} else {
+			AssertCondition(isxdigit(value[position]), "Invalid hexadecimal representation of mpf_t value.");
+			mantissa += value[position];
+			if(fraction) fraction_digits++;
 		}
 	}
-	std::string res(buf);
+	AssertCondition(mantissa.size() > 0 && position + 1 < value.size(), "Invalid hexadecimal representation of mpf_t value.");
+	long binary_exponent = 0;
+	std::istringstream exponent_stream(value.substr(position + 1));
+	exponent_stream >> binary_exponent;
+	AssertCondition(!exponent_stream.fail(), "Invalid hexadecimal representation of mpf_t value.");
+	binary_exponent -= 4 * fraction_digits;
+	// the precision suffices to represent all digits exactly
+	mp_size_t precision = std::max(getDefaultPrecisionLimbs(), (mp_size_t)((4 * mantissa.size() + 2 * GMP_NUMB_BITS - 1) / GMP_NUMB_BITS));
+	mpf_t* res = getResultPointerWithPrecision(precision);
+	mpf_set_str(*res, mantissa.c_str(), 16);
+	if(binary_exponent < 0){
+		mpf_div_2exp(*res, *res, -binary_exponent);
+	} else {
+		mpf_mul_2exp(*res, *res, binary_exponent);
+	}
+	if(negative) mpf_neg(*res, *res);
 	return res;
 }
 
+// Writes the lowest bytes of the value in little-endian byte order.
+inline void writeLittleEndian(char* buffer, unsigned long long value, int bytes) {
+	for(int i = 0; i < bytes; i++) {
+		buffer[i] = (char)((value >> (8 * i)) & 0xff);
+	}
+}
+
+inline unsigned long long readLittleEndian(const char* buffer, int bytes) {
+	unsigned long long value = 0;
+	for(int i = 0; i < bytes; i++) {
+		value |= (unsigned long long)(unsigned char)buffer[i] << (8 * i);
+	}
+	return value;
+}
+
+// Fixed part of a binary record of a finite value: limb bytes, size, precision and exponent.
+const int BINARY_RECORD_HEADER_BYTES = 1 + 4 + 4 + 8;
+
+void storeMpftBinary(mpf_t* a, std::ofstream* file) {
+	char tag = 'F';
+	if ( NULL == a ) {
+		tag = 'N';
+	} else if ( IsPlusInfinity(a) ) {
+		tag = 'P';
+	} else if ( IsMinusInfinity(a) ) {
+		tag = 'M';
+	} else if ( IsUndefined(a) ) {
+		tag = 'U';
+	}
+	file->put('B');
+	file->put(tag);
+	// like the text format each record is terminated by a line break
+	if(tag != 'F') {
+		file->put('\n');
+		return;
+	}
+	int size = std::abs((*a)->_mp_size);
+	std::vector<char> buffer(BINARY_RECORD_HEADER_BYTES + size * sizeof(mp_limb_t));
+	buffer[0] = (char)sizeof(mp_limb_t);
+	writeLittleEndian(&buffer[1], (unsigned int)(*a)->_mp_size, 4);
+	writeLittleEndian(&buffer[5], (unsigned int)(*a)->_mp_prec, 4);
+	writeLittleEndian(&buffer[9], (unsigned long long)(long long)(*a)->_mp_exp, 8);
+	for(int i = 0; i < size; i++){
+		writeLittleEndian(&buffer[BINARY_RECORD_HEADER_BYTES + i * sizeof(mp_limb_t)], (*a)->_mp_d[i], sizeof(mp_limb_t));
+	}
+	file->write(&buffer[0], buffer.size());
+	file->put('\n');
+}
+
+mpf_t* loadMpftBinary(std::ifstream* file) {
+	AssertCondition(file->get() == 'B', "Load of mpf_t failed.");
+	int tag = file->get();
+	if ( tag == 'N' ) {
+		return NULL;
+	}
+	if ( tag == 'P' ) {
+		return GetPlusInfinity();
+	}
+	if ( tag == 'M' ) {
+		return GetMinusInfinity();
+	}
+	if ( tag == 'U' ) {
+		return GetUndefined();
+	}
+	AssertCondition(tag == 'F', "Load of mpf_t failed.");
+	char header[BINARY_RECORD_HEADER_BYTES];
+	file->read(header, BINARY_RECORD_HEADER_BYTES);
+	AssertCondition(file->good() && header[0] == (char)sizeof(mp_limb_t), "Load of mpf_t failed. The limb size of the stored data differs.");
+	int size = (int)(unsigned int)readLittleEndian(&header[1], 4);
+	int prec = (int)(unsigned int)readLittleEndian(&header[5], 4);
+	mp_exp_t exp = (mp_exp_t)(long long)readLittleEndian(&header[9], 8);
+	AssertCondition(prec > 0 && std::abs(size) <= prec + 1, "Load of mpf_t failed.");
+	std::vector<char> limbs(std::abs(size) * sizeof(mp_limb_t) + 1);
+	file->read(&limbs[0], limbs.size() - 1);
+	AssertCondition(file->good(), "Load of mpf_t failed.");
+	mpf_t* a = getResultPointerWithPrecision(prec);
+	(*a)->_mp_size = size;
+	(*a)->_mp_exp = exp;
+	for(int i = 0; i < std::abs(size); i++){
+		(*a)->_mp_d[i] = (mp_limb_t)readLittleEndian(&limbs[i * sizeof(mp_limb_t)], sizeof(mp_limb_t));
+	}
+	return a;
+}
+
 void StoreMpft(mpf_t* a, std::ofstream * file){
+	if(Configuration::getStorageFormat() == configuration::STORAGE_FORMAT_BINARY){
+		storeMpftBinary(a, file);
+		return;
+	}
 	if ( NULL == a ) {
 		(*file) << "NULL" << std::endl;
 	} else if ( IsPlusInfinity(a) ) {
@@ -1655,6 +3249,11 @@ void StoreMpft(mpf_t* a, std::ofstream * file){
 }
 
 mpf_t* LoadMpft(std::ifstream* file){
+	// binary records start with 'B', which is not the first character of any value in the text format
+	(*file) >> std::ws;
+	if(file->peek() == 'B'){
+		return loadMpftBinary(file);
+	}
 	std::string part;
 	(*file) >> part;
 	if ( part == "NULL" ) {
@@ -1669,12 +3268,16 @@ mpf_t* LoadMpft(std::ifstream* file){
 	if ( part == "nan" ) {
 		return GetUndefined();
 	}
-	mpf_t* a = GetResultPointer();
+	int size;
+	int prec;
+	mp_exp_t exp;
 	std::istringstream is_part(part);
-	is_part >> (*a)->_mp_size;
-	(*file) >> (*a)->_mp_prec >> (*a)->_mp_exp;
-	AssertCondition(std::abs((*a)->_mp_size) <= (*a)->_mp_prec + 1, "Load of mpf_t failed.");
-	(*a)->_mp_d = (mp_limb_t*) malloc(((*a)->_mp_prec + 1) * sizeof(mp_limb_t));
+	is_part >> size;
+	(*file) >> prec >> exp;
+	AssertCondition(prec > 0 && std::abs(size) <= prec + 1, "Load of mpf_t failed.");
+	mpf_t* a = getResultPointerWithPrecision(prec);
+	(*a)->_mp_size = size;
+	(*a)->_mp_exp = exp;
 	for(int i = 0; i < std::abs((*a)->_mp_size); i++){
 		(*file) >> (*a)->_mp_d[i];
 	}
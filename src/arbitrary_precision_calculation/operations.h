@@ -40,10 +40,13 @@
 #ifndef ARBITRARY_PRECISION_CALCULATION_OPERATIONS_H_
 #define ARBITRARY_PRECISION_CALCULATION_OPERATIONS_H_
 
+#include <climits>
 #include <gmp.h>
+#include <map>
 #include <string>
 #include <vector>
 
+#include "arbitrary_precision_calculation/configuration.h"
 #include "arbitrary_precision_calculation/random_number_generator.h"
 
 namespace arbitraryprecisioncalculation {
@@ -116,6 +119,62 @@ std::vector<mpf_t*> Multiply(const std::vector<mpf_t*> & a, const double & b);
 */
 std::vector<mpf_t*> Multiply(const std::vector<mpf_t*> & a, mpf_t* b);
 /**
+* @brief Calculates the sine of each element of the vector.
+*
+* The results are the same as the results of mpftoperations::Sin for the single elements.
+* If the fast elementary functions are activated then consecutive elements reuse the scratch registers and the cached constants of the kernels.
+* Otherwise the constants of the argument reduction (multiples of pi) are computed once for the whole vector.
+*
+* @param a The input vector.
+*
+* @return The result vector.
+*/
+std::vector<mpf_t*> Sin(const std::vector<mpf_t*> & a);
+/**
+* @brief Calculates the cosine of each element of the vector.
+*
+* The results are the same as the results of mpftoperations::Cos for the single elements.
+* If the fast elementary functions are activated then consecutive elements reuse the scratch registers and the cached constants of the kernels.
+* Otherwise the constants of the argument reduction (multiples of pi) are computed once for the whole vector.
+*
+* @param a The input vector.
+*
+* @return The result vector.
+*/
+std::vector<mpf_t*> Cos(const std::vector<mpf_t*> & a);
+/**
+* @brief Calculates the exponential function of each element of the vector.
+*
+* The results are the same as the results of mpftoperations::Exp for the single elements.
+* If the fast elementary functions are activated then consecutive elements reuse the scratch registers and the cached constants of the kernels.
+*
+* @param a The input vector.
+*
+* @return The result vector.
+*/
+std::vector<mpf_t*> Exp(const std::vector<mpf_t*> & a);
+/**
+* @brief Calculates the natural logarithm of each element of the vector.
+*
+* The results are the same as the results of mpftoperations::LogE for the single elements.
+* If the fast elementary functions are activated then consecutive elements reuse the scratch registers and the cached constants of the kernels.
+*
+* @param a The input vector.
+*
+* @return The result vector.
+*/
+std::vector<mpf_t*> LogE(const std::vector<mpf_t*> & a);
+/**
+* @brief Calculates the square root of each element of the vector.
+*
+* The results are the same as the results of mpftoperations::Sqrt for the single elements.
+*
+* @param a The input vector.
+*
+* @return The result vector.
+*/
+std::vector<mpf_t*> Sqrt(const std::vector<mpf_t*> & a);
+/**
 * @brief Calculates the sum of the vector entries.
 *
 * @param a The input vector.
@@ -168,6 +227,14 @@ void ReleaseValues(const std::vector<mpf_t*> & a);
 */
 std::vector<mpf_t*> Clone(const std::vector<mpf_t*> & a);
 /**
+* @brief Marks each entry of the vector as exact for the ball arithmetic (see mpftoperations::SetBallRadiusExponent).
+*
+* The state of the swarm (e.g. the positions) is exact by definition, only values which are derived from it carry an error radius.
+*
+* @param a The supplied vector.
+*/
+void MarkExact(const std::vector<mpf_t*> & a);
+/**
 * @brief Randomizes the supplied vector. Each entry will be multiplied by a random mpf_t value in the interval [0,1].
 *
 * @param a The supplied vector.
@@ -184,6 +251,55 @@ std::vector<mpf_t*> Randomize(const std::vector<mpf_t*> & a);
 */
 std::vector<mpf_t*> GetRandomVector(int dimensions);
 /**
+* @brief Stores the specified number of random values in the interval [0,1] in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The random values are generated in order of the entries by the standard random number generator
+* (see RandomNumberGenerator::RandomMpftTo).
+*
+* @param result The destination vector.
+* @param dimensions The number of entries.
+*/
+void FillRandom(std::vector<mpf_t*>* result, int dimensions);
+/**
+* @brief Stores the specified number of random values in the interval [0,1] in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The random values are generated in order of the entries (see RandomNumberGenerator::RandomMpftTo).
+*
+* @param result The destination vector.
+* @param dimensions The number of entries.
+* @param random The random number generator.
+*/
+void FillRandom(std::vector<mpf_t*>* result, int dimensions, RandomNumberGenerator* random);
+/**
+* @brief Stores the specified number of random values with normal distribution in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The values are generated in order of the entries by the standard random number generator.
+* With the polar gaussian algorithm (see configuration::GaussianAlgorithm) both values of each generated pair are used.
+*
+* @param result The destination vector.
+* @param dimensions The number of entries.
+* @param mu The expectation of the normal distribution.
+* @param sigma The standard deviation of the normal distribution.
+*/
+void FillGaussianRandom(std::vector<mpf_t*>* result, int dimensions, double mu, double sigma);
+/**
+* @brief Stores the specified number of random values with normal distribution in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The values are generated in order of the entries.
+* With the polar gaussian algorithm (see configuration::GaussianAlgorithm) both values of each generated pair are used.
+*
+* @param result The destination vector.
+* @param dimensions The number of entries.
+* @param mu The expectation of the normal distribution.
+* @param sigma The standard deviation of the normal distribution.
+* @param random The random number generator.
+*/
+void FillGaussianRandom(std::vector<mpf_t*>* result, int dimensions, double mu, double sigma, RandomNumberGenerator* random);
+/**
 * @brief Converts the values of a vector with mpf_t* entries to a vector with double entries.
 *
 * @param a The vector with mpf_t* entries.
@@ -227,6 +343,155 @@ mpf_t* SquaredEuclideanLength(const std::vector<mpf_t*> & vec);
 * @param vec The vector.
 */
 void Sort(std::vector<mpf_t*>* vec);
+/**
+* @brief Performs element wise addition of the two vectors and stores the result in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The destination vector may be one of the input vectors.
+*
+* @param result The destination vector.
+* @param a The first vector.
+* @param b The second vector.
+*/
+void AddTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b);
+/**
+* @brief Performs element wise subtraction of the two vectors and stores the result in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The destination vector may be one of the input vectors.
+*
+* @param result The destination vector.
+* @param a The first vector.
+* @param b The second vector.
+*/
+void SubtractTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b);
+/**
+* @brief Performs element wise division of the two vectors and stores the result in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The destination vector may be one of the input vectors.
+*
+* @param result The destination vector.
+* @param a The first vector.
+* @param b The second vector.
+*/
+void DivideTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b);
+/**
+* @brief Performs element wise multiplication of the two vectors and stores the result in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The destination vector may be one of the input vectors.
+*
+* @param result The destination vector.
+* @param a The first vector.
+* @param b The second vector.
+*/
+void MultiplyTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b);
+/**
+* @brief Performs for each element in the input vector a multiplication with the specified factor and stores the result in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The destination vector may be the input vector.
+*
+* @param result The destination vector.
+* @param a The input vector.
+* @param b The specified factor.
+*/
+void MultiplyTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const double & b);
+/**
+* @brief Performs for each element in the input vector a multiplication with the specified factor and stores the result in the destination vector.
+*
+* Values which are already stored in the destination vector are reused if possible, otherwise they are released.
+* The destination vector may be the input vector.
+*
+* @param result The destination vector.
+* @param a The input vector.
+* @param b The specified factor.
+*/
+void MultiplyTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a, const mpf_t* b);
+/**
+* @brief Randomizes the supplied vector and stores the result in the destination vector.
+*
+* Each entry will be multiplied by a random mpf_t value in the interval [0,1].
+* The random values are drawn in the same order as by Randomize.
+*
+* @param result The destination vector.
+* @param a The supplied vector.
+*/
+void RandomizeTo(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & a);
+/**
+* @brief Adds the scaled vector x to the vector y in place (y := y + alpha &middot; x).
+*
+* Only one temporary mpf_t value is used for the whole vector.
+*
+* @param y The vector which is updated.
+* @param alpha The scaling factor.
+* @param x The vector which is scaled and added.
+*/
+void AxpyInPlace(std::vector<mpf_t*>* y, const mpf_t* alpha, const std::vector<mpf_t*> & x);
+/**
+* @brief Calculates x + alpha &middot; y element wise and stores the result in the destination vector.
+*
+* Only one temporary mpf_t value is used for the whole vector.
+* The precision checks are executed in the same order as for Add( x, Multiply( y, alpha ) ).
+* The destination vector may be one of the input vectors.
+*
+* @param result The destination vector.
+* @param x The vector which is added.
+* @param alpha The scaling factor.
+* @param y The vector which is scaled.
+*/
+void ScaleAdd(std::vector<mpf_t*>* result, const std::vector<mpf_t*> & x, const mpf_t* alpha, const std::vector<mpf_t*> & y);
+/**
+* @brief Calculates alpha &middot; x + beta &middot; y element wise and stores the result in the destination vector.
+*
+* Only two temporary mpf_t values are used for the whole vector.
+* The destination vector may be one of the input vectors.
+*
+* @param result The destination vector.
+* @param alpha The scaling factor of the first vector.
+* @param x The first vector.
+* @param beta The scaling factor of the second vector.
+* @param y The second vector.
+*/
+void Axpby(std::vector<mpf_t*>* result, const mpf_t* alpha, const std::vector<mpf_t*> & x, const mpf_t* beta, const std::vector<mpf_t*> & y);
+/**
+* @brief Calculates ( alpha &middot; a + beta &middot; b ) + gamma &middot; c element wise and stores the result in the destination vector.
+*
+* Only two temporary mpf_t values are used for the whole vector.
+* In contrast to the composition of vector additions the precision checks of both additions are executed alternately for each entry.
+* The destination vector may be one of the input vectors.
+*
+* @param result The destination vector.
+* @param alpha The scaling factor of the first vector.
+* @param a The first vector.
+* @param beta The scaling factor of the second vector.
+* @param b The second vector.
+* @param gamma The scaling factor of the third vector.
+* @param c The third vector.
+*/
+void LinearCombination3(std::vector<mpf_t*>* result, const mpf_t* alpha, const std::vector<mpf_t*> & a,
+		const mpf_t* beta, const std::vector<mpf_t*> & b, const mpf_t* gamma, const std::vector<mpf_t*> & c);
+/**
+* @brief Calculates the dot product of the two vectors in a single pass.
+*
+* The result is equal to Add( Multiply( a, b ) ), but no temporary vector is created.
+*
+* @param a The first vector.
+* @param b The second vector.
+*
+* @return The dot product.
+*/
+mpf_t* Dot(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b);
+/**
+* @brief Calculates the squared euclidean distance of the two vectors in a single pass.
+*
+* @param a The first vector.
+* @param b The second vector.
+*
+* @return The squared euclidean distance.
+*/
+mpf_t* SquaredDistance(const std::vector<mpf_t*> & a, const std::vector<mpf_t*> & b);
 
 } // namespace vectoroperations
 
@@ -235,6 +500,15 @@ void Sort(std::vector<mpf_t*>* vec);
 */
 namespace mpftoperations {
 
+/**
+* @brief Radius exponent of values without error in the ball arithmetic.
+*/
+const long BALL_RADIUS_EXACT = LONG_MIN;
+/**
+* @brief Radius exponent of values whose error can not be bounded in the ball arithmetic.
+*/
+const long BALL_RADIUS_UNBOUNDED = LONG_MAX;
+
 /**
 * @brief Getter function for the number of mpf_t values which are currently in use.
 *
@@ -242,6 +516,37 @@ namespace mpftoperations {
 */
 int GetNumberOfMpftValuesInUse();
 /**
+* @brief Getter function for the maximal number of mpf_t values which were in use at the same time (high-water mark).
+*
+* @return The maximal number of mpf_t values in use.
+*/
+int GetMaximalNumberOfMpftValuesInUse();
+/**
+* @brief Getter function for the number of released mpf_t values which keep their limb storage for reuse.
+*
+* @return The number of mpf_t values in the pool.
+*/
+int GetNumberOfMpftValuesPooled();
+/**
+* @brief Frees the limb storage of all released mpf_t values which are kept for reuse.
+*/
+void TrimMpftPool();
+/**
+* @brief Activates or deactivates the debug mode of the mpf_t pool.
+*
+* If the debug mode is active then multiple frees on the same mpf_t are detected.
+*
+* @param active The new state of the debug mode.
+*/
+void SetMpftPoolDebugMode(bool active);
+/**
+* @brief Status function for the debug mode of the mpf_t pool.
+*
+* @retval true If multiple frees on the same mpf_t are detected.
+* @retval false otherwise.
+*/
+bool IsMpftPoolDebugModeActive();
+/**
 * @brief Getter function for the number of mpf_t values which are currently cached.
 *
 * @return The number of mpf_t values in cache.
@@ -271,12 +576,106 @@ void StatisticalCalculationsStart();
 */
 void StatisticalCalculationsEnd();
 /**
-* @brief Increases the precision instantly to a higher value.
+* @brief Getter function for the number of precision checks where the exponent based algorithm disagreed with the trial addition.
+*
+* Disagreements are only detected if the check precision algorithm is configuration::CHECK_PRECISION_ALGORITHM_REGRESSION.
+*
+* @return The number of disagreements.
+*/
+int GetNumberOfPrecisionCheckDisagreements();
+/**
+* @brief Executes the precision check of the addition a + b with the specified algorithm.
+*
+* In contrast to the checks on additions the check is executed independently of the check precision mode and probability
+* and the configuration is not modified.
+*
+* @param a The first summand.
+* @param b The second summand.
+* @param algorithm The algorithm which decides whether the precision should be increased.
+*
+* @retval true If the precision check recommends an increase of the precision.
+* @retval false otherwise.
+*/
+bool CheckPrecisionOnAddRecommendsIncrease(const mpf_t* a, const mpf_t* b, configuration::CheckPrecisionAlgorithm algorithm);
+/**
+* @brief Increases the precision of the current context (see Context) instantly to a higher value.
 */
 void IncreasePrecision();
 /**
+* @brief Getter function for the precision of a value.
+*
+* The arithmetic operations (addition, multiplication, division, square root, copies, ...) store their result with
+* the maximum of the precisions of their operands and of the precision of the current context (see Context).
+* Hence values computed in a context with a higher precision do not lose bits in a context with a lower precision.
+* The elementary functions are evaluated with the precision of the current context.
+*
+* @param value The value.
+*
+* @return The precision of the value in bits or 0 if the value is infinite or undefined.
+*/
+unsigned long GetPrecision(const mpf_t* value);
+/**
+* @brief Checks whether two precisions lead to the same results.
+*
+* gmp rounds each precision up to full limbs. Hence all operations yield identical results for two
+* precisions with the same number of limbs. Cached results only need to be recomputed after a change of the precision
+* if the old and the new precision are not equivalent (as long as they do not depend on the precision otherwise,
+* e.g. the number of random bits of GetRandomMpft depends on the precision in bits).
+*
+* @param precision1 The first precision in bits.
+* @param precision2 The second precision in bits.
+*
+* @retval true If all operations yield identical results for both precisions.
+* @retval false otherwise.
+*/
+bool IsEquivalentPrecision(unsigned long precision1, unsigned long precision2);
+/**
+* @brief Upgrades the precision of the value to the precision of the current context (see Context).
+*
+* The value itself is not changed. The limb storage is only reallocated if it is too small.
+* Values with a higher precision, infinite values and undefined values are not modified.
+* Stored values need not be upgraded after an increase of the precision,
+* because the results of operations on them always get the precision of the current context.
+*
+* @param value The value.
+*/
+void UpgradePrecision(mpf_t* value);
+/**
+* @brief Getter function for the error radius of a value in the ball arithmetic.
+*
+* If the check precision mode is CHECK_PRECISION_BALL then each operation bounds the distance of its result
+* to the exact result on the exact operands by 2^r, where r is the radius exponent.
+* The bound includes the errors of the operands and the rounding error of the operation.
+* The radius is not updated in other check precision modes.
+*
+* @param value The value.
+*
+* @return The radius exponent r, BALL_RADIUS_EXACT for exact values or BALL_RADIUS_UNBOUNDED if no bound is known.
+*/
+long GetBallRadiusExponent(const mpf_t* value);
+/**
+* @brief Setter function for the error radius of a value in the ball arithmetic.
+*
+* @param value The value, which is neither infinite nor undefined.
+* @param radius_exponent The radius exponent (see GetBallRadiusExponent).
+*/
+void SetBallRadiusExponent(mpf_t* value, long radius_exponent);
+/**
+* @brief Getter function for the undecidable comparisons in the ball arithmetic.
+*
+* @return The number of undecidable comparisons for each context.
+*/
+const std::map<std::string, long long> & GetUndecidableComparisons();
+/**
+* @brief Forgets all undecidable comparisons.
+*/
+void ResetUndecidableComparisons();
+/**
 * @brief Prepares an mpf_t value for using it.
 *
+* The value has the precision of the current context (see Context) and it is taken from the pool of released values
+* of the current context with matching precision if possible. Only if there is no such value new limb storage is allocated.
+*
 * @return The pointer to the prepared mpf_t.
 */
 mpf_t* GetResultPointer();
@@ -335,9 +734,158 @@ mpf_t* Multiply(const mpf_t* a, const double b);
 */
 mpf_t* Divide(const mpf_t* a, const mpf_t* b);
 /**
+* @brief Stores a + b in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+* The special values and the precision check are handled as in Add.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param a The first value.
+* @param b The second value.
+*/
+void AddTo(mpf_t** result, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Stores a - b in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+* The special values and the precision check are handled as in Subtract.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param a The first value.
+* @param b The second value.
+*/
+void SubtractTo(mpf_t** result, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Stores a &middot; 2<sup>p</sup> in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param a The factor.
+* @param p The exponent.
+*/
+void Multiply2ExpTo(mpf_t** result, const mpf_t* a, int p);
+/**
+* @brief Stores a &middot; b in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param a The first value.
+* @param b The second value.
+*/
+void MultiplyTo(mpf_t** result, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Stores a &middot; b in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+* The double value is converted without allocation of a temporary mpf_t.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param a The first value.
+* @param b The second value.
+*/
+void MultiplyTo(mpf_t** result, const mpf_t* a, const double b);
+/**
+* @brief Stores a / b in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param a The first value.
+* @param b The second value.
+*/
+void DivideTo(mpf_t** result, const mpf_t* a, const mpf_t* b);
+/**
+* @brief Stores the absolute value of the supplied value in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void AbsTo(mpf_t** result, const mpf_t* v);
+/**
+* @brief Stores the negated value of the supplied value in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void NegateTo(mpf_t** result, const mpf_t* v);
+/**
+* @brief Stores a copy of the supplied value in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+* The copy is equal to the result of Clone.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void CopyTo(mpf_t** result, const mpf_t* v);
+/**
+* @brief Stores the supplied double value in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+* The conversion is equal to ToMpft.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void SetTo(mpf_t** result, double v);
+/**
+* @brief Stores the square root of the supplied value in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void SqrtTo(mpf_t** result, const mpf_t* v);
+/**
+* @brief Stores the largest integer which is less or equal to the supplied value in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void FloorTo(mpf_t** result, const mpf_t* v);
+/**
+* @brief Stores the smallest integer which is greater or equal to the supplied value in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void CeilTo(mpf_t** result, const mpf_t* v);
+/**
+* @brief Stores the supplied value multiplied by a random value in the interval [0,1] in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+* The standard random number generator is used.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+*/
+void RandomizeTo(mpf_t** result, const mpf_t* v);
+/**
+* @brief Stores the supplied value multiplied by a random value in the interval [0,1] in the destination.
+*
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL or point to one of the operands.
+* @param v The value.
+* @param random The random number generator.
+*/
+void RandomizeTo(mpf_t** result, const mpf_t* v, RandomNumberGenerator* random);
+/**
 * @brief Releases the reserved memory for the supplied mpf_t.
 *
 * The supplied mpf_t object will be reused soon.
+* Its limb storage is only kept for reuse if it matches the current default precision, otherwise it is freed.
 *
 * @param a The supplied mpf_t.
 */
@@ -374,6 +922,24 @@ mpf_t* Exp(mpf_t* a);
 */
 int Compare(const mpf_t* a, const mpf_t* b);
 /**
+* @brief Compares the two parameters in a decision of the algorithm.
+*
+* If the check precision mode is CHECK_PRECISION_BALL and the error balls of the finite parameters overlap
+* then the comparison is undecidable. In this case an increase of the precision is recommended
+* and the comparison is counted for the context (see GetUndecidableComparisons).
+* Equal parameters are considered decidable, as they usually result from equal calculations.
+* The result is the result of the comparison of the centers in any case.
+*
+* @param a The first parameter.
+* @param b The second parameter.
+* @param context Name of the decision, e.g. the calling function.
+*
+* @retval "< 0" if the first parameter is less than the second parameter.
+* @retval  0 if the two parameters are equal.
+* @retval "> 0" if the first parameter is greater than the second parameter.
+*/
+int Compare(const mpf_t* a, const mpf_t* b, const char* context);
+/**
 * @brief Compares the two parameters.
 *
 * @param a The first parameter.
@@ -396,6 +962,38 @@ int Compare(const double a, const mpf_t* b);
 */
 int Compare(const mpf_t* a, double b);
 /**
+* @brief Compares the first parameter with the double value without creating temporary values.
+*
+* Infinite double values are compared with the representations of +infinity and -infinity.
+*
+* @param a The first parameter.
+* @param b The second parameter.
+*
+* @retval "< 0" if the first parameter is less than the second parameter.
+* @retval  0 if the two parameters are equal.
+* @retval "> 0" if the first parameter is greater than the second parameter.
+*/
+int CompareD(const mpf_t* a, double b);
+/**
+* @brief Calculates the sign of the value without creating temporary values.
+*
+* @param v The value. It must not be undefined.
+*
+* @retval -1 if the value is negative (including -infinity).
+* @retval  0 if the value is zero.
+* @retval  1 if the value is positive (including +infinity).
+*/
+int Sign(const mpf_t* v);
+/**
+* @brief Checks whether the value is zero without creating temporary values.
+*
+* @param v The value. It must not be undefined.
+*
+* @retval true If the value is zero.
+* @retval false otherwise.
+*/
+bool IsZero(const mpf_t* v);
+/**
 * @brief Calculates the representation of +infinity.
 *
 * @return +infinity.
@@ -458,6 +1056,17 @@ bool IsUndefined(const mpf_t* value);
 */
 mpf_t* Sin(mpf_t* x);
 /**
+* @brief Calculates the sine and the cosine of the supplied value at once.
+*
+* If the fast elementary functions are activated then the argument reduction and the series evaluation are shared.
+* Otherwise the results of Sin and Cos are returned.
+*
+* @param x The supplied value.
+* @param sin_result Receives sin( x ).
+* @param cos_result Receives cos( x ).
+*/
+void SinCos(mpf_t* x, mpf_t** sin_result, mpf_t** cos_result);
+/**
 * @brief Calculates the cosine function of the supplied value.
 *
 * @param x The supplied value.
@@ -616,8 +1225,37 @@ mpf_t* GetRandomMpft(RandomNumberGenerator* random);
 */
 mpf_t* GetRandomMpft();
 /**
+* @brief Checks whether additions of finite values are currently checked for a loss of precision.
+*
+* Such checks may draw random values from the standard random number generator (see Configuration::getCheckPrecisionProbability)
+* and may recommend an increase of the precision.
+* Random number generators which generated mpf_t values by additions keep this kind of generation while this function returns true,
+* such that runs behave exactly as in previous versions.
+*
+* @retval true If additions are checked.
+* @retval false otherwise.
+*/
+bool PrecisionChecksOnAdditionsActive();
+/**
+* @brief Stores the fraction which is given by a sequence of random bits in the destination.
+*
+* The words are written straight into the limbs of the destination, hence no arithmetic operations are needed.
+* The stored value is the sum of words[i] &middot; 2<sup>-(i+1) &middot; bits_per_word</sup>,
+* i.e. the first word contains the most significant bits.
+* The value stored in the destination is reused if possible, otherwise it is released.
+*
+* @param result The destination. It may be NULL.
+* @param words The random bits. Each word has to be less than 2<sup>bits_per_word</sup>.
+* @param number_of_words The number of words.
+* @param bits_per_word The number of bits of each word (at least 1 and at most 64).
+*/
+void SetFractionBitsTo(mpf_t** result, const unsigned long long* words, int number_of_words, int bits_per_word);
+/**
 * @brief Calculates a random value with normal distribution (gaussian distribution).
 *
+* The algorithm is selected by the configuration (see configuration::GaussianAlgorithm).
+* The polar algorithm drops the second value of the generated pair, hence vectoroperations::FillGaussianRandom should be preferred for several values.
+*
 * @param mu The expectation of the normal distribution.
 * @param sigma The standard deviation of the normal distribution (this is the square root of the variance).
 * @param random The random number generator.
@@ -628,6 +1266,9 @@ mpf_t* GetGaussianRandomMpft(double mu, double sigma, RandomNumberGenerator* ran
 /**
 * @brief Calculates a random value with normal distribution (gaussian distribution).
 *
+* The algorithm is selected by the configuration (see configuration::GaussianAlgorithm).
+* The polar algorithm drops the second value of the generated pair, hence vectoroperations::FillGaussianRandom should be preferred for several values.
+*
 * @param mu The expectation of the normal distribution.
 * @param sigma The standard deviation of the normal distribution (this is the square root of the variance).
 *
@@ -635,6 +1276,19 @@ mpf_t* GetGaussianRandomMpft(double mu, double sigma, RandomNumberGenerator* ran
 */
 mpf_t* GetGaussianRandomMpft(double mu, double sigma);
 /**
+* @brief Calculates a pair of independent random values with normal distribution (gaussian distribution) by the polar method.
+*
+* A single logarithm, square root and division is needed for both values.
+* The values stored in the destinations are reused if possible, otherwise they are released.
+*
+* @param first The destination of the first value. It may point to NULL.
+* @param second The destination of the second value. It may point to NULL.
+* @param mu The expectation of the normal distribution.
+* @param sigma The standard deviation of the normal distribution (this is the square root of the variance).
+* @param random The random number generator.
+*/
+void GaussianRandomPairTo(mpf_t** first, mpf_t** second, double mu, double sigma, RandomNumberGenerator* random);
+/**
 * @brief Multiplies the supplied value by a random value in the interval [0,1].
 *
 * @param value The supplied value.
@@ -714,15 +1368,41 @@ double Log2Double(mpf_t* value);
 /**
 * @brief Converts an mpf_t value to a string representation of it.
 *
+* The format is specified by Configuration::getOutputFormat.
+* The decimal format equals the output of gmp_printf("%.*Fe") with the output precision (Configuration::getOutputPrecision).
+* If the output precision is -1 then the number of digits is derived from the current precision and trailing zeros are removed.
+* The hexadecimal format represents the value exactly, e.g. -0x1.8p-2 for -0.375, and can be read by HexadecimalStringToMpft.
+* Infinite and undefined values are converted to "inf", "-inf" and "nan".
+* This function can be called concurrently from several threads.
+*
 * @param value The value which should be converted.
 *
 * @return The string representation.
 */
 std::string MpftToString(const mpf_t* value);
+/**
+* @brief Converts the hexadecimal string representation of MpftToString back to an mpf_t value.
+*
+* The result is exact. Its precision is the precision of the current context (see Context)
+* or higher if more bits are necessary to represent all digits.
+*
+* @param value The hexadecimal string representation.
+*
+* @return The recovered value.
+*/
+mpf_t* HexadecimalStringToMpft(const std::string & value);
 
 /**
 * @brief Writes the content of a mpf_t value to the given stream such that it can completely recovered.
 *
+* The format is specified by Configuration::getStorageFormat.
+* The binary format writes a record which starts with the character 'B' followed by a tag character
+* ('N' for NULL, 'P' for plus infinity, 'M' for minus infinity, 'U' for undefined or 'F' for finite values).
+* Finite values continue with the number of bytes per limb (1 byte), the size (4 bytes), the precision (4 bytes),
+* the exponent (8 bytes) and the absolute size many limbs. All numbers are written in little-endian byte order.
+* Like in the text format each record is terminated by a line break.
+* The stream should be opened in binary mode.
+*
 * @param value The mpf_t value.
 * @param stream The stream.
 */
@@ -730,6 +1410,9 @@ void StoreMpft(mpf_t* value, std::ofstream* stream);
 /**
 * @brief Recovers a mpf_t value from an input stream.
 *
+* Values in the text format and in the binary format (see StoreMpft) are recognized automatically.
+* The value is taken from the pool of the current context (see GetResultPointer).
+*
 * @param stream The stream.
 *
 * @return The recovered value.
@@ -180,6 +180,45 @@ RandomNumberGenerator* ParseRandomNumberGenerator(const std::vector<std::string>
 			parsed_parameters = mem_parsed_parameters;
 			return NULL;
 		}
+	} else if(parameter == "xoshiroRNG" || parameter == "pcgRNG") {
+		if(parsed_parameters + 2 > parameters.size()) {
+			parsed_parameters = mem_parsed_parameters;
+			return NULL;
+		}
+		unsigned long long seed, stream;
+		{
+			std::istringstream is(parameters[parsed_parameters++]);
+			if(!(is >> seed)) {
+				parsed_parameters = mem_parsed_parameters;
+				return NULL;
+			}
+		}
+		{
+			std::istringstream is(parameters[parsed_parameters++]);
+			if(!(is >> stream)) {
+				parsed_parameters = mem_parsed_parameters;
+				return NULL;
+			}
+		}
+		if(parameter == "xoshiroRNG") {
+			return new Xoshiro256StarStarRandomNumberGenerator(seed, stream);
+		} else {
+			return new Pcg64RandomNumberGenerator(seed, stream);
+		}
+	} else if(parameter == "philoxRNG") {
+		if(parsed_parameters + 1 > parameters.size()) {
+			parsed_parameters = mem_parsed_parameters;
+			return NULL;
+		}
+		unsigned long long seed;
+		{
+			std::istringstream is(parameters[parsed_parameters++]);
+			if(!(is >> seed)) {
+				parsed_parameters = mem_parsed_parameters;
+				return NULL;
+			}
+		}
+		return new PhiloxRandomNumberGenerator(seed);
 	} else { // try to parse seed
 		unsigned long long seed;
 		std::istringstream is(parameter);
@@ -43,12 +43,111 @@
 #include <sstream>
 
 #include "arbitrary_precision_calculation/check_condition.h"
+#include "arbitrary_precision_calculation/context.h"
 #include "arbitrary_precision_calculation/operations.h"
 
 namespace arbitraryprecisioncalculation {
 
 RandomNumberGenerator::~RandomNumberGenerator(){}
 
+void RandomNumberGenerator::RandomMpftTo(mpf_t** result){
+	mpf_t* value = RandomMpft();
+	mpftoperations::ReleaseValue(*result);
+	*result = value;
+}
+
+void RandomNumberGenerator::SetStream(unsigned long long, unsigned long long, unsigned long long){}
+
+namespace {
+
+// Computes the full 128 bit product of two 64 bit values.
+inline void multiply64(unsigned long long a, unsigned long long b, unsigned long long* high, unsigned long long* low) {
+#ifdef __SIZEOF_INT128__
+	unsigned __int128 product = (unsigned __int128)a * b;
+	*high = (unsigned long long)(product >> 64);
+	*low = (unsigned long long)product;
+#else
+	unsigned long long a0 = a & 0xffffffffULL, a1 = a >> 32;
+	unsigned long long b0 = b & 0xffffffffULL, b1 = b >> 32;
+	unsigned long long p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+	unsigned long long middle = (p00 >> 32) + (p01 & 0xffffffffULL) + (p10 & 0xffffffffULL);
+	*low = (middle << 32) | (p00 & 0xffffffffULL);
+	*high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+#endif
+}
+
+// Computes (a * b) mod 2^128 where both values are given by their high and low 64 bits.
+inline void multiply128(unsigned long long a_high, unsigned long long a_low, unsigned long long b_high, unsigned long long b_low,
+		unsigned long long* high, unsigned long long* low) {
+	unsigned long long product_high;
+	multiply64(a_low, b_low, &product_high, low);
+	*high = product_high + a_low * b_high + a_high * b_low;
+}
+
+// Computes (a + b) mod 2^128 where both values are given by their high and low 64 bits.
+inline void add128(unsigned long long a_high, unsigned long long a_low, unsigned long long b_high, unsigned long long b_low,
+		unsigned long long* high, unsigned long long* low) {
+	*low = a_low + b_low;
+	*high = a_high + b_high + (*low < a_low ? 1 : 0);
+}
+
+// Computes (multiplier * seed + adder) mod modulus for values less than the modulus.
+inline unsigned long long multiplyAddModulo(unsigned long long multiplier, unsigned long long seed, unsigned long long adder, unsigned long long modulus) {
+	unsigned long long high, low;
+	multiply64(multiplier, seed, &high, &low);
+	add128(high, low, 0, adder, &high, &low);
+#ifdef __SIZEOF_INT128__
+	return (unsigned long long)((((unsigned __int128)high << 64) | low) % modulus);
+#else
+	// reduction bit by bit; the intermediate value is less than 2 * modulus <= 2^64
+	unsigned long long remainder = high % modulus;
+	for(int bit = 63; bit >= 0; bit--) {
+		bool overflow = (remainder >> 63) != 0;
+		remainder = (remainder << 1) | ((low >> bit) & 1);
+		if(overflow || remainder >= modulus) remainder -= modulus;
+	}
+	return remainder;
+#endif
+}
+
+inline unsigned long long rotateLeft(unsigned long long value, int bits) {
+	return (value << bits) | (value >> ((64 - bits) & 63));
+}
+
+inline unsigned long long splitMix64(unsigned long long* state) {
+	unsigned long long z = ((*state) += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+// The multiplier of the 128 bit linear congruence of PCG64.
+const unsigned long long PCG64_MULTIPLIER_HIGH = 0x2360ed051fc65da4ULL;
+const unsigned long long PCG64_MULTIPLIER_LOW = 0x4385df649fccf645ULL;
+
+// The stream of the counter based generator which is used before the first selection of a stream.
+const unsigned int PHILOX_INITIAL_ITERATION = 0xffffffffU;
+
+// Encrypts the counter with the key by ten rounds of Philox4x32.
+void philox4x32Rounds(unsigned int counter[4], unsigned int key[2]) {
+	for(int round = 0; round < 10; round++) {
+		if(round > 0) {
+			key[0] += 0x9e3779b9U;
+			key[1] += 0xbb67ae85U;
+		}
+		unsigned long long product0 = (unsigned long long)0xd2511f53U * counter[0];
+		unsigned long long product1 = (unsigned long long)0xcd9e8d57U * counter[2];
+		unsigned int next[4];
+		next[0] = (unsigned int)(product1 >> 32) ^ counter[1] ^ key[0];
+		next[1] = (unsigned int)product1;
+		next[2] = (unsigned int)(product0 >> 32) ^ counter[3] ^ key[1];
+		next[3] = (unsigned int)product0;
+		for(int i = 0; i < 4; i++) counter[i] = next[i];
+	}
+}
+
+} // namespace
+
 FastM2P63LinearCongruenceRandomNumberGenerator::FastM2P63LinearCongruenceRandomNumberGenerator(
 		unsigned long long multiplier,
 		unsigned long long adder,
@@ -57,12 +156,27 @@ FastM2P63LinearCongruenceRandomNumberGenerator::FastM2P63LinearCongruenceRandomN
 
 
 mpf_t* FastM2P63LinearCongruenceRandomNumberGenerator::RandomMpft() {
-	mpf_t* rand_long_long = mpftoperations::ToMpft(RandomLongLong());
-	mpf_t* res = mpftoperations::Multiply2Exp(rand_long_long, -63);
-	mpftoperations::ReleaseValue(rand_long_long);
+	if(mpftoperations::PrecisionChecksOnAdditionsActive()) {
+		// the conversion of the random long long value performs checked additions, which may draw random values
+		mpf_t* rand_long_long = mpftoperations::ToMpft(RandomLongLong());
+		mpf_t* res = mpftoperations::Multiply2Exp(rand_long_long, -63);
+		mpftoperations::ReleaseValue(rand_long_long);
+		return res;
+	}
+	mpf_t* res = NULL;
+	RandomMpftTo(&res);
 	return res;
 }
 
+void FastM2P63LinearCongruenceRandomNumberGenerator::RandomMpftTo(mpf_t** result) {
+	if(mpftoperations::PrecisionChecksOnAdditionsActive()) {
+		RandomNumberGenerator::RandomMpftTo(result);
+		return;
+	}
+	unsigned long long random_bits = (unsigned long long)RandomLongLong();
+	mpftoperations::SetFractionBitsTo(result, &random_bits, 1, 63);
+}
+
 long long FastM2P63LinearCongruenceRandomNumberGenerator::RandomLongLong(){
 	// Overflows are fine because the result is needed modulo 2^63
 	seed_ = (multiplier_ * seed_ + adder_);
@@ -99,15 +213,15 @@ IntenseM2P63LinearCongruenceRandomNumberGenerator::IntenseM2P63LinearCongruenceR
 				multiplier_(multiplier), adder_(adder), initial_seed_(seed), seed_(seed), accept_bits_(accept_bits){}
 
 mpf_t* IntenseM2P63LinearCongruenceRandomNumberGenerator::RandomMpft() {
-	if(accept_bits_ <= 0) {
-		std::cerr << "The number of accepted bits for the random number generator is reseted to 1 because " << accept_bits_ << " is invalid.\n";
-		accept_bits_ = 1;
-	} else if(accept_bits_ > 63) {
-		std::cerr << "The number of accepted bits for the random number generator is reseted to 63 because " << accept_bits_ << " is invalid.\n";
-		accept_bits_ = 63;
+	if(!mpftoperations::PrecisionChecksOnAdditionsActive()) {
+		mpf_t* res = NULL;
+		RandomMpftTo(&res);
+		return res;
 	}
+	validateAcceptBits();
+	// the partial sums are calculated by checked additions
 	mpf_t* res = mpftoperations::ToMpft(0.0);
-	for(int remaining_bits = mpf_get_default_prec(); remaining_bits > 0; remaining_bits -= accept_bits_){
+	for(int remaining_bits = (int)Context::GetCurrent()->GetPrecision(); remaining_bits > 0; remaining_bits -= accept_bits_){
 		long long next_rand = RandomLongLong();
 		next_rand = (next_rand >> (63 - accept_bits_));
 		mpf_t* next_part = mpftoperations::ToMpft(next_rand);
@@ -120,6 +234,32 @@ mpf_t* IntenseM2P63LinearCongruenceRandomNumberGenerator::RandomMpft() {
 	return res;
 }
 
+void IntenseM2P63LinearCongruenceRandomNumberGenerator::validateAcceptBits() {
+	if(accept_bits_ <= 0) {
+		std::cerr << "The number of accepted bits for the random number generator is reseted to 1 because " << accept_bits_ << " is invalid.\n";
+		accept_bits_ = 1;
+	} else if(accept_bits_ > 63) {
+		std::cerr << "The number of accepted bits for the random number generator is reseted to 63 because " << accept_bits_ << " is invalid.\n";
+		accept_bits_ = 63;
+	}
+}
+
+void IntenseM2P63LinearCongruenceRandomNumberGenerator::RandomMpftTo(mpf_t** result) {
+	if(mpftoperations::PrecisionChecksOnAdditionsActive()) {
+		RandomNumberGenerator::RandomMpftTo(result);
+		return;
+	}
+	validateAcceptBits();
+	int precision = (int)Context::GetCurrent()->GetPrecision();
+	int number_of_words = (precision > 0) ? (precision + accept_bits_ - 1) / accept_bits_ : 0;
+	random_bits_.resize(number_of_words);
+	// the bits of later calls are more significant
+	for(int i = number_of_words - 1; i >= 0; i--){
+		random_bits_[i] = ((unsigned long long)RandomLongLong()) >> (63 - accept_bits_);
+	}
+	mpftoperations::SetFractionBitsTo(result, random_bits_.data(), number_of_words, accept_bits_);
+}
+
 long long IntenseM2P63LinearCongruenceRandomNumberGenerator::RandomLongLong(){
 	// Overflows are fine because the result is needed modulo 2^63
 	seed_ = (multiplier_ * seed_ + adder_);
@@ -152,7 +292,16 @@ FastLinearCongruenceRandomNumberGenerator::FastLinearCongruenceRandomNumberGener
 		unsigned long long adder,
 		unsigned long long modulus,
 		unsigned long long seed) :
-				multiplier_(multiplier), adder_(adder), modulus_(modulus), initial_seed_(seed), seed_(seed){}
+				multiplier_(multiplier), adder_(adder), modulus_(modulus), initial_seed_(seed), seed_(seed){
+	if(modulus_ > (1ULL << 63)){
+		std::cerr << "The modulus is to large. It is reseted to 2^63=" << (1ULL << 63) << ".\n";
+		modulus_ = (1ULL << 63);
+	}
+	AssertCondition(modulus_ > 0, "The modulus of the random number generator has to be positive.");
+	adder_ %= modulus_;
+	multiplier_ %= modulus_;
+	seed_ %= modulus_;
+}
 
 mpf_t* FastLinearCongruenceRandomNumberGenerator::RandomMpft() {
 	mpf_t* rand_long_long = mpftoperations::ToMpft(RandomLongLong());
@@ -164,32 +313,14 @@ mpf_t* FastLinearCongruenceRandomNumberGenerator::RandomMpft() {
 }
 
 long long FastLinearCongruenceRandomNumberGenerator::RandomLongLong(){
-	if(modulus_ > (1ULL << 63)){
-		std::cerr << "The modulus is to large. It is reseted to 2^63=" << (1ULL << 63) << ".\n";
-		modulus_ = (1ULL << 63);
-	}
-
-	if(adder_ >= modulus_) adder_ %= modulus_;
-	if(multiplier_ >= modulus_) multiplier_ %= modulus_;
-	if(seed_ >= modulus_) seed_ %= modulus_;
-
-	unsigned long long next_seed = adder_;
-	for(unsigned long long remaining_multiplier = multiplier_; remaining_multiplier > 0; remaining_multiplier /= 2) {
-		if(remaining_multiplier % 2 == 1){
-			next_seed += seed_;
-			if(next_seed >= modulus_)next_seed -= modulus_;
-			AssertCondition(next_seed < modulus_, "Modulo calculations of random number generator failed.");
-		}
-		seed_ = (seed_ + seed_);
-		if(seed_ >= modulus_) seed_ -= modulus_;
-		AssertCondition(seed_ < modulus_, "Modulo calculations of random number generator failed.");
-	}
-	seed_ = next_seed;
+	// the parameters are reduced modulo the modulus by the constructor
+	seed_ = multiplyAddModulo(multiplier_, seed_, adder_, modulus_);
 	return (long long) seed_;
 }
 
 void FastLinearCongruenceRandomNumberGenerator::LoadData(std::ifstream* inputstream){
 	(*inputstream) >> seed_;
+	seed_ %= modulus_;
 }
 void FastLinearCongruenceRandomNumberGenerator::StoreData(std::ofstream* outputstream){
 	(*outputstream) << seed_ << std::endl;
@@ -213,7 +344,16 @@ IntenseLinearCongruenceRandomNumberGenerator::IntenseLinearCongruenceRandomNumbe
 		unsigned long long adder,
 		unsigned long long modulus,
 		unsigned long long seed) :
-				multiplier_(multiplier), adder_(adder), modulus_(modulus), initial_seed_(seed), seed_(seed){}
+				multiplier_(multiplier), adder_(adder), modulus_(modulus), initial_seed_(seed), seed_(seed){
+	if(modulus_ > (1ULL << 63)){
+		std::cerr << "The modulus is to large. It is reseted to 2^63=" << (1ULL << 63) << ".\n";
+		modulus_ = (1ULL << 63);
+	}
+	AssertCondition(modulus_ > 0, "The modulus of the random number generator has to be positive.");
+	adder_ %= modulus_;
+	multiplier_ %= modulus_;
+	seed_ %= modulus_;
+}
 
 mpf_t* IntenseLinearCongruenceRandomNumberGenerator::RandomMpft() {
 	mpf_t* res = mpftoperations::ToMpft(0.0);
@@ -222,7 +362,7 @@ mpf_t* IntenseLinearCongruenceRandomNumberGenerator::RandomMpft() {
 	while(bits_per_iteration < 63 && (modulus_ >> (bits_per_iteration + 1)) > 0){
 		++bits_per_iteration;
 	}
-	int iterations = (mpf_get_default_prec() / bits_per_iteration) + 1;
+	int iterations = ((int)Context::GetCurrent()->GetPrecision() / bits_per_iteration) + 1;
 	for(int i = 0; i < iterations; i++){
 		long long next_rand = RandomLongLong();
 		mpf_t* next_part = mpftoperations::ToMpft(next_rand);
@@ -237,30 +377,14 @@ mpf_t* IntenseLinearCongruenceRandomNumberGenerator::RandomMpft() {
 }
 
 long long IntenseLinearCongruenceRandomNumberGenerator::RandomLongLong(){
-	if(modulus_ > (1ULL << 63)){
-		std::cerr << "The modulus is to large. It is reseted to 2^63=" << (1ULL << 63) << ".\n";
-		modulus_ = (1ULL << 63);
-	}
-
-	if(adder_ >= modulus_) adder_ %= modulus_;
-	if(multiplier_ >= modulus_) multiplier_ %= modulus_;
-	if(seed_ >= modulus_) seed_ %= modulus_;
-
-	unsigned long long next_seed = adder_;
-	for(unsigned long long remaining_multiplier = multiplier_; remaining_multiplier > 0; remaining_multiplier /= 2) {
-		if(remaining_multiplier % 2 == 1){
-			next_seed += seed_;
-			if(next_seed >= modulus_)next_seed -= modulus_;
-		}
-		seed_ = (seed_ + seed_);
-		if(seed_ >= modulus_) seed_ -= modulus_;
-	}
-	seed_ = next_seed;
+	// the parameters are reduced modulo the modulus by the constructor
+	seed_ = multiplyAddModulo(multiplier_, seed_, adder_, modulus_);
 	return (long long) seed_;
 }
 
 void IntenseLinearCongruenceRandomNumberGenerator::LoadData(std::ifstream* inputstream){
 	(*inputstream) >> seed_;
+	seed_ %= modulus_;
 }
 void IntenseLinearCongruenceRandomNumberGenerator::StoreData(std::ofstream* outputstream){
 	(*outputstream) << seed_ << std::endl;
@@ -279,4 +403,232 @@ std::string IntenseLinearCongruenceRandomNumberGenerator::GetName(){
 	return os.str();
 }
 
+Xoshiro256StarStarRandomNumberGenerator::Xoshiro256StarStarRandomNumberGenerator(
+		unsigned long long seed,
+		unsigned long long stream) :
+				initial_seed_(seed), stream_(stream) {
+	unsigned long long splitmix_state = seed;
+	for(int i = 0; i < 4; i++){
+		state_[i] = splitMix64(&splitmix_state);
+	}
+	for(unsigned long long i = 0; i < stream; i++){
+		Jump();
+	}
+}
+
+mpf_t* Xoshiro256StarStarRandomNumberGenerator::RandomMpft() {
+	mpf_t* res = NULL;
+	RandomMpftTo(&res);
+	return res;
+}
+
+void Xoshiro256StarStarRandomNumberGenerator::RandomMpftTo(mpf_t** result) {
+	random_bits_.resize((Context::GetCurrent()->GetPrecision() + 63) / 64);
+	for(unsigned int i = 0; i < random_bits_.size(); i++){
+		random_bits_[i] = next();
+	}
+	mpftoperations::SetFractionBitsTo(result, random_bits_.data(), random_bits_.size(), 64);
+}
+
+long long Xoshiro256StarStarRandomNumberGenerator::RandomLongLong(){
+	return (long long) (next() >> 1);
+}
+
+unsigned long long Xoshiro256StarStarRandomNumberGenerator::next(){
+	unsigned long long result = rotateLeft(state_[1] * 5, 7) * 9;
+	unsigned long long t = state_[1] << 17;
+	state_[2] ^= state_[0];
+	state_[3] ^= state_[1];
+	state_[1] ^= state_[2];
+	state_[0] ^= state_[3];
+	state_[2] ^= t;
+	state_[3] = rotateLeft(state_[3], 45);
+	return result;
+}
+
+void Xoshiro256StarStarRandomNumberGenerator::Jump(){
+	static const unsigned long long jump_polynomial[4] =
+			{0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+	unsigned long long jumped_state[4] = {0, 0, 0, 0};
+	for(int i = 0; i < 4; i++){
+		for(int bit = 0; bit < 64; bit++){
+			if(jump_polynomial[i] & (1ULL << bit)){
+				for(int j = 0; j < 4; j++) jumped_state[j] ^= state_[j];
+			}
+			next();
+		}
+	}
+	for(int j = 0; j < 4; j++) state_[j] = jumped_state[j];
+}
+
+void Xoshiro256StarStarRandomNumberGenerator::LoadData(std::ifstream* inputstream){
+	for(int i = 0; i < 4; i++){
+		(*inputstream) >> state_[i];
+	}
+}
+void Xoshiro256StarStarRandomNumberGenerator::StoreData(std::ofstream* outputstream){
+	(*outputstream) << state_[0] << " " << state_[1] << " " << state_[2] << " " << state_[3] << std::endl;
+}
+
+std::string Xoshiro256StarStarRandomNumberGenerator::GetName(){
+	std::ostringstream os;
+	os << "XRNG_Seed";
+	int minimalseedfigures = 4;
+	unsigned long long mul = 10;
+	for(int i = 1; i < minimalseedfigures; i++){
+		if(initial_seed_ < mul)os << "0";
+		mul *= 10;
+	}
+	os << initial_seed_;
+	if(stream_ != 0) os << "_Stream" << stream_;
+	return os.str();
+}
+
+Pcg64RandomNumberGenerator::Pcg64RandomNumberGenerator(
+		unsigned long long seed,
+		unsigned long long stream) :
+				initial_seed_(seed), stream_(stream), state_high_(0), state_low_(0) {
+	// initialization as by pcg_setseq_128_srandom_r of the reference implementation
+	increment_high_ = stream >> 63;
+	increment_low_ = (stream << 1) | 1;
+	step();
+	add128(state_high_, state_low_, 0, seed, &state_high_, &state_low_);
+	step();
+}
+
+mpf_t* Pcg64RandomNumberGenerator::RandomMpft() {
+	mpf_t* res = NULL;
+	RandomMpftTo(&res);
+	return res;
+}
+
+void Pcg64RandomNumberGenerator::RandomMpftTo(mpf_t** result) {
+	random_bits_.resize((Context::GetCurrent()->GetPrecision() + 63) / 64);
+	for(unsigned int i = 0; i < random_bits_.size(); i++){
+		random_bits_[i] = next();
+	}
+	mpftoperations::SetFractionBitsTo(result, random_bits_.data(), random_bits_.size(), 64);
+}
+
+long long Pcg64RandomNumberGenerator::RandomLongLong(){
+	return (long long) (next() >> 1);
+}
+
+void Pcg64RandomNumberGenerator::step(){
+	multiply128(state_high_, state_low_, PCG64_MULTIPLIER_HIGH, PCG64_MULTIPLIER_LOW, &state_high_, &state_low_);
+	add128(state_high_, state_low_, increment_high_, increment_low_, &state_high_, &state_low_);
+}
+
+unsigned long long Pcg64RandomNumberGenerator::next(){
+	step();
+	// output function XSL RR: xor of both halves rotated by the highest 6 bits
+	unsigned long long value = state_high_ ^ state_low_;
+	int rotation = (int)(state_high_ >> 58);
+	return (value >> rotation) | (value << ((64 - rotation) & 63));
+}
+
+void Pcg64RandomNumberGenerator::Jump(){
+	// the linear congruence is advanced by 2^64 steps by repeated squaring (see pcg_advance_lcg_128)
+	unsigned long long multiplier_high = PCG64_MULTIPLIER_HIGH, multiplier_low = PCG64_MULTIPLIER_LOW;
+	unsigned long long adder_high = increment_high_, adder_low = increment_low_;
+	for(int bit = 0; bit < 64; bit++){
+		unsigned long long next_adder_high, next_adder_low;
+		add128(multiplier_high, multiplier_low, 0, 1, &next_adder_high, &next_adder_low);
+		multiply128(next_adder_high, next_adder_low, adder_high, adder_low, &adder_high, &adder_low);
+		multiply128(multiplier_high, multiplier_low, multiplier_high, multiplier_low, &multiplier_high, &multiplier_low);
+	}
+	multiply128(multiplier_high, multiplier_low, state_high_, state_low_, &state_high_, &state_low_);
+	add128(state_high_, state_low_, adder_high, adder_low, &state_high_, &state_low_);
+}
+
+void Pcg64RandomNumberGenerator::LoadData(std::ifstream* inputstream){
+	(*inputstream) >> state_high_ >> state_low_ >> increment_high_ >> increment_low_;
+}
+void Pcg64RandomNumberGenerator::StoreData(std::ofstream* outputstream){
+	(*outputstream) << state_high_ << " " << state_low_ << " " << increment_high_ << " " << increment_low_ << std::endl;
+}
+
+std::string Pcg64RandomNumberGenerator::GetName(){
+	std::ostringstream os;
+	os << "PCGRNG_Seed";
+	int minimalseedfigures = 4;
+	unsigned long long mul = 10;
+	for(int i = 1; i < minimalseedfigures; i++){
+		if(initial_seed_ < mul)os << "0";
+		mul *= 10;
+	}
+	os << initial_seed_;
+	if(stream_ != 0) os << "_Stream" << stream_;
+	return os.str();
+}
+
+PhiloxRandomNumberGenerator::PhiloxRandomNumberGenerator(unsigned long long seed) :
+		initial_seed_(seed), particle_(0), dimension_(0), iteration_(PHILOX_INITIAL_ITERATION),
+		drawn_values_(0), cached_block_(0), cached_block_valid_(false) {
+	cached_values_[0] = cached_values_[1] = 0;
+}
+
+mpf_t* PhiloxRandomNumberGenerator::RandomMpft() {
+	mpf_t* res = NULL;
+	RandomMpftTo(&res);
+	return res;
+}
+
+void PhiloxRandomNumberGenerator::RandomMpftTo(mpf_t** result) {
+	random_bits_.resize((Context::GetCurrent()->GetPrecision() + 63) / 64);
+	for(unsigned int i = 0; i < random_bits_.size(); i++){
+		random_bits_[i] = next();
+	}
+	mpftoperations::SetFractionBitsTo(result, random_bits_.data(), random_bits_.size(), 64);
+}
+
+long long PhiloxRandomNumberGenerator::RandomLongLong(){
+	return (long long) (next() >> 1);
+}
+
+unsigned long long PhiloxRandomNumberGenerator::next(){
+	// each block of the counter yields two 64 bit values
+	unsigned long long block = drawn_values_ / 2;
+	if(!cached_block_valid_ || cached_block_ != block){
+		AssertCondition(block <= 0xffffffffULL, "The stream of the counter based random number generator is exhausted.");
+		unsigned int counter[4] = {(unsigned int)block, dimension_, particle_, iteration_};
+		unsigned int key[2] = {(unsigned int)initial_seed_, (unsigned int)(initial_seed_ >> 32)};
+		philox4x32Rounds(counter, key);
+		cached_values_[0] = ((unsigned long long)counter[1] << 32) | counter[0];
+		cached_values_[1] = ((unsigned long long)counter[3] << 32) | counter[2];
+		cached_block_ = block;
+		cached_block_valid_ = true;
+	}
+	return cached_values_[drawn_values_++ % 2];
+}
+
+void PhiloxRandomNumberGenerator::SetStream(unsigned long long particle, unsigned long long dimension, unsigned long long iteration){
+	particle_ = (unsigned int)particle;
+	dimension_ = (unsigned int)dimension;
+	iteration_ = (unsigned int)iteration;
+	drawn_values_ = 0;
+	cached_block_valid_ = false;
+}
+
+void PhiloxRandomNumberGenerator::LoadData(std::ifstream* inputstream){
+	(*inputstream) >> particle_ >> dimension_ >> iteration_ >> drawn_values_;
+	cached_block_valid_ = false;
+}
+void PhiloxRandomNumberGenerator::StoreData(std::ofstream* outputstream){
+	(*outputstream) << particle_ << " " << dimension_ << " " << iteration_ << " " << drawn_values_ << std::endl;
+}
+
+std::string PhiloxRandomNumberGenerator::GetName(){
+	std::ostringstream os;
+	os << "PHRNG_Seed";
+	int minimalseedfigures = 4;
+	unsigned long long mul = 10;
+	for(int i = 1; i < minimalseedfigures; i++){
+		if(initial_seed_ < mul)os << "0";
+		mul *= 10;
+	}
+	os << initial_seed_;
+	return os.str();
+}
+
 } // namespace arbitraryprecisioncalculation
@@ -43,6 +43,7 @@
 #include <fstream>
 #include <gmp.h>
 #include <string>
+#include <vector>
 
 namespace arbitraryprecisioncalculation {
 
@@ -62,6 +63,17 @@ public:
 	*/
 	virtual mpf_t* RandomMpft() = 0;
 	/**
+	* @brief Stores a random mpf_t value in the interval [0,1] in the destination.
+	*
+	* The value stored in the destination is reused if possible, otherwise it is released.
+	* Random number generators which produce uniformly distributed bits write them straight into the limbs of the destination
+	* (see mpftoperations::SetFractionBitsTo). The default implementation stores the result of RandomMpft.
+	* In any case the same value as by RandomMpft is generated.
+	*
+	* @param result The destination. It may be NULL.
+	*/
+	virtual void RandomMpftTo(mpf_t** result);
+	/**
 	* @brief Creates a random long long value.
 	*
 	* @return The random value.
@@ -87,6 +99,18 @@ public:
 	* @return The name of the object.
 	*/
 	virtual std::string GetName() = 0;
+	/**
+	* @brief Selects the stream of random values which is used for the given particle, dimension and iteration.
+	*
+	* Counter based random number generators derive all subsequent random values from the seed and these identifiers only.
+	* Hence the random values used for an update do not depend on the order in which the updates are executed.
+	* The default implementation ignores the call such that sequential random number generators continue their sequence.
+	*
+	* @param particle The index of the particle.
+	* @param dimension The index of the dimension.
+	* @param iteration The iteration.
+	*/
+	virtual void SetStream(unsigned long long particle, unsigned long long dimension, unsigned long long iteration);
 };
 
 /**
@@ -112,6 +136,15 @@ public:
 	*/
 	mpf_t* RandomMpft();
 	/**
+	* @brief Stores a random mpf_t value in the interval [0,1] in the destination.
+	*
+	* The 63 bits of the random long long value are written straight into the limbs of the destination
+	* unless additions are checked for a loss of precision (see mpftoperations::PrecisionChecksOnAdditionsActive).
+	*
+	* @param result The destination. It may be NULL.
+	*/
+	void RandomMpftTo(mpf_t** result);
+	/**
 	* @brief Creates a random long long value.
 	*
 	* Calculates the next random by the equation (adder + multiplier &middot; S) mod 2<sup>63</sup>,
@@ -158,6 +191,15 @@ public:
 	*/
 	mpf_t* RandomMpft();
 	/**
+	* @brief Stores a random mpf_t value in the interval [0,1] in the destination.
+	*
+	* The used bits of all calls of the random long long function are written straight into the limbs of the destination
+	* unless additions are checked for a loss of precision (see mpftoperations::PrecisionChecksOnAdditionsActive).
+	*
+	* @param result The destination. It may be NULL.
+	*/
+	void RandomMpftTo(mpf_t** result);
+	/**
 	* @brief Creates a random long long value.
 	*
 	* Calculates the next random by the equation (adder + multiplier &middot; S) mod 2<sup>63</sup>,
@@ -174,11 +216,14 @@ public:
 	std::string GetName();
 
 private:
+	void validateAcceptBits();
+
 	const unsigned long long multiplier_;
 	const unsigned long long adder_;
 	const unsigned long long initial_seed_;
 	unsigned long long seed_;
 	int accept_bits_;
+	std::vector<unsigned long long> random_bits_;
 };
 
 /**
@@ -273,6 +318,197 @@ private:
 	unsigned long long seed_;
 };
 
+/**
+* @brief This is the random number generator xoshiro256** of Blackman and Vigna.
+*
+* It has a period of 2<sup>256</sup>-1 and supports jumps over 2<sup>128</sup> values,
+* which split the sequence into non overlapping streams.
+*/
+class Xoshiro256StarStarRandomNumberGenerator : public RandomNumberGenerator {
+public:
+	/**
+	* @brief The constructor.
+	*
+	* The state is initialized from the seed by the generator splitmix64.
+	*
+	* @param seed The initial seed of the random number generator.
+	* @param stream The number of jumps which are executed after initialization.
+	*/
+	Xoshiro256StarStarRandomNumberGenerator(unsigned long long seed, unsigned long long stream);
+	/**
+	* @brief Creates a random mpf_t value in the interval [0,1].
+	*
+	* All bits of the result are random. They are generated by 64 bit outputs of the generator (see RandomMpftTo).
+	*
+	* @return The random value.
+	*/
+	mpf_t* RandomMpft();
+	/**
+	* @brief Stores a random mpf_t value in the interval [0,1] in the destination.
+	*
+	* 64 bit outputs of the generator are written straight into the limbs of the destination until all bits of the current precision are random.
+	*
+	* @param result The destination. It may be NULL.
+	*/
+	void RandomMpftTo(mpf_t** result);
+	/**
+	* @brief Creates a random long long value.
+	*
+	* Returns the highest 63 bits of the next output of the generator.
+	*
+	* @return The random value.
+	*/
+	long long RandomLongLong();
+	/**
+	* @brief Advances the state by 2<sup>128</sup> values.
+	*/
+	void Jump();
+
+	void LoadData(std::ifstream*);
+	void StoreData(std::ofstream*);
+	std::string GetName();
+
+private:
+	unsigned long long next();
+
+	const unsigned long long initial_seed_;
+	const unsigned long long stream_;
+	unsigned long long state_[4];
+	std::vector<unsigned long long> random_bits_;
+};
+
+/**
+* @brief This is the permuted congruential generator PCG64 (XSL RR 128/64) of O'Neill.
+*
+* The 128 bit linear congruence is advanced in logarithmic time, which allows jumps over 2<sup>64</sup> values.
+* Additionally each stream uses its own increment, such that different streams are independent sequences.
+*/
+class Pcg64RandomNumberGenerator : public RandomNumberGenerator {
+public:
+	/**
+	* @brief The constructor.
+	*
+	* @param seed The initial seed of the random number generator.
+	* @param stream The stream which determines the increment of the linear congruence.
+	*/
+	Pcg64RandomNumberGenerator(unsigned long long seed, unsigned long long stream);
+	/**
+	* @brief Creates a random mpf_t value in the interval [0,1].
+	*
+	* All bits of the result are random. They are generated by 64 bit outputs of the generator (see RandomMpftTo).
+	*
+	* @return The random value.
+	*/
+	mpf_t* RandomMpft();
+	/**
+	* @brief Stores a random mpf_t value in the interval [0,1] in the destination.
+	*
+	* 64 bit outputs of the generator are written straight into the limbs of the destination until all bits of the current precision are random.
+	*
+	* @param result The destination. It may be NULL.
+	*/
+	void RandomMpftTo(mpf_t** result);
+	/**
+	* @brief Creates a random long long value.
+	*
+	* Returns the highest 63 bits of the next output of the generator.
+	*
+	* @return The random value.
+	*/
+	long long RandomLongLong();
+	/**
+	* @brief Advances the state by 2<sup>64</sup> values.
+	*/
+	void Jump();
+
+	void LoadData(std::ifstream*);
+	void StoreData(std::ofstream*);
+	std::string GetName();
+
+private:
+	unsigned long long next();
+	void step();
+
+	const unsigned long long initial_seed_;
+	const unsigned long long stream_;
+	unsigned long long state_high_;
+	unsigned long long state_low_;
+	unsigned long long increment_high_;
+	unsigned long long increment_low_;
+	std::vector<unsigned long long> random_bits_;
+};
+
+/**
+* @brief This is the counter based random number generator Philox4x32-10 of Salmon et al.
+*
+* Each random value is the encryption of a counter with the seed as key.
+* The counter consists of the iteration, the particle, the dimension (see SetStream) and the index of the value within this stream.
+* Therefore the random values used for a particle update do not depend on the updates of other particles.
+*/
+class PhiloxRandomNumberGenerator : public RandomNumberGenerator {
+public:
+	/**
+	* @brief The constructor.
+	*
+	* Until the first call of SetStream the values are taken from the stream with iteration 2<sup>32</sup>-1,
+	* which is not used by any iteration of a run.
+	*
+	* @param seed The initial seed of the random number generator.
+	*/
+	PhiloxRandomNumberGenerator(unsigned long long seed);
+	/**
+	* @brief Creates a random mpf_t value in the interval [0,1].
+	*
+	* All bits of the result are random. They are generated by 64 bit outputs of the generator (see RandomMpftTo).
+	*
+	* @return The random value.
+	*/
+	mpf_t* RandomMpft();
+	/**
+	* @brief Stores a random mpf_t value in the interval [0,1] in the destination.
+	*
+	* 64 bit outputs of the generator are written straight into the limbs of the destination until all bits of the current precision are random.
+	*
+	* @param result The destination. It may be NULL.
+	*/
+	void RandomMpftTo(mpf_t** result);
+	/**
+	* @brief Creates a random long long value.
+	*
+	* Returns the highest 63 bits of the next 64 bits of the current stream.
+	*
+	* @return The random value.
+	*/
+	long long RandomLongLong();
+	/**
+	* @brief Selects the stream of random values which is used for the given particle, dimension and iteration.
+	*
+	* Only the lowest 32 bits of each identifier are used.
+	*
+	* @param particle The index of the particle.
+	* @param dimension The index of the dimension.
+	* @param iteration The iteration.
+	*/
+	void SetStream(unsigned long long particle, unsigned long long dimension, unsigned long long iteration);
+
+	void LoadData(std::ifstream*);
+	void StoreData(std::ofstream*);
+	std::string GetName();
+
+private:
+	unsigned long long next();
+
+	const unsigned long long initial_seed_;
+	unsigned int particle_;
+	unsigned int dimension_;
+	unsigned int iteration_;
+	unsigned long long drawn_values_;
+	unsigned long long cached_block_;
+	bool cached_block_valid_;
+	unsigned long long cached_values_[2];
+	std::vector<unsigned long long> random_bits_;
+};
+
 } // namespace arbitraryprecisioncalculation
 
 #endif /* ARBITRARY_PRECISION_CALCULATION_RANDOM_NUMBER_GENERATOR_H_ */
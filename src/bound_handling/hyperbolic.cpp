@@ -41,19 +41,21 @@
 
 #include "function/function.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 
 namespace highprecisionpso {
 
 void BoundHandlingHyperbolic::SetParticleUpdate(Particle * p){
-	std::vector<mpf_t*> oldPos = p->GetPosition();
-	std::vector<mpf_t*> vel = p->GetVelocity();
-	std::vector<mpf_t*> low_position = configuration::g_function->GetLowerSearchSpaceBound();
-	std::vector<mpf_t*> high_position = configuration::g_function->GetUpperSearchSpaceBound();
+	arbitraryprecisioncalculation::MpfVector oldPos = p->GetPosition();
+	arbitraryprecisioncalculation::MpfVector vel = p->GetVelocity();
+	arbitraryprecisioncalculation::MpfVector low_position = configuration::g_function->GetLowerSearchSpaceBound();
+	arbitraryprecisioncalculation::MpfVector high_position = configuration::g_function->GetUpperSearchSpaceBound();
+	std::vector<mpf_t*> newVel(vel.size(), (mpf_t*) NULL);
 	for(unsigned int d = 0; d < vel.size(); d++){
 		mpf_t* dif = (mpf_t*) NULL;
-		if(arbitraryprecisioncalculation::mpftoperations::Compare(vel[d], 0.0) > 0) {
+		if(arbitraryprecisioncalculation::mpftoperations::Sign(vel[d]) > 0) {
 			dif = arbitraryprecisioncalculation::mpftoperations::Subtract(high_position[d], oldPos[d]);
 		} else {
 			dif = arbitraryprecisioncalculation::mpftoperations::Subtract(low_position[d], oldPos[d]);
@@ -62,25 +64,18 @@ void BoundHandlingHyperbolic::SetParticleUpdate(Particle * p){
 		mpf_t* tmp2 = arbitraryprecisioncalculation::mpftoperations::Abs(tmp1);
 		mpf_t* n1 = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
 		mpf_t* denominator = arbitraryprecisioncalculation::mpftoperations::Add(tmp2, n1);
-		mpf_t* new_vel = arbitraryprecisioncalculation::mpftoperations::Divide(vel[d], denominator);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(vel[d]);
-		vel[d] = new_vel;
+		newVel[d] = arbitraryprecisioncalculation::mpftoperations::Divide(vel[d], denominator);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(n1);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(dif);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tmp1);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tmp2);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(denominator);
 	}
-	p->SetVelocity(vel);
-	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos, vel);
-	p->SetPosition(newPos);
+	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos.Get(), newVel);
+	p->SetVelocity(arbitraryprecisioncalculation::MpfVector::Adopt(newVel));
+	p->SetPosition(arbitraryprecisioncalculation::MpfVector::Adopt(newPos));
 	// There is no velocity adjustment because this bound handling strategy already
 	// adjusts the velocity.
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(low_position);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(high_position);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(vel);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newPos);
 }
 
 std::string BoundHandlingHyperbolic::GetName(){
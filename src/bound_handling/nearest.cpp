@@ -41,6 +41,7 @@
 
 #include "function/function.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 #include "velocity_adjustment/velocity_adjustment.h"
@@ -48,11 +49,11 @@
 namespace highprecisionpso {
 
 void BoundHandlingNearest::SetParticleUpdate(Particle * p){
-	std::vector<mpf_t*> oldPos = p->GetPosition();
-	std::vector<mpf_t*> vel = p->GetVelocity();
-	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos, vel);
-	std::vector<mpf_t*> low_position = configuration::g_function->GetLowerSearchSpaceBound();
-	std::vector<mpf_t*> high_position = configuration::g_function->GetUpperSearchSpaceBound();
+	arbitraryprecisioncalculation::MpfVector oldPos = p->GetPosition();
+	arbitraryprecisioncalculation::MpfVector vel = p->GetVelocity();
+	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos.Get(), vel.Get());
+	arbitraryprecisioncalculation::MpfVector low_position = configuration::g_function->GetLowerSearchSpaceBound();
+	arbitraryprecisioncalculation::MpfVector high_position = configuration::g_function->GetUpperSearchSpaceBound();
 	std::vector<bool> modifiedDimensions(newPos.size(), false);
 	for(unsigned int d = 0; d < newPos.size(); d++){
 		if(arbitraryprecisioncalculation::mpftoperations::Compare(newPos[d], low_position[d]) < 0) {
@@ -66,13 +67,8 @@ void BoundHandlingNearest::SetParticleUpdate(Particle * p){
 			newPos[d] = arbitraryprecisioncalculation::mpftoperations::Clone(high_position[d]);
 		}
 	}
-	p->SetPosition(newPos);
-	configuration::g_velocity_adjustment->AdjustVelocity(p, modifiedDimensions, oldPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(low_position);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(high_position);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(vel);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newPos);
+	p->SetPosition(arbitraryprecisioncalculation::MpfVector::Adopt(newPos));
+	configuration::g_velocity_adjustment->AdjustVelocity(p, modifiedDimensions, oldPos.Get());
 }
 
 std::string BoundHandlingNearest::GetName(){
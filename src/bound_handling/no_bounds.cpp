@@ -39,19 +39,15 @@
 
 #include "bound_handling/no_bounds.h"
 
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 
 namespace highprecisionpso {
 
 void BoundHandlingNoBounds::SetParticleUpdate(Particle * p){
-	std::vector<mpf_t*> oldPos = p->GetPosition();
-	std::vector<mpf_t*> vel = p->GetVelocity();
-	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos, vel);
-	p->SetPosition(newPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(vel);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newPos);
+	// the clone of the position is reused for the new position
+	p->SetPosition(p->GetPosition() + p->GetVelocity());
 }
 
 std::string BoundHandlingNoBounds::GetName(){
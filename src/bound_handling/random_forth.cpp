@@ -42,6 +42,7 @@
 #include "function/function.h"
 #include "general/check_condition.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 #include "velocity_adjustment/velocity_adjustment.h"
@@ -51,14 +52,14 @@ namespace highprecisionpso {
 BoundHandlingRandomForth::BoundHandlingRandomForth(RandomForthMarkDimensions random_forth_mark_dimensions):random_forth_mark_dimensions_(random_forth_mark_dimensions){}
 
 void BoundHandlingRandomForth::SetParticleUpdate(Particle * p){
-	std::vector<mpf_t*> oldPos = p->GetPosition();
-	std::vector<mpf_t*> vel = p->GetVelocity();
-	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos, vel);
+	arbitraryprecisioncalculation::MpfVector oldPos = p->GetPosition();
+	arbitraryprecisioncalculation::MpfVector vel = p->GetVelocity();
+	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos.Get(), vel.Get());
 	std::vector<bool> modifiedDimensions(newPos.size(), false);
 	mpf_t* scale = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
 	bool outside = false;
-	std::vector<mpf_t*> lo = configuration::g_function->GetLowerSearchSpaceBound();
-	std::vector<mpf_t*> hi = configuration::g_function->GetUpperSearchSpaceBound();
+	arbitraryprecisioncalculation::MpfVector lo = configuration::g_function->GetLowerSearchSpaceBound();
+	arbitraryprecisioncalculation::MpfVector hi = configuration::g_function->GetUpperSearchSpaceBound();
 	int minScaleId = -1;
 	for(unsigned int i = 0; i < newPos.size(); i++) {
 		if(arbitraryprecisioncalculation::mpftoperations::Compare(lo[i], newPos[i]) > 0) {
@@ -93,16 +94,16 @@ void BoundHandlingRandomForth::SetParticleUpdate(Particle * p){
 		if(random_forth_mark_dimensions_ == RANDOM_FORTH_MARK_DIMENSIONS_ALL_ON_CHANGE){
 			modifiedDimensions = std::vector<bool>(newPos.size(), true);
 		}
-		AssertCondition(arbitraryprecisioncalculation::mpftoperations::Compare(scale, 0.0) >= 0, "");
-		AssertCondition(arbitraryprecisioncalculation::mpftoperations::Compare(scale, 1.0) <= 0, "");
+		AssertCondition(arbitraryprecisioncalculation::mpftoperations::Sign(scale) >= 0, "");
+		AssertCondition(arbitraryprecisioncalculation::mpftoperations::CompareD(scale, 1.0) <= 0, "");
 		{// difference to absorb: random scale
 			mpf_t* random_scale = arbitraryprecisioncalculation::mpftoperations::Randomize(scale);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(scale);
 			scale = random_scale;
 		}
 		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newPos);
-		std::vector<mpf_t*> cVel = arbitraryprecisioncalculation::vectoroperations::Multiply(vel, scale);
-		newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos, cVel);
+		std::vector<mpf_t*> cVel = arbitraryprecisioncalculation::vectoroperations::Multiply(vel.Get(), scale);
+		newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos.Get(), cVel);
 		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(cVel);
 		modifiedDimensions[minScaleId] = true;
 		for(unsigned int i = 0; i < newPos.size(); i++) {
@@ -118,13 +119,8 @@ void BoundHandlingRandomForth::SetParticleUpdate(Particle * p){
 		}
 	}
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(scale);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(lo);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(hi);
-	p->SetPosition(newPos);
-	configuration::g_velocity_adjustment->AdjustVelocity(p, modifiedDimensions, oldPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(vel);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newPos);
+	p->SetPosition(arbitraryprecisioncalculation::MpfVector::Adopt(newPos));
+	configuration::g_velocity_adjustment->AdjustVelocity(p, modifiedDimensions, oldPos.Get());
 }
 
 std::string BoundHandlingRandomForth::GetName(){
@@ -41,18 +41,19 @@
 
 #include "function/function.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 
 namespace highprecisionpso {
 
 void BoundHandlingTorus::SetParticleUpdate(Particle * p){
-	std::vector<mpf_t*> oldPos = p->GetPosition();
-	std::vector<mpf_t*> vel = p->GetVelocity();
-	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos, vel);
+	arbitraryprecisioncalculation::MpfVector oldPos = p->GetPosition();
+	arbitraryprecisioncalculation::MpfVector vel = p->GetVelocity();
+	std::vector<mpf_t*> newPos = arbitraryprecisioncalculation::vectoroperations::Add(oldPos.Get(), vel.Get());
 	{
-		std::vector<mpf_t*> lower = configuration::g_function->GetLowerSearchSpaceBound();
-		std::vector<mpf_t*> upper = configuration::g_function->GetUpperSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector lower = configuration::g_function->GetLowerSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector upper = configuration::g_function->GetUpperSearchSpaceBound();
 		for(int i = 0; i < configuration::g_dimensions; i++){
 			if(arbitraryprecisioncalculation::mpftoperations::Compare((lower[i]), (newPos[i])) > 0 ||
 				arbitraryprecisioncalculation::mpftoperations::Compare((newPos[i]), (upper[i])) > 0) {
@@ -71,13 +72,8 @@ void BoundHandlingTorus::SetParticleUpdate(Particle * p){
 				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(mod_num);
 			}
 		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(lower);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(upper);
 	}
-	p->SetPosition(newPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(vel);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newPos);
+	p->SetPosition(arbitraryprecisioncalculation::MpfVector::Adopt(newPos));
 }
 
 std::string BoundHandlingTorus::GetName(){
@@ -87,8 +83,8 @@ std::string BoundHandlingTorus::GetName(){
 std::vector<mpf_t*> BoundHandlingTorus::GetDirectionVector(const std::vector<mpf_t*> & position, const std::vector<mpf_t*> & aim){
 	std::vector<mpf_t*> dir = arbitraryprecisioncalculation::vectoroperations::Subtract(aim, position);
 	{
-		std::vector<mpf_t*> lower = configuration::g_function->GetLowerSearchSpaceBound();
-		std::vector<mpf_t*> upper = configuration::g_function->GetUpperSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector lower = configuration::g_function->GetLowerSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector upper = configuration::g_function->GetUpperSearchSpaceBound();
 		for(int i = 0; i < configuration::g_dimensions; i++){
 			mpf_t* mod_num = arbitraryprecisioncalculation::mpftoperations::Subtract(upper[i], lower[i]);
 			std::vector<mpf_t*> options;
@@ -107,8 +103,6 @@ std::vector<mpf_t*> BoundHandlingTorus::GetDirectionVector(const std::vector<mpf
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(abs_cur);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(mod_num);
 		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(lower);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(upper);
 	}
 	return dir;
 }
@@ -70,8 +70,8 @@ mpf_t* Function::Evaluate(const std::vector<mpf_t*> & pos){
 	if(configuration::g_function_behavior_outside_of_bounds_mode == configuration::FUNCTION_BEHAVIOR_OUTSIDE_OF_BOUNDS_INFINITY){
 		AssertCondition(((int)pos.size()) == configuration::g_dimensions, "Dimension mismatch: function is called with a position which has different number of dimensions as specified.");
 		bool infinity = false;
-		std::vector<mpf_t*> lower = GetLowerSearchSpaceBound();
-		std::vector<mpf_t*> upper = GetUpperSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector lower = GetLowerSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector upper = GetUpperSearchSpaceBound();
 		for(int i = 0; i < configuration::g_dimensions; i++){
 			if(arbitraryprecisioncalculation::mpftoperations::Compare((lower[i]), (pos[i])) > 0 ||
 				arbitraryprecisioncalculation::mpftoperations::Compare((pos[i]), (upper[i])) > 0) {
@@ -79,16 +79,14 @@ mpf_t* Function::Evaluate(const std::vector<mpf_t*> & pos){
 				break;
 			}
 		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(lower);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(upper);
 		if(infinity){
 			return arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity();
 		}
 	} else if(configuration::g_function_behavior_outside_of_bounds_mode == configuration::FUNCTION_BEHAVIOR_OUTSIDE_OF_BOUNDS_PERIODIC){
 		AssertCondition(((int)pos.size()) == configuration::g_dimensions, "Dimension mismatch: function is called with a position which has different number of dimensions as specified.");
 		std::vector<mpf_t*> eval_pos;
-		std::vector<mpf_t*> lower = GetLowerSearchSpaceBound();
-		std::vector<mpf_t*> upper = GetUpperSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector lower = GetLowerSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector upper = GetUpperSearchSpaceBound();
 		for(int i = 0; i < configuration::g_dimensions; i++){
 			if(arbitraryprecisioncalculation::mpftoperations::Compare((lower[i]), (pos[i])) > 0 ||
 				arbitraryprecisioncalculation::mpftoperations::Compare((pos[i]), (upper[i])) > 0) {
@@ -119,8 +117,6 @@ mpf_t* Function::Evaluate(const std::vector<mpf_t*> & pos){
 				eval_pos.push_back(arbitraryprecisioncalculation::mpftoperations::Clone(pos[i]));
 			}
 		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(lower);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(upper);
 		FUNCTION_EVALUATE_ALREADY_CALLED = true;
 		mpf_t* result = Eval(eval_pos);
 		FUNCTION_EVALUATE_ALREADY_CALLED = false;
@@ -133,27 +129,27 @@ mpf_t* Function::Evaluate(const std::vector<mpf_t*> & pos){
 	return result;
 }
 
-std::vector<mpf_t*> Function::GetLowerSearchSpaceBound() {
+arbitraryprecisioncalculation::MpfVector Function::GetLowerSearchSpaceBound() {
 	if(search_space_lower_bound_.size() < (unsigned int)configuration::g_dimensions)InitSearchSpaceBounds();
 	AssertCondition(search_space_lower_bound_.size() >= (unsigned int)configuration::g_dimensions, "Function::InitSearchSpaceBounds does not work.");
 	if(search_space_lower_bound_.size() > (unsigned int)configuration::g_dimensions){
 		auto copy_search_space_lower_bound = search_space_lower_bound_;
 		copy_search_space_lower_bound.resize(configuration::g_dimensions);
-		return arbitraryprecisioncalculation::vectoroperations::GetVector(copy_search_space_lower_bound);
+		return arbitraryprecisioncalculation::MpfVector::Adopt(arbitraryprecisioncalculation::vectoroperations::GetVector(copy_search_space_lower_bound));
 	} else {
-		return arbitraryprecisioncalculation::vectoroperations::GetVector(search_space_lower_bound_);
+		return arbitraryprecisioncalculation::MpfVector::Adopt(arbitraryprecisioncalculation::vectoroperations::GetVector(search_space_lower_bound_));
 	}
 }
 
-std::vector<mpf_t*> Function::GetUpperSearchSpaceBound() {
+arbitraryprecisioncalculation::MpfVector Function::GetUpperSearchSpaceBound() {
 	if(search_space_upper_bound_.size() < (unsigned int)configuration::g_dimensions)InitSearchSpaceBounds();
 	AssertCondition(search_space_upper_bound_.size() >= (unsigned int)configuration::g_dimensions, "Function::InitSearchSpaceBounds does not work.");
 	if(search_space_upper_bound_.size() > (unsigned int)configuration::g_dimensions){
 		auto copy_search_space_upper_bound = search_space_upper_bound_;
 		copy_search_space_upper_bound.resize(configuration::g_dimensions);
-		return arbitraryprecisioncalculation::vectoroperations::GetVector(copy_search_space_upper_bound);
+		return arbitraryprecisioncalculation::MpfVector::Adopt(arbitraryprecisioncalculation::vectoroperations::GetVector(copy_search_space_upper_bound));
 	} else {
-		return arbitraryprecisioncalculation::vectoroperations::GetVector(search_space_upper_bound_);
+		return arbitraryprecisioncalculation::MpfVector::Adopt(arbitraryprecisioncalculation::vectoroperations::GetVector(search_space_upper_bound_));
 	}
 }
 
@@ -164,18 +160,18 @@ mpf_t* Function::DistanceTo1DLocalOptimum(const std::vector<mpf_t*> & pos, int d
 	return res;
 }
 
+bool Function::PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision){
+	return !arbitraryprecisioncalculation::mpftoperations::IsEquivalentPrecision(old_precision, new_precision);
+}
+
 mpf_t* Function::DistanceTo1DLocalOptimumTernarySearch(const std::vector<mpf_t*> & pos, int d, mpf_t* start_distance){
 	mpf_t* min_pos;
 	mpf_t* max_pos;
 	{
-		std::vector<mpf_t*> low_bound = GetLowerSearchSpaceBound();
-		std::vector<mpf_t*> high_bound = GetUpperSearchSpaceBound();
-		min_pos = low_bound[d];
-		max_pos = high_bound[d];
-		low_bound[d] = NULL;
-		high_bound[d] = NULL;
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(low_bound);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(high_bound);
+		arbitraryprecisioncalculation::MpfVector low_bound = GetLowerSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector high_bound = GetUpperSearchSpaceBound();
+		min_pos = arbitraryprecisioncalculation::mpftoperations::Clone(low_bound[d]);
+		max_pos = arbitraryprecisioncalculation::mpftoperations::Clone(high_bound[d]);
 	}
 	if( (arbitraryprecisioncalculation::mpftoperations::Compare(min_pos, pos[d]) > 0) ||
 			(arbitraryprecisioncalculation::mpftoperations::Compare(max_pos, pos[d]) < 0) ) {
@@ -192,7 +188,7 @@ mpf_t* Function::DistanceTo1DLocalOptimumTernarySearch(const std::vector<mpf_t*>
 		return res;
 	}
 
-	AssertCondition(arbitraryprecisioncalculation::mpftoperations::Compare(start_distance, 0.0) > 0, "distance_to_1D_local_optimum_ternary_search has to be called with a positive value.");
+	AssertCondition(arbitraryprecisioncalculation::mpftoperations::Sign(start_distance) > 0, "distance_to_1D_local_optimum_ternary_search has to be called with a positive value.");
 	mpf_t* low_position = NULL;
 	mpf_t* high_position = NULL;
 	std::vector<mpf_t*> current_position = arbitraryprecisioncalculation::vectoroperations::Clone(pos);
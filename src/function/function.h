@@ -43,6 +43,8 @@
 #include <gmp.h>
 #include <vector>
 
+#include "arbitrary_precision_calculation/mpf_value.h"
+
 namespace highprecisionpso {
 
 /**
@@ -110,15 +112,15 @@ public:
 	/**
 	* @brief Returns the lower search space bound of the search space for this objective function.
 	*
-	* @return The lower bound.
+	* @return The lower bound, which releases its values itself.
 	*/
-	virtual std::vector<mpf_t*> GetLowerSearchSpaceBound();
+	virtual arbitraryprecisioncalculation::MpfVector GetLowerSearchSpaceBound();
 	/**
 	* @brief Returns the upper search space bound of the search space for this objective function.
 	*
-	* @return The upper bound.
+	* @return The upper bound, which releases its values itself.
 	*/
-	virtual std::vector<mpf_t*> GetUpperSearchSpaceBound();
+	virtual arbitraryprecisioncalculation::MpfVector GetUpperSearchSpaceBound();
 	/**
 	* @brief Returns a string representation of this object.
 	*
@@ -139,6 +141,20 @@ public:
 	*/
 	virtual mpf_t* DistanceTo1DLocalOptimum(const std::vector<mpf_t*> & pos, int d);
 	/**
+	* @brief Checks whether a change of the precision may change the function values.
+	*
+	* Cached function values need to be recomputed after a change of the precision only if this method returns true.
+	* By default the evaluation only depends on the precision in limbs (see arbitraryprecisioncalculation::mpftoperations::IsEquivalentPrecision).
+	* Functions which depend on the precision in bits have to override this method.
+	*
+	* @param old_precision The precision in bits which was used for the cached function values.
+	* @param new_precision The current precision in bits.
+	*
+	* @retval true If function values evaluated with the new precision may differ.
+	* @retval false otherwise.
+	*/
+	virtual bool PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision);
+	/**
 	* @brief Returns the evaluation of the current function at the given position.
 	*
 	* If you write your own function please override this function.
@@ -75,6 +75,10 @@ std::string OperatedFunction::GetName(){
 	return os.str();
 }
 
+bool OperatedFunction::PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision){
+	return function_->PrecisionChangeAffectsEvaluation(old_precision, new_precision);
+}
+
 CombineFunction::CombineFunction(PairReduceOperation* operation, Function* operator1, Function* operator2):operation_(operation), operator1_(operator1), operator2_(operator2){}
 
 mpf_t* CombineFunction::Eval(const std::vector<mpf_t*> & vec){
@@ -92,6 +96,11 @@ std::string CombineFunction::GetName(){
 	return os.str();
 }
 
+bool CombineFunction::PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision){
+	return operator1_->PrecisionChangeAffectsEvaluation(old_precision, new_precision)
+			|| operator2_->PrecisionChangeAffectsEvaluation(old_precision, new_precision);
+}
+
 ConstantFunction::ConstantFunction(ConstantEvaluation* constantEvaluation):constant_evaluation_(constantEvaluation){}
 
 mpf_t* ConstantFunction::Eval(const std::vector<mpf_t*> & vec){
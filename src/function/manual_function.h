@@ -97,6 +97,7 @@ public:
 	*/
 	mpf_t* Eval(const std::vector<mpf_t*> & pos);
 	std::string GetName();
+	bool PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision);
 
 private:
 	Operation* operation_;
@@ -125,6 +126,7 @@ public:
 	*/
 	mpf_t* Eval(const std::vector<mpf_t*> & pos);
 	std::string GetName();
+	bool PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision);
 
 private:
 	PairReduceOperation* operation_;
@@ -48,12 +48,13 @@ namespace highprecisionpso {
 
 // Norm1 Norm1 Norm1 Norm1 Norm1 Norm1 Norm1 Norm1 Norm1 Norm1 Norm1 Norm1
 mpf_t* Norm1::Eval(const std::vector<mpf_t*> & vec) {
-	std::vector<mpf_t*> vecAbs(vec.size());
+	mpf_t* res = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0);
+	mpf_t* absolute_value = NULL;
 	for(unsigned int i = 0; i < vec.size(); i++){
-		vecAbs[i] = arbitraryprecisioncalculation::mpftoperations::Abs(vec[i]);
+		arbitraryprecisioncalculation::mpftoperations::AbsTo(&absolute_value, vec[i]);
+		arbitraryprecisioncalculation::mpftoperations::AddTo(&res, absolute_value, res);
 	}
-	mpf_t* res = arbitraryprecisioncalculation::vectoroperations::Add(vecAbs);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(vecAbs);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(absolute_value);
 	return res;
 }
 
@@ -96,14 +97,19 @@ Norm2PowerK::Norm2PowerK(int exponent):exponent_(exponent){
 }
 
 mpf_t* Norm2PowerK::Eval(const std::vector<mpf_t*> & vec) {
-	std::vector<mpf_t*> curVec = arbitraryprecisioncalculation::vectoroperations::Clone(vec);
-	for(int j = 0; j < exponent_; j++){
-		std::vector<mpf_t*> nextVec = arbitraryprecisioncalculation::vectoroperations::Multiply(curVec, curVec);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(curVec);
-		curVec = nextVec;
+	if(exponent_ == 1){
+		return arbitraryprecisioncalculation::vectoroperations::Dot(vec, vec);
 	}
-	mpf_t* res = arbitraryprecisioncalculation::vectoroperations::Add(curVec);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(curVec);
+	mpf_t* res = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0);
+	mpf_t* power = NULL;
+	for(unsigned int i = 0; i < vec.size(); i++){
+		arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&power, vec[i], vec[i]);
+		for(int j = 1; j < exponent_; j++){
+			arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&power, power, power);
+		}
+		arbitraryprecisioncalculation::mpftoperations::AddTo(&res, power, res);
+	}
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(power);
 	return res;
 }
 
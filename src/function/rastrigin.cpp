@@ -52,24 +52,25 @@ mpf_t* Rastrigin::Eval(const std::vector<mpf_t*> & vec) {
 	mpf_t* pi_n2 = arbitraryprecisioncalculation::mpftoperations::Add(pi, pi);
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi);
 	mpf_t* n10 = arbitraryprecisioncalculation::mpftoperations::ToMpft(10.0);
+	// the cosines of all coordinates share the constants of the argument reduction
+	std::vector<mpf_t*> icos = arbitraryprecisioncalculation::vectoroperations::Multiply(vec, pi_n2);
+	std::vector<mpf_t*> tcos = arbitraryprecisioncalculation::vectoroperations::Cos(icos);
 	for(unsigned int i = 0; i < D; i++){
 		mpf_t* x = vec[i];
 
 		mpf_t* t1 = arbitraryprecisioncalculation::mpftoperations::Multiply(x, x);
-		mpf_t* icos = arbitraryprecisioncalculation::mpftoperations::Multiply(x, pi_n2);
-		mpf_t* tcos = arbitraryprecisioncalculation::mpftoperations::Cos(icos);
-		mpf_t* t2 = arbitraryprecisioncalculation::mpftoperations::Multiply(tcos, n10);
+		mpf_t* t2 = arbitraryprecisioncalculation::mpftoperations::Multiply(tcos[i], n10);
 
 		mpf_t* t12 = arbitraryprecisioncalculation::mpftoperations::Subtract(t1, t2);
 
 		sumUpValues[i] = arbitraryprecisioncalculation::mpftoperations::Add(t12, n10);
 
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(t1);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(icos);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tcos);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(t2);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(t12);
 	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(icos);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tcos);
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi_n2);
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(n10);
 	mpf_t* res = arbitraryprecisioncalculation::vectoroperations::Add(sumUpValues);
@@ -89,18 +89,21 @@ Schwefel2::Schwefel2() : Function ( -500.0, 500.0 ) {}
 mpf_t* Schwefel2::Eval(const std::vector<mpf_t*> & vec) {
 	unsigned int D = vec.size();
 	std::vector<mpf_t*> sumUpValues(D);
+	std::vector<mpf_t*> absx(D);
 	for(unsigned int i = 0; i < D; i++){
-		mpf_t* x = vec[i];
-		mpf_t* absx = arbitraryprecisioncalculation::mpftoperations::Abs(x);
-		mpf_t* sqx = arbitraryprecisioncalculation::mpftoperations::Sqrt(absx);
-		mpf_t* sinx = arbitraryprecisioncalculation::mpftoperations::Sin(sqx);
-		mpf_t* mul = arbitraryprecisioncalculation::mpftoperations::Multiply(x, sinx);
+		absx[i] = arbitraryprecisioncalculation::mpftoperations::Abs(vec[i]);
+	}
+	// the sines of all coordinates share the constants of the argument reduction
+	std::vector<mpf_t*> sqx = arbitraryprecisioncalculation::vectoroperations::Sqrt(absx);
+	std::vector<mpf_t*> sinx = arbitraryprecisioncalculation::vectoroperations::Sin(sqx);
+	for(unsigned int i = 0; i < D; i++){
+		mpf_t* mul = arbitraryprecisioncalculation::mpftoperations::Multiply(vec[i], sinx[i]);
 		sumUpValues[i] = arbitraryprecisioncalculation::mpftoperations::Negate(mul);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(absx);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sqx);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sinx);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(mul);
 	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(absx);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(sqx);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(sinx);
 	mpf_t* res = arbitraryprecisioncalculation::vectoroperations::Add(sumUpValues);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(sumUpValues);
 	return res;
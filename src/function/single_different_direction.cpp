@@ -90,9 +90,7 @@ void SingleDifferentDirection::InitSpecialDirection(const std::vector<mpf_t*> &
 					unsigned int parsed = 0;
 					rng = arbitraryprecisioncalculation::parse::ParseRandomNumberGenerator(rng_description_, parsed);
 				}
-				for(unsigned int d = 0; d < D; d++){
-					special_direction_cached_.push_back(arbitraryprecisioncalculation::mpftoperations::GetGaussianRandomMpft(0.0, 1.0, rng));
-				}
+				arbitraryprecisioncalculation::vectoroperations::FillGaussianRandom(&special_direction_cached_, D, 0.0, 1.0, rng);
 				break;
 			default:
 				AssertCondition(false, "Invalid / Unsupported option for function singleDifferentDirection.");
@@ -128,6 +126,12 @@ mpf_t* SingleDifferentDirection::Eval(const std::vector<mpf_t*> & vec) {
 	return res;
 }
 
+bool SingleDifferentDirection::PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision){
+	// the number of random bits of the special direction depends on the precision in bits
+	if(direction_mode_ == SINGLE_DIFFERENT_DIRECTION_MODE_RANDOM) return old_precision != new_precision;
+	return Function::PrecisionChangeAffectsEvaluation(old_precision, new_precision);
+}
+
 std::string SingleDifferentDirection::GetName(){
 	std::ostringstream os;
 	os << "SinDiffDir" << single_dimension_exponent_ << "_" << remaining_dimension_exponent_ << "_" << (int)direction_mode_;
@@ -104,6 +104,7 @@ public:
 	*/
 	mpf_t* Eval(const std::vector<mpf_t*> & pos);
 	std::string GetName();
+	bool PrecisionChangeAffectsEvaluation(unsigned long old_precision, unsigned long new_precision);
 
 private:
 	void InitSpecialDirection(const std::vector<mpf_t*> & vec);
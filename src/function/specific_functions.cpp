@@ -71,10 +71,7 @@ OperatedSpecificFunction::OperatedSpecificFunction(Operation* operation, Specifi
 
 std::vector<mpf_t*> OperatedSpecificFunction::Eval(const std::vector<mpf_t*> & vec){
 	std::vector<mpf_t*> res1 = specific_function_->Eval(vec);
-	std::vector<mpf_t*> res;
-	for(unsigned int i = 0; i < res1.size(); i++){
-		res.push_back(operation_->Operate(res1[i]));
-	}
+	std::vector<mpf_t*> res = operation_->OperateElementWise(res1);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(res1);
 	return res;
 }
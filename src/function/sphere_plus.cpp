@@ -47,7 +47,7 @@ mpf_t* SpherePlus::Eval(const std::vector<mpf_t*> & vec) {
 	unsigned int D = vec.size();
 	mpf_t* res = NULL;
 	for(unsigned int d = 0; d < D; d++){
-		if (arbitraryprecisioncalculation::mpftoperations::Compare((vec[d]), 0.0) < 0){
+		if (arbitraryprecisioncalculation::mpftoperations::Sign(vec[d]) < 0){
 			return arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity();
 		}
 	}
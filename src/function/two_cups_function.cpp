@@ -50,7 +50,7 @@ mpf_t* TwoCupsFunction::Eval(const std::vector<mpf_t*> & vec) {
 	mpf_t* n1 = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
 	for(int d = 0; d < D; d++){
 		mpf_t* cres;
-		if (arbitraryprecisioncalculation::mpftoperations::Compare((vec[d]), 0.0) <= 0){
+		if (arbitraryprecisioncalculation::mpftoperations::Sign(vec[d]) <= 0){
 			vtmp = arbitraryprecisioncalculation::mpftoperations::Add(vec[d], n1);
 			cres = arbitraryprecisioncalculation::mpftoperations::Pow(vtmp,2);
 		}	else {
@@ -76,7 +76,7 @@ mpf_t* TwoCupsFunction::DistanceTo1DLocalOptimum(const std::vector<mpf_t*> & pos
 	mpf_t* res = NULL;
 	mpf_t* v1 = NULL;
 	mpf_t* n1 = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
-	if (arbitraryprecisioncalculation::mpftoperations::Compare((pos[d]), 0.0) <= 0){
+	if (arbitraryprecisioncalculation::mpftoperations::Sign(pos[d]) <= 0){
 		v1 = arbitraryprecisioncalculation::mpftoperations::Add(pos[d], n1);
 	}	else {
 		v1 = arbitraryprecisioncalculation::mpftoperations::Subtract(pos[d], n1);
@@ -48,6 +48,7 @@
 #include <algorithm>
 
 #include "general/includes.h"
+#include "arbitrary_precision_calculation/check_condition.h"
 #include "general/check_condition.h"
 
 namespace highprecisionpso {
@@ -522,6 +523,24 @@ bool ReadConfigurationFile(std::string fileName) {
 			int output_precision;
 			is >> output_precision;
 			arbitraryprecisioncalculation::Configuration::setOutputPrecision(output_precision);
+		} else if (option == "backupformat") {
+			if(input.size() == 2 && input[1] == "text"){
+				arbitraryprecisioncalculation::Configuration::setStorageFormat(arbitraryprecisioncalculation::configuration::STORAGE_FORMAT_TEXT);
+			} else if(input.size() == 2 && input[1] == "binary"){
+				arbitraryprecisioncalculation::Configuration::setStorageFormat(arbitraryprecisioncalculation::configuration::STORAGE_FORMAT_BINARY);
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
+		} else if (option == "outputformat") {
+			if(input.size() == 2 && input[1] == "decimal"){
+				arbitraryprecisioncalculation::Configuration::setOutputFormat(arbitraryprecisioncalculation::configuration::OUTPUT_FORMAT_DECIMAL);
+			} else if(input.size() == 2 && input[1] == "hexadecimal"){
+				arbitraryprecisioncalculation::Configuration::setOutputFormat(arbitraryprecisioncalculation::configuration::OUTPUT_FORMAT_HEXADECIMAL);
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
 		} else if (option == "checkprecision") {
 			if(input[1] == "all"){
 				arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS);
@@ -529,6 +548,63 @@ bool ReadConfigurationFile(std::string fileName) {
 				arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS);
 			} else if(input[1] == "never"){
 				arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_NEVER);
+			} else if(input[1] == "ball"){
+				arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_BALL);
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
+		} else if (option == "checkprecisionalgorithm") {
+			if(input[1] == "trialAddition"){
+				arbitraryprecisioncalculation::Configuration::setCheckPrecisionAlgorithm(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_TRIAL_ADDITION);
+			} else if(input[1] == "exponent"){
+				arbitraryprecisioncalculation::Configuration::setCheckPrecisionAlgorithm(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_EXPONENT);
+			} else if(input[1] == "regression"){
+				arbitraryprecisioncalculation::Configuration::setCheckPrecisionAlgorithm(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_REGRESSION);
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
+		} else if (option == "elementaryfunctions") {
+			if(input.size() != 2){
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
+			if(input[1] == "reference"){
+				arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE);
+			} else if(input[1] == "fast"){
+				arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST);
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
+		} else if (option == "constants") {
+			if(input.size() == 2 && input[1] == "reference"){
+				arbitraryprecisioncalculation::Configuration::setConstantAlgorithm(arbitraryprecisioncalculation::configuration::CONSTANT_ALGORITHM_REFERENCE);
+			} else if((input.size() == 2 || input.size() == 3) && input[1] == "engine"){
+				arbitraryprecisioncalculation::Configuration::setConstantAlgorithm(arbitraryprecisioncalculation::configuration::CONSTANT_ALGORITHM_ENGINE);
+				// a missing cache file is created as soon as the first constant is calculated
+				arbitraryprecisioncalculation::constants::LoadCacheFile(input.size() == 3 ? input[2] : "");
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
+		} else if (option == "assertionlevel") {
+			if(input.size() == 2 && input[1] == "off"){
+				arbitraryprecisioncalculation::SetAssertionLevel(arbitraryprecisioncalculation::ASSERTION_LEVEL_OFF);
+			} else if(input.size() == 2 && input[1] == "cheap"){
+				arbitraryprecisioncalculation::SetAssertionLevel(arbitraryprecisioncalculation::ASSERTION_LEVEL_CHEAP);
+			} else if(input.size() == 2 && input[1] == "paranoid"){
+				arbitraryprecisioncalculation::SetAssertionLevel(arbitraryprecisioncalculation::ASSERTION_LEVEL_PARANOID);
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
+		} else if (option == "gaussiansampler") {
+			if(input.size() == 2 && input[1] == "reference"){
+				arbitraryprecisioncalculation::Configuration::setGaussianAlgorithm(arbitraryprecisioncalculation::configuration::GAUSSIAN_ALGORITHM_REFERENCE);
+			} else if(input.size() == 2 && input[1] == "polar"){
+				arbitraryprecisioncalculation::Configuration::setGaussianAlgorithm(arbitraryprecisioncalculation::configuration::GAUSSIAN_ALGORITHM_POLAR);
 			} else {
 				parse::SignalInvalidCommand(input);
 				return false;
@@ -538,6 +614,29 @@ bool ReadConfigurationFile(std::string fileName) {
 			double check_precision_probability;
 			is >> check_precision_probability;
 			arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(check_precision_probability);
+		} else if (option == "checkprecisionsampling"){
+			if(input.size() == 2 && input[1] == "standardGenerator"){
+				arbitraryprecisioncalculation::Configuration::setCheckPrecisionSampler(NULL);
+			} else if((input.size() == 3 || input.size() == 4) && input[1] == "geometricGaps"){
+				std::istringstream is(input[2]);
+				unsigned long long seed;
+				if(!(is >> seed)){
+					parse::SignalInvalidCommand(input);
+					return false;
+				}
+				bool adaptive = false;
+				if(input.size() == 4){
+					if(input[3] != "adaptive"){
+						parse::SignalInvalidCommand(input);
+						return false;
+					}
+					adaptive = true;
+				}
+				arbitraryprecisioncalculation::Configuration::setCheckPrecisionSampler(new arbitraryprecisioncalculation::CheckPrecisionSampler(seed, adaptive));
+			} else {
+				parse::SignalInvalidCommand(input);
+				return false;
+			}
 		} else if (option == "showstatistics") {
 			std::vector<long long> newTimeTable;
 			for(int k = 1; k <= 3; k++){
@@ -875,10 +974,17 @@ std::string GetConfigurationString() {
 	if(check_precision_mode == arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS) res << "A";
 	else if(check_precision_mode == arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS_EXCEPT_STATISTICS) res << "AeS";
 	else if(check_precision_mode == arbitraryprecisioncalculation::configuration::CHECK_PRECISION_NEVER) res << "N";
+	else if(check_precision_mode == arbitraryprecisioncalculation::configuration::CHECK_PRECISION_BALL) res << "B";
 	else res << "FAIL";
+	if(arbitraryprecisioncalculation::Configuration::getCheckPrecisionAlgorithm() == arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_EXPONENT) res << "_CE";
+	if(arbitraryprecisioncalculation::Configuration::getElementaryFunctionAlgorithm() == arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST) res << "_FEF";
+	if(arbitraryprecisioncalculation::Configuration::getConstantAlgorithm() == arbitraryprecisioncalculation::configuration::CONSTANT_ALGORITHM_ENGINE) res << "_CEN";
 	double check_precision_probability = arbitraryprecisioncalculation::Configuration::getCheckPrecisionProbability();
 	if(check_precision_probability < 1){
 		res << "_CP" << check_precision_probability;
+		if(arbitraryprecisioncalculation::Configuration::getCheckPrecisionSampler() != NULL){
+			res << arbitraryprecisioncalculation::Configuration::getCheckPrecisionSampler()->GetName();
+		}
 	}
 	std::set<int> modifiedDimensionsSet;
 	for(auto info: g_position_initialization_informations){
@@ -359,10 +359,22 @@ std::string MinusInfinityConstantEvaluation::GetName(){
 	return "-oo";
 }
 
+std::vector<mpf_t*> Operation::OperateElementWise(const std::vector<mpf_t*> & values){
+	std::vector<mpf_t*> res;
+	for(unsigned int i = 0; i < values.size(); i++){
+		res.push_back(Operate(values[i]));
+	}
+	return res;
+}
+
 mpf_t* SqrtOperation::Operate( mpf_t* v ){
 	return arbitraryprecisioncalculation::mpftoperations::Sqrt( v );
 }
 
+std::vector<mpf_t*> SqrtOperation::OperateElementWise(const std::vector<mpf_t*> & values){
+	return arbitraryprecisioncalculation::vectoroperations::Sqrt(values);
+}
+
 std::string SqrtOperation::GetName(){
 	return "Sqrt";
 }
@@ -414,6 +426,10 @@ mpf_t* ExpOperation::Operate( mpf_t* v ){
 	return arbitraryprecisioncalculation::mpftoperations::Exp(v);
 }
 
+std::vector<mpf_t*> ExpOperation::OperateElementWise(const std::vector<mpf_t*> & values){
+	return arbitraryprecisioncalculation::vectoroperations::Exp(values);
+}
+
 std::string ExpOperation::GetName(){
 	return "Exp";
 }
@@ -422,6 +438,10 @@ mpf_t* SinOperation::Operate( mpf_t* v ){
 	return arbitraryprecisioncalculation::mpftoperations::Sin(v);
 }
 
+std::vector<mpf_t*> SinOperation::OperateElementWise(const std::vector<mpf_t*> & values){
+	return arbitraryprecisioncalculation::vectoroperations::Sin(values);
+}
+
 std::string SinOperation::GetName(){
 	return "Sin";
 }
@@ -430,6 +450,10 @@ mpf_t* CosOperation::Operate( mpf_t* v ){
 	return arbitraryprecisioncalculation::mpftoperations::Cos(v);
 }
 
+std::vector<mpf_t*> CosOperation::OperateElementWise(const std::vector<mpf_t*> & values){
+	return arbitraryprecisioncalculation::vectoroperations::Cos(values);
+}
+
 std::string CosOperation::GetName(){
 	return "Cos";
 }
@@ -470,6 +494,10 @@ mpf_t* LogEOperation::Operate( mpf_t* v ){
 	return arbitraryprecisioncalculation::mpftoperations::LogE(v);
 }
 
+std::vector<mpf_t*> LogEOperation::OperateElementWise(const std::vector<mpf_t*> & values){
+	return arbitraryprecisioncalculation::vectoroperations::LogE(values);
+}
+
 std::string LogEOperation::GetName(){
 	return "LogE";
 }
@@ -695,6 +695,16 @@ public:
 	*/
 	virtual mpf_t* Operate(mpf_t* value) = 0;
 	/**
+	* @brief Calculates the operation of each element of the supplied vector.
+	*
+	* The default implementation calls Operate for each element. Operations with vector kernels override it.
+	*
+	* @param values The values which should be operated on.
+	*
+	* @return The results of the operation.
+	*/
+	virtual std::vector<mpf_t*> OperateElementWise(const std::vector<mpf_t*> & values);
+	/**
 	* @brief Returns a string representation of this object.
 	*
 	* @return The name of the object.
@@ -716,6 +726,14 @@ public:
 	* @return The square root of the supplied value.
 	*/
 	mpf_t* Operate(mpf_t* value);
+	/**
+	* @brief Calculates the square root of each element of the supplied vector with vectoroperations.
+	*
+	* @param values The values which should be operated on.
+	*
+	* @return The results of the operation.
+	*/
+	std::vector<mpf_t*> OperateElementWise(const std::vector<mpf_t*> & values);
 	std::string GetName();
 };
 
@@ -810,6 +828,14 @@ public:
 	* @return The exponential function of the supplied value.
 	*/
 	mpf_t* Operate(mpf_t* value);
+	/**
+	* @brief Calculates the exponential function of each element of the supplied vector with vectoroperations.
+	*
+	* @param values The values which should be operated on.
+	*
+	* @return The results of the operation.
+	*/
+	std::vector<mpf_t*> OperateElementWise(const std::vector<mpf_t*> & values);
 	std::string GetName();
 };
 
@@ -826,6 +852,14 @@ public:
 	* @return The sine function of the supplied value.
 	*/
 	mpf_t* Operate(mpf_t* value);
+	/**
+	* @brief Calculates the sine function of each element of the supplied vector with vectoroperations.
+	*
+	* @param values The values which should be operated on.
+	*
+	* @return The results of the operation.
+	*/
+	std::vector<mpf_t*> OperateElementWise(const std::vector<mpf_t*> & values);
 	std::string GetName();
 };
 
@@ -842,6 +876,14 @@ public:
 	* @return The cosine function of the supplied value.
 	*/
 	mpf_t* Operate(mpf_t* value);
+	/**
+	* @brief Calculates the cosine function of each element of the supplied vector with vectoroperations.
+	*
+	* @param values The values which should be operated on.
+	*
+	* @return The results of the operation.
+	*/
+	std::vector<mpf_t*> OperateElementWise(const std::vector<mpf_t*> & values);
 	std::string GetName();
 };
 
@@ -922,6 +964,14 @@ public:
 	* @return The logarithm with base E of the supplied value.
 	*/
 	mpf_t* Operate(mpf_t* value);
+	/**
+	* @brief Calculates the natural logarithm of each element of the supplied vector with vectoroperations.
+	*
+	* @param values The values which should be operated on.
+	*
+	* @return The results of the operation.
+	*/
+	std::vector<mpf_t*> OperateElementWise(const std::vector<mpf_t*> & values);
 	std::string GetName();
 };
 
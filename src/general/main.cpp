@@ -44,6 +44,7 @@
 #include <arbitrary_precision_calculation/random_number_generator.h>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <sstream>
 #include <string.h>
 #include <unistd.h>
@@ -53,6 +54,7 @@
 #include "general/check_condition.h"
 #include "general/configuration.h"
 #include "general/general_objects.h"
+#include "arbitrary_precision_calculation/check_condition.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "arbitrary_precision_calculation/configuration.h"
 #include "general/particle.h"
@@ -84,6 +86,9 @@ void usage(int argc, char * argv[]){
 	std::cout << "\tPrints the version of the PSO program.\n";
 	std::cout << std::string(argv[0]) << " -gmpversion\n";
 	std::cout << "\tPrints the used version of the gmp library.\n";
+	std::cout << std::string(argv[0]) << " -backend\n";
+	std::cout << "\tPrints the arithmetic backend which was selected at build time (gmp or mpfr).\n";
+	std::cout << "\tThe mpfr backend evaluates only the elementary functions and constants with mpfr, the arithmetic operations still use gmp (mpf_t).\n";
 }
 
 int main(int argc, char * argv[]) {
@@ -174,6 +179,9 @@ int main(int argc, char * argv[]) {
 			} else if(command == "-gmpversion"){
 					std::cout << "gmp version: " << __GNU_MP_VERSION << "."<< __GNU_MP_VERSION_MINOR << "."<< __GNU_MP_VERSION_PATCHLEVEL << std::endl;
 					return 0;
+			} else if(command == "-backend"){
+					std::cout << "backend: " << arbitraryprecisioncalculation::Configuration::getArithmeticBackend() << std::endl;
+					return 0;
 			} else {
 				commandOK = false;
 			}
@@ -247,16 +255,11 @@ int main(int argc, char * argv[]) {
 							std::cout << "You did not write \"YES\". Program terminates whithout any action." << std::endl;
 						}
 					}
-					std::ifstream backupFile(argv[3]);
-					FILE* backup = fopen(
-							newBackupFileName.c_str(),
-							"w");
-					while (!backupFile.eof()) {
-						std::string tmp;
-						getline(backupFile, tmp);
-						fprintf(backup, "%s\n", tmp.c_str());
-					}
-					fclose(backup);
+					// copied byte by byte as mpf_t values may be stored in the binary format
+					std::ifstream backupFile(argv[3], std::ios::binary);
+					std::ofstream backup(newBackupFileName.c_str(), std::ios::binary);
+					backup << backupFile.rdbuf();
+					backup.close();
 					backupFile.close();
 				} else {
 					std::cout << "backup file \"" << backupFileName << "\" will be overwritten by new backup files. "
@@ -286,7 +289,8 @@ int main(int argc, char * argv[]) {
 
 namespace highprecisionpso {
 
-const ProgramVersion PSO_PROGRAM_VERSION (1, 0, 2);
+// 1.0.3: mpf_t values of backups may be stored in the binary format (see configuration option backupFormat)
+const ProgramVersion PSO_PROGRAM_VERSION (1, 0, 3);
 
 time_t LAST_BACKUP;
 time_t LAST_RUN_CHECK;
@@ -306,7 +310,7 @@ Statistics* RestoreAndDoPso() {
 		swarm->push_back(p);
 	}
 	std::ifstream bu;
-	bu.open((configuration::g_file_prefix + ".backup").c_str());
+	bu.open((configuration::g_file_prefix + ".backup").c_str(), std::ios::in | std::ios::binary);
 	std::string version_string;
 	bu >> version_string;
 	ProgramVersion version_of_stored_data (version_string);
@@ -314,8 +318,20 @@ Statistics* RestoreAndDoPso() {
 	AssertCondition(version_of_stored_data >= minimal_version, "Stored data was generated with to old or invalid program version.");
 	long long prec;
 	bu >> prec;
+	// the backend is stored behind the precision unless it is the default backend
+	std::string backend_line;
+	std::getline(bu, backend_line);
+	std::string backend;
+	std::istringstream backend_stream(backend_line);
+	if(!(backend_stream >> backend)) backend = "gmp";
+	AssertCondition(backend == arbitraryprecisioncalculation::Configuration::getArithmeticBackend(),
+			"Stored data was generated with the arithmetic backend \"" + backend + "\" but this program uses the backend \""
+			+ arbitraryprecisioncalculation::Configuration::getArithmeticBackend() + "\".");
 	mpf_set_default_prec(prec);
 	arbitraryprecisioncalculation::Configuration::getStandardRandomNumberGenerator()->LoadData(&bu);
+	if(arbitraryprecisioncalculation::Configuration::getCheckPrecisionSampler() != NULL){
+		arbitraryprecisioncalculation::Configuration::getCheckPrecisionSampler()->LoadData(&bu);
+	}
 	configuration::g_statistics->LoadData(&bu, &version_of_stored_data);
 	configuration::g_neighborhood->LoadData(&bu, &version_of_stored_data);
 	configuration::g_position_and_velocity_updater->LoadData(&bu, &version_of_stored_data);
@@ -347,11 +363,11 @@ Statistics* InitAndDoPso() {
 	Function* function = configuration::g_function;
 	std::vector< std::vector< std::vector<mpf_t*> > > position_velocity_ranges(2), position_velocity_centers(2), position_velocity_scales(2);
 	{
-		std::vector<mpf_t*> posLow = function->GetLowerSearchSpaceBound();
-		std::vector<mpf_t*> posHigh = function->GetUpperSearchSpaceBound();
-		std::vector<mpf_t*> posDiff = arbitraryprecisioncalculation::vectoroperations::Subtract(posHigh, posLow);
+		arbitraryprecisioncalculation::MpfVector posLow = function->GetLowerSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector posHigh = function->GetUpperSearchSpaceBound();
+		std::vector<mpf_t*> posDiff = arbitraryprecisioncalculation::vectoroperations::Subtract(posHigh.Get(), posLow.Get());
 		std::vector<mpf_t*> range1P = arbitraryprecisioncalculation::vectoroperations::Multiply(posDiff, 0.5);
-		std::vector<mpf_t*> center1P = arbitraryprecisioncalculation::vectoroperations::Add(posLow, range1P);
+		std::vector<mpf_t*> center1P = arbitraryprecisioncalculation::vectoroperations::Add(posLow.Get(), range1P);
 		for (int i = 0; i < configuration::g_particles; i++) {
 			position_velocity_ranges[0].push_back(arbitraryprecisioncalculation::vectoroperations::Clone(range1P));
 			position_velocity_ranges[1].push_back(arbitraryprecisioncalculation::vectoroperations::Clone(range1P));
@@ -360,8 +376,6 @@ Statistics* InitAndDoPso() {
 			position_velocity_scales[0].push_back(arbitraryprecisioncalculation::vectoroperations::GetConstantVector(configuration::g_dimensions, 1.0));
 			position_velocity_scales[1].push_back(arbitraryprecisioncalculation::vectoroperations::GetConstantVector(configuration::g_dimensions, 1.0));
 		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(posLow);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(posHigh);
 		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(posDiff);
 		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(range1P);
 		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(center1P);
@@ -570,7 +584,9 @@ Statistics* DoPso(Statistics* statistics) {
 		}
 
 
-		if (lastNumberOfmpft != arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() - arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached()) {
+		// the report of leaked mpf_t values is a consistency check of the pool bookkeeping
+		if (arbitraryprecisioncalculation::IsAssertionLevelActive(arbitraryprecisioncalculation::ASSERTION_LEVEL_CHEAP)
+				&& lastNumberOfmpft != arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() - arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached()) {
 			if (step > 2 + startstep) {
 				std::cerr << "step " << step << std::endl << "last mpf_t "
 					<< lastNumberOfmpft << std::endl << "curr mpf_t "
@@ -579,6 +595,8 @@ Statistics* DoPso(Statistics* statistics) {
 			lastNumberOfmpft = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() - arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached();
 		}
 		for (int id = 0; id < configuration::g_particles; id++) {
+			// counter based random number generators derive the random values of this update from particle and step only
+			arbitraryprecisioncalculation::Configuration::getStandardRandomNumberGenerator()->SetStream(id, 0, step);
 			(*swarm)[id]->UpdatePosition();
 			if(configuration::g_update_global_attractor_mode == configuration::UPDATE_GLOBAL_ATTRACTOR_MODE_EACH_PARTICLE){
 				configuration::g_neighborhood->ProceedAllUpdates();
@@ -619,6 +637,13 @@ Statistics* DoPso(Statistics* statistics) {
 		tmpstr = tmpstr.substr(0, tmpstr.size() - 1);
 	fprintf(logging, "finished %s with %lld steps\n", tmpstr.c_str(),
 			statistics->current_iteration);
+	if(arbitraryprecisioncalculation::Configuration::getCheckPrecisionMode() == arbitraryprecisioncalculation::configuration::CHECK_PRECISION_BALL) {
+		// report which decisions forced an increase of the precision since the start of this process
+		const std::map<std::string, long long> & undecidable_comparisons = arbitraryprecisioncalculation::mpftoperations::GetUndecidableComparisons();
+		for(std::map<std::string, long long>::const_iterator it = undecidable_comparisons.begin(); it != undecidable_comparisons.end(); ++it) {
+			fprintf(logging, "undecidable comparisons in %s: %lld\n", it->first.c_str(), it->second);
+		}
+	}
 	fclose(logging);
 
 	return statistics;
@@ -634,10 +659,17 @@ void WriteCurrentState(std::string filename) {
 		backup = true;
 	}
 
-	std::ofstream bu(filename.c_str());
+	std::ofstream bu(filename.c_str(), std::ios::out | std::ios::binary);
 	bu << PSO_PROGRAM_VERSION.GetCompleteVersion() << std::endl;
-	bu << mpf_get_default_prec() << std::endl;
+	bu << mpf_get_default_prec();
+	if(arbitraryprecisioncalculation::Configuration::getArithmeticBackend() != "gmp"){
+		bu << " " << arbitraryprecisioncalculation::Configuration::getArithmeticBackend();
+	}
+	bu << std::endl;
 	arbitraryprecisioncalculation::Configuration::getStandardRandomNumberGenerator()->StoreData(&bu);
+	if(arbitraryprecisioncalculation::Configuration::getCheckPrecisionSampler() != NULL){
+		arbitraryprecisioncalculation::Configuration::getCheckPrecisionSampler()->StoreData(&bu);
+	}
 	configuration::g_statistics->StoreData(&bu);
 	configuration::g_neighborhood->StoreData(&bu);
 	configuration::g_position_and_velocity_updater->StoreData(&bu);
@@ -59,26 +59,27 @@ Particle::Particle() {
 	local_attractor_value_cached_precision_ = 1;
 }
 
-std::vector<mpf_t*> Particle::GetLocalAttractorPosition() {
-	return arbitraryprecisioncalculation::vectoroperations::Clone(local_attractor_position);
+arbitraryprecisioncalculation::MpfVector Particle::GetLocalAttractorPosition() {
+	return arbitraryprecisioncalculation::MpfVector::Copy(local_attractor_position);
 }
 
 mpf_t* Particle::GetLocalAttractorValue() {
 	if(0 == local_attractor_position.size())return NULL;
 	if(local_attractor_value_cached_ == NULL 
-			|| mpf_get_default_prec() != local_attractor_value_cached_precision_){
+			|| configuration::g_function->PrecisionChangeAffectsEvaluation(local_attractor_value_cached_precision_, mpf_get_default_prec())){
 		if(local_attractor_value_cached_ == NULL)arbitraryprecisioncalculation::mpftoperations::ChangeNumberOfMpftValuesCached(1);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(local_attractor_value_cached_);
-		local_attractor_value_cached_precision_ = mpf_get_default_prec();
 		local_attractor_value_cached_ = configuration::g_function->Evaluate(local_attractor_position);
+		// the cached value stays valid as long as a reevaluation with the current precision would give the same value
+		local_attractor_value_cached_precision_ = mpf_get_default_prec();
 	}
 	return arbitraryprecisioncalculation::mpftoperations::Clone(local_attractor_value_cached_);
 }
-std::vector<mpf_t*> Particle::GetPosition() {
-	return arbitraryprecisioncalculation::vectoroperations::Clone(position);
+arbitraryprecisioncalculation::MpfVector Particle::GetPosition() {
+	return arbitraryprecisioncalculation::MpfVector::Copy(position);
 }
-std::vector<mpf_t*> Particle::GetVelocity() {
-	return arbitraryprecisioncalculation::vectoroperations::Clone(velocity);
+arbitraryprecisioncalculation::MpfVector Particle::GetVelocity() {
+	return arbitraryprecisioncalculation::MpfVector::Copy(velocity);
 }
 
 void Particle::SetLocalAttractorPosition(std::vector<mpf_t*> newLocalAttractorPosition) {
@@ -93,11 +94,17 @@ void Particle::SetLocalAttractorPosition(std::vector<mpf_t*> newLocalAttractorPo
 }
 
 void Particle::SetPosition(std::vector<mpf_t*> newPosition) {
+	SetPosition(arbitraryprecisioncalculation::MpfVector::Copy(newPosition));
+}
+
+void Particle::SetPosition(arbitraryprecisioncalculation::MpfVector && newPosition) {
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(position);
-	position = arbitraryprecisioncalculation::vectoroperations::Clone(newPosition);
+	position = newPosition.Release();
+	// the stored position is the state of the swarm, hence it is exact by definition
+	arbitraryprecisioncalculation::vectoroperations::MarkExact(position);
 	mpf_t* newVal = configuration::g_function->Evaluate(position);
 	mpf_t* curLocalAttractorValue = GetLocalAttractorValue();
-	if (curLocalAttractorValue == NULL || (arbitraryprecisioncalculation::mpftoperations::Compare(newVal, curLocalAttractorValue) <= 0) ) {
+	if (curLocalAttractorValue == NULL || (arbitraryprecisioncalculation::mpftoperations::Compare(newVal, curLocalAttractorValue, "Particle::SetPosition") <= 0) ) {
 		SetLocalAttractorPosition(position);
 		UpdateGlobalAttractor(position, newVal);
 	}
@@ -105,8 +112,13 @@ void Particle::SetPosition(std::vector<mpf_t*> newPosition) {
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(newVal);
 }
 void Particle::SetVelocity(std::vector<mpf_t*> newVelocity) {
+	SetVelocity(arbitraryprecisioncalculation::MpfVector::Copy(newVelocity));
+}
+
+void Particle::SetVelocity(arbitraryprecisioncalculation::MpfVector && newVelocity) {
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(velocity);
-	velocity = arbitraryprecisioncalculation::vectoroperations::Clone(newVelocity);
+	velocity = newVelocity.Release();
+	arbitraryprecisioncalculation::vectoroperations::MarkExact(velocity);
 }
 
 void Particle::UpdateGlobalAttractor(std::vector<mpf_t*> goodPosition,
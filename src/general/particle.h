@@ -44,6 +44,7 @@
 #include <gmp.h>
 #include <vector>
 
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "general/general_objects.h"
 
 namespace highprecisionpso {
@@ -63,9 +64,9 @@ public:
 	/**
 	* @brief Clones the position of the current local attractor.
 	*
-	* @return The position of the local attractor.
+	* @return The position of the local attractor, which releases its values itself.
 	*/
-	std::vector<mpf_t*> GetLocalAttractorPosition();
+	arbitraryprecisioncalculation::MpfVector GetLocalAttractorPosition();
 	/**
 	* @brief Calculates the objective function value of the local attractor.
 	*
@@ -75,15 +76,15 @@ public:
 	/**
 	* @brief Clones the position of the particle.
 	*
-	* @return The position.
+	* @return The position, which releases its values itself.
 	*/
-	std::vector<mpf_t*> GetPosition();
+	arbitraryprecisioncalculation::MpfVector GetPosition();
 	/**
 	* @brief Clones the velocity of the particle.
 	*
-	* @return The velocity.
+	* @return The velocity, which releases its values itself.
 	*/
-	std::vector<mpf_t*> GetVelocity();
+	arbitraryprecisioncalculation::MpfVector GetVelocity();
 
 	/**
 	* @brief Sets the position of the local attractor to the supplied position. 
@@ -101,11 +102,25 @@ public:
 	*/
 	void SetPosition(std::vector<mpf_t*> pos);
 	/**
+	* @brief Sets the position to the supplied position without cloning it.
+	*
+	* Behaves like SetPosition with a vector of mpf_t values, but takes over the ownership of the supplied values.
+	*
+	* @param pos The new position of the particle.
+	*/
+	void SetPosition(arbitraryprecisioncalculation::MpfVector && pos);
+	/**
 	* @brief Sets the velocity to the supplied velocity. 
 	*
 	* @param vel The new velocity of the particle.
 	*/
 	void SetVelocity(std::vector<mpf_t*> vel);
+	/**
+	* @brief Sets the velocity to the supplied velocity without cloning it.
+	*
+	* @param vel The new velocity of the particle.
+	*/
+	void SetVelocity(arbitraryprecisioncalculation::MpfVector && vel);
 
 	/**
 	* @brief Informs the neighborhood about a new local attractor, which might be relevant for the choice of a global attractor.
@@ -74,12 +74,10 @@ void VisualizeCurrentSwarm(){
 	bool bounds_out_of_range = false;
 	std::vector<std::vector<double> > bounds;
 	{
-		std::vector<mpf_t*> tmp = configuration::g_function->GetLowerSearchSpaceBound();
-		bounds.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp));
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
+		arbitraryprecisioncalculation::MpfVector tmp = configuration::g_function->GetLowerSearchSpaceBound();
+		bounds.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp.Get()));
 		tmp = configuration::g_function->GetUpperSearchSpaceBound();
-		bounds.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp));
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
+		bounds.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp.Get()));
 		for(auto v: bounds)for(auto a: v){
 			if(std::isnan(a) || !std::isfinite(a)){
 				bounds_out_of_range = true;
@@ -110,17 +108,14 @@ void VisualizeCurrentSwarm(){
 	for(unsigned int i = 0; i < (*swarm).size(); i++){
 		positions.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble((*swarm)[i]->position));
 		velocities.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble((*swarm)[i]->velocity));
-		std::vector<mpf_t*> tmp = (*swarm)[i]->GetLocalAttractorPosition();
-		local_attractors.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp));
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
+		arbitraryprecisioncalculation::MpfVector tmp = (*swarm)[i]->GetLocalAttractorPosition();
+		local_attractors.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp.Get()));
 		tmp = configuration::g_neighborhood->GetGlobalAttractorPosition((*swarm)[i]->id);
-		global_attractors.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp));
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
+		global_attractors.push_back(arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp.Get()));
 	}
 	{
-		std::vector<mpf_t*> tmp = configuration::g_neighborhood->GetGlobalAttractorPosition();
-		overall_global_attractor = arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp);
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
+		arbitraryprecisioncalculation::MpfVector tmp = configuration::g_neighborhood->GetGlobalAttractorPosition();
+		overall_global_attractor = arbitraryprecisioncalculation::vectoroperations::MpftToDouble(tmp.Get());
 	}
 	for(auto v: positions)for(auto a: v){
 		if(std::isnan(a) || !std::isfinite(a)){
@@ -204,7 +199,7 @@ void VisualizeCurrentSwarm(){
 		recent_limits.pop_back();
 	}
 	if( configuration::g_debug_swarm_show_global_attractor_on_terminal ){
-		std::vector<mpf_t*> tmp_vec = configuration::g_neighborhood->GetGlobalAttractorPosition();
+		arbitraryprecisioncalculation::MpfVector tmp_vec = configuration::g_neighborhood->GetGlobalAttractorPosition();
 		std::cout << "Step " << configuration::g_statistics->current_iteration << ": x=(";
 		for(unsigned int d = 0; d < global_attractors[0].size(); d++){
 			std::cout << arbitraryprecisioncalculation::mpftoperations::MpftToString(tmp_vec[d]) << " ";
@@ -212,7 +207,6 @@ void VisualizeCurrentSwarm(){
 		std::cout << "), f(x) ="; 
 		mpf_t* tmp = configuration::g_neighborhood->GetGlobalAttractorValue();
 		std::cout << arbitraryprecisioncalculation::mpftoperations::MpftToString(tmp) << std::endl;
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp_vec);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tmp);
 	}
 	if(image_generation_frequency == 0)return;
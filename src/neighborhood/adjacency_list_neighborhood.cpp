@@ -67,24 +67,23 @@ AdjacencyListNeighborhood::AdjacencyListNeighborhood(){
 	adjacency_list.clear();
 }
 
-std::vector<mpf_t*> AdjacencyListNeighborhood::GetGlobalAttractorPosition(){
+arbitraryprecisioncalculation::MpfVector AdjacencyListNeighborhood::GetGlobalAttractorPosition(){
 	int id = GetGlobalAttractorIndex();
-	return arbitraryprecisioncalculation::vectoroperations::Clone(global_attractor_positions_[id]);
+	return arbitraryprecisioncalculation::MpfVector::Copy(global_attractor_positions_[id]);
 }
 
-std::vector<mpf_t*> AdjacencyListNeighborhood::GetGlobalAttractorPosition(int particleId){
+arbitraryprecisioncalculation::MpfVector AdjacencyListNeighborhood::GetGlobalAttractorPosition(int particleId){
 	AssertCondition(particleId >= 0, "adjacency list neighborhood: Queried particle id is less than zero.");
 	AssertCondition(global_attractor_positions_.size() > (unsigned int)particleId, "adjacency list neighborhood: Queried particle id is larger than the largest id.");
-	return arbitraryprecisioncalculation::vectoroperations::Clone(global_attractor_positions_[particleId]);
+	return arbitraryprecisioncalculation::MpfVector::Copy(global_attractor_positions_[particleId]);
 }
 
 mpf_t* AdjacencyListNeighborhood::GetGlobalAttractorValue(int particleId){
 	AssertCondition(particleId >= 0, "adjacency list neighborhood: Queried particle id is less than zero.");
 	AssertCondition(global_attractor_positions_.size() > (unsigned int)particleId, "adjacency list neighborhood: Queried particle id is larger than the largest id.");
-	if(global_attractor_values_cached_precision_[particleId] != mpf_get_default_prec()
-			|| global_attractor_values_cached_[particleId] == NULL){
+	if(global_attractor_values_cached_[particleId] == NULL
+			|| configuration::g_function->PrecisionChangeAffectsEvaluation(global_attractor_values_cached_precision_[particleId], mpf_get_default_prec())){
 
-		global_attractor_values_cached_precision_[particleId] = mpf_get_default_prec();
 		global_attractor_index_ = -1;
 		if(global_attractor_values_cached_[particleId] != NULL){
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(global_attractor_values_cached_[particleId]);
@@ -92,6 +91,7 @@ mpf_t* AdjacencyListNeighborhood::GetGlobalAttractorValue(int particleId){
 		}
 		global_attractor_values_cached_[particleId] = configuration::g_function->Evaluate(global_attractor_positions_[particleId]);
 		arbitraryprecisioncalculation::mpftoperations::ChangeNumberOfMpftValuesCached(1);
+		global_attractor_values_cached_precision_[particleId] = mpf_get_default_prec();
 	}
 	return arbitraryprecisioncalculation::mpftoperations::Clone(global_attractor_values_cached_[particleId]);
 }
@@ -125,7 +125,7 @@ void AdjacencyListNeighborhood::UpdateAttractorInstantly(std::vector<mpf_t*> pos
 		} else {
 			AssertCondition(global_attractor_positions_[id].size() == position.size(), "adjacency list neighborhood: The number of dimensions is inconsistent.");
 			mpf_t* curvalue = GetGlobalAttractorValue(id);
-			if(arbitraryprecisioncalculation::mpftoperations::Compare(value, curvalue) <= 0) {
+			if(arbitraryprecisioncalculation::mpftoperations::Compare(value, curvalue, "AdjacencyListNeighborhood::UpdateAttractorInstantly") <= 0) {
 				global_attractor_index_ = -1;
 				configuration::g_statistics->global_attractor_update_counter[particleId]++;
 				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(global_attractor_positions_[id]);
@@ -146,7 +146,7 @@ int AdjacencyListNeighborhood::GetGlobalAttractorIndex(){
 		mpf_t* best = GetGlobalAttractorValue(0);
 		for(int i = 1; i < configuration::g_particles; i++) {
 			mpf_t* cur = GetGlobalAttractorValue(i);
-			if(arbitraryprecisioncalculation::mpftoperations::Compare(best, cur) >= 0) {
+			if(arbitraryprecisioncalculation::mpftoperations::Compare(best, cur, "AdjacencyListNeighborhood::GetGlobalAttractorIndex") >= 0) {
 				std::swap(best, cur);
 				id = i;
 			}
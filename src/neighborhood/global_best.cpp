@@ -58,14 +58,14 @@ GlobalBest::GlobalBest(){
 	global_attractor_value_cached_precision_ = 1;
 }
 
-std::vector<mpf_t*> GlobalBest::GetGlobalAttractorPosition(){
-	return arbitraryprecisioncalculation::vectoroperations::Clone(global_attractor_position_);
+arbitraryprecisioncalculation::MpfVector GlobalBest::GetGlobalAttractorPosition(){
+	return arbitraryprecisioncalculation::MpfVector::Copy(global_attractor_position_);
 }
 
-std::vector<mpf_t*> GlobalBest::GetGlobalAttractorPosition(int particleId){
+arbitraryprecisioncalculation::MpfVector GlobalBest::GetGlobalAttractorPosition(int particleId){
 	AssertCondition(particleId >= 0, "adjacency list neighborhood: Queried particle id is less than zero.");
 	AssertCondition(configuration::g_particles > particleId, "adjacency list neighborhood: Queried particle id is larger than the largest id.");
-	return arbitraryprecisioncalculation::vectoroperations::Clone(global_attractor_position_);
+	return arbitraryprecisioncalculation::MpfVector::Copy(global_attractor_position_);
 }
 
 mpf_t* GlobalBest::GetGlobalAttractorValue(int particleId){
@@ -74,7 +74,7 @@ mpf_t* GlobalBest::GetGlobalAttractorValue(int particleId){
 
 mpf_t* GlobalBest::GetGlobalAttractorValue(){
 	if(global_attractor_value_cached_ == NULL
-			|| mpf_get_default_prec() != global_attractor_value_cached_precision_){
+			|| configuration::g_function->PrecisionChangeAffectsEvaluation(global_attractor_value_cached_precision_, mpf_get_default_prec())){
 		if(global_attractor_value_cached_ == NULL) arbitraryprecisioncalculation::mpftoperations::ChangeNumberOfMpftValuesCached(1);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(global_attractor_value_cached_);
 		global_attractor_value_cached_ = configuration::g_function->Evaluate(global_attractor_position_);
@@ -94,7 +94,7 @@ void GlobalBest::UpdateAttractorInstantly(std::vector<mpf_t*> position, mpf_t* v
 	} else {
 		AssertCondition(global_attractor_position_.size() == position.size(), "The number of dimensions is inconsistent.");
 		mpf_t* curvalue = GetGlobalAttractorValue(particleId);
-		if(arbitraryprecisioncalculation::mpftoperations::Compare(value, curvalue) <= 0) {
+		if(arbitraryprecisioncalculation::mpftoperations::Compare(value, curvalue, "GlobalBest::UpdateAttractorInstantly") <= 0) {
 			configuration::g_statistics->global_attractor_update_counter[particleId]++;
 			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(global_attractor_position_);
 			global_attractor_position_ = arbitraryprecisioncalculation::vectoroperations::Clone(position);
@@ -57,8 +57,8 @@ public:
 	* @brief The destructor.
 	*/
 	~GlobalBest();
-	std::vector<mpf_t*> GetGlobalAttractorPosition();
-	std::vector<mpf_t*> GetGlobalAttractorPosition(int particle_id);
+	arbitraryprecisioncalculation::MpfVector GetGlobalAttractorPosition();
+	arbitraryprecisioncalculation::MpfVector GetGlobalAttractorPosition(int particle_id);
 	mpf_t* GetGlobalAttractorValue();
 	mpf_t* GetGlobalAttractorValue(int particle_id);
 	void UpdateAttractorInstantly(std::vector<mpf_t*> position, mpf_t* value, int particle_id);
@@ -53,7 +53,7 @@ Neighborhood::~Neighborhood(){
 	}
 }
 
-std::vector<mpf_t*> Neighborhood::GetGlobalAttractorPosition(Particle* p){
+arbitraryprecisioncalculation::MpfVector Neighborhood::GetGlobalAttractorPosition(Particle* p){
 	return GetGlobalAttractorPosition(p->id);
 }
 
@@ -64,23 +64,23 @@ public:
 	*
 	* @param p The particle.
 	*
-	* @return The position of the global attractor for particle p.
+	* @return The position of the global attractor for particle p, which releases its values itself.
 	*/
-	std::vector<mpf_t*> GetGlobalAttractorPosition(Particle* p);
+	arbitraryprecisioncalculation::MpfVector GetGlobalAttractorPosition(Particle* p);
 	/**
 	* @brief Returns the position of the global attractor for the particle with the specified particle_id.
 	*
 	* @param particle_id The index of the particle.
 	*
-	* @return The position of the global attractor for the particle with index particle_id.
+	* @return The position of the global attractor for the particle with index particle_id, which releases its values itself.
 	*/
-	virtual std::vector<mpf_t*> GetGlobalAttractorPosition(int particle_id) = 0;
+	virtual arbitraryprecisioncalculation::MpfVector GetGlobalAttractorPosition(int particle_id) = 0;
 	/**
 	* @brief Returns the position of the best global attractor.
 	*
-	* @return The position of the best global attractor.
+	* @return The position of the best global attractor, which releases its values itself.
 	*/
-	virtual std::vector<mpf_t*> GetGlobalAttractorPosition() = 0;
+	virtual arbitraryprecisioncalculation::MpfVector GetGlobalAttractorPosition() = 0;
 	/**
 	* @brief Returns the value of the global attractor for the particle p.
 	*
@@ -44,6 +44,7 @@
 
 #include "bound_handling/bound_handling.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 #include "neighborhood/neighborhood.h"
@@ -51,34 +52,23 @@
 namespace highprecisionpso {
 
 void DefaultUpdater::Update(Particle* p) {
-	std::vector<mpf_t*> localDir = configuration::g_bound_handling->GetDirectionVector(
+	std::vector<mpf_t*> localPart = configuration::g_bound_handling->GetDirectionVector(
 			p->position, p->local_attractor_position);
-	std::vector<mpf_t*> helperVector = arbitraryprecisioncalculation::vectoroperations::Randomize(localDir);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
-	localDir = helperVector;
-	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
-	std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
-	helperVector = arbitraryprecisioncalculation::vectoroperations::Randomize(globalDir);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
-	globalDir = helperVector;
-	std::vector<mpf_t*> localPart = arbitraryprecisioncalculation::vectoroperations::Multiply(localDir,
+	arbitraryprecisioncalculation::vectoroperations::RandomizeTo(&localPart, localPart);
+	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	std::vector<mpf_t*> globalPart = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos.Get());
+	arbitraryprecisioncalculation::vectoroperations::RandomizeTo(&globalPart, globalPart);
+	arbitraryprecisioncalculation::vectoroperations::MultiplyTo(&localPart, localPart,
 			configuration::g_coefficient_local_attractor);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
-	std::vector<mpf_t*> globalPart = arbitraryprecisioncalculation::vectoroperations::Multiply(globalDir,
+	arbitraryprecisioncalculation::vectoroperations::MultiplyTo(&globalPart, globalPart,
 			configuration::g_coefficient_global_attractor);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
-	std::vector<mpf_t*> oldVelocityPart = arbitraryprecisioncalculation::vectoroperations::Multiply(p->velocity,
+	std::vector<mpf_t*> newVelocity = arbitraryprecisioncalculation::vectoroperations::Multiply(p->velocity,
 			configuration::g_chi);
-	helperVector = arbitraryprecisioncalculation::vectoroperations::Add(localPart, globalPart);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localPart);
+	arbitraryprecisioncalculation::vectoroperations::AddTo(&localPart, localPart, globalPart);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalPart);
-	std::vector<mpf_t*> newVelocity = arbitraryprecisioncalculation::vectoroperations::Add(oldVelocityPart,
-			helperVector);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldVelocityPart);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(helperVector);
-	p->SetVelocity(newVelocity);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newVelocity);
+	arbitraryprecisioncalculation::vectoroperations::AddTo(&newVelocity, newVelocity, localPart);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localPart);
+	p->SetVelocity(arbitraryprecisioncalculation::MpfVector::Adopt(newVelocity));
 	configuration::g_bound_handling->SetParticleUpdate(p);
 }
 
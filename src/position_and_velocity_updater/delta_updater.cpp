@@ -45,6 +45,7 @@
 #include "bound_handling/bound_handling.h"
 #include "general/check_condition.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 #include "neighborhood/neighborhood.h"
@@ -61,27 +62,22 @@ DeltaUpdater::DeltaUpdater(double initial_delta, double gamma):initial_delta_(in
 
 void DeltaUpdater::Update(Particle* p) {
     std::vector<bool> deltaUpdate = DimensionsOfDeltaUpdate(p);
-	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
 
     // calculate new velocity in case of delta update
     std::vector<mpf_t*> part = arbitraryprecisioncalculation::vectoroperations::GetConstantVector(configuration::g_dimensions, delta_);
     std::vector<mpf_t*> part1M = arbitraryprecisioncalculation::vectoroperations::Multiply(part, 2.0);
-    std::vector<mpf_t*> part1Rand = arbitraryprecisioncalculation::vectoroperations::Randomize(part1M);
-    std::vector<mpf_t*> newVelocity1 = arbitraryprecisioncalculation::vectoroperations::Subtract(part1Rand, part); // new velocity for delta update dimensions
+    arbitraryprecisioncalculation::vectoroperations::RandomizeTo(&part1M, part1M);
+    std::vector<mpf_t*> newVelocity1 = arbitraryprecisioncalculation::vectoroperations::Subtract(part1M, part); // new velocity for delta update dimensions
     arbitraryprecisioncalculation::vectoroperations::ReleaseValues(part);
     arbitraryprecisioncalculation::vectoroperations::ReleaseValues(part1M);
-    arbitraryprecisioncalculation::vectoroperations::ReleaseValues(part1Rand);
 
     // calculate new velocity in case of standard update
     std::vector<mpf_t*> localDir = configuration::g_bound_handling->GetDirectionVector(
             p->position, p->local_attractor_position);
-    std::vector<mpf_t*> helperVector = arbitraryprecisioncalculation::vectoroperations::Randomize(localDir);
-    arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
-    localDir = helperVector;
-    std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos);
-    helperVector = arbitraryprecisioncalculation::vectoroperations::Randomize(globalDir);
-    arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
-    globalDir = helperVector;
+    arbitraryprecisioncalculation::vectoroperations::RandomizeTo(&localDir, localDir);
+    std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos.Get());
+    arbitraryprecisioncalculation::vectoroperations::RandomizeTo(&globalDir, globalDir);
     std::vector<mpf_t*> localPart = arbitraryprecisioncalculation::vectoroperations::Multiply(localDir,
             configuration::g_coefficient_local_attractor);
     arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
@@ -90,7 +86,7 @@ void DeltaUpdater::Update(Particle* p) {
     arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
     std::vector<mpf_t*> oldVelocityPart = arbitraryprecisioncalculation::vectoroperations::Multiply(p->velocity,
             configuration::g_chi);
-    helperVector = arbitraryprecisioncalculation::vectoroperations::Add(localPart, globalPart);
+    std::vector<mpf_t*> helperVector = arbitraryprecisioncalculation::vectoroperations::Add(localPart, globalPart);
     arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localPart);
     arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalPart);
     std::vector<mpf_t*> newVelocity = arbitraryprecisioncalculation::vectoroperations::Add(oldVelocityPart,
@@ -113,10 +109,8 @@ void DeltaUpdater::Update(Particle* p) {
             std::swap(newVelocity[d], newVelocity1[d]);
         }
     }
-    p->SetVelocity(newVelocity);
+    p->SetVelocity(arbitraryprecisioncalculation::MpfVector::Adopt(newVelocity));
     arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newVelocity1);
-    arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newVelocity);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
 	configuration::g_bound_handling->SetParticleUpdate(p);
 }
 
@@ -130,20 +124,19 @@ std::string DeltaUpdater::GetName(){
 
 std::vector<bool> DeltaUpdater::DimensionsOfDeltaUpdate(Particle* p){
 	bool deltaUpdate = true;
-   	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
-	std::vector<mpf_t*> globalDirTmp = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos);
+   	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	std::vector<mpf_t*> globalDirTmp = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos.Get());
 	for(int d = 0; d < configuration::g_dimensions; ++d){
 		mpf_t* v1 = arbitraryprecisioncalculation::mpftoperations::Abs(globalDirTmp[d]);
 		mpf_t* v2 = arbitraryprecisioncalculation::mpftoperations::Abs(p->velocity[d]);
 		mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add(v1, v2);
-		deltaUpdate = (arbitraryprecisioncalculation::mpftoperations::Compare(sum, delta_) < 0);
+		deltaUpdate = (arbitraryprecisioncalculation::mpftoperations::Compare(sum, delta_, "DeltaUpdater::DimensionsOfDeltaUpdate") < 0);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v2);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
 		if(!deltaUpdate)break;
 	}
    	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDirTmp);
-    arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
     return std::vector<bool>(configuration::g_dimensions, deltaUpdate);
 }
 
@@ -201,14 +194,14 @@ DeltaUpdaterTCS::DeltaUpdaterTCS(double initial_delta, double gamma):DeltaUpdate
 
 std::vector<bool> DeltaUpdaterTCS::DimensionsOfDeltaUpdate(Particle* p){
 	std::vector<bool> deltaUpdate(configuration::g_dimensions, true);
-   	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+   	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
     for(auto pp: *(configuration::g_statistics->swarm)){
-        std::vector<mpf_t*> globalDirTmp = configuration::g_bound_handling->GetDirectionVector(pp->position, glAtPos);
+        std::vector<mpf_t*> globalDirTmp = configuration::g_bound_handling->GetDirectionVector(pp->position, glAtPos.Get());
         for(int d = 0; d < configuration::g_dimensions; ++d){
             mpf_t* v1 = arbitraryprecisioncalculation::mpftoperations::Abs(globalDirTmp[d]);
             mpf_t* v2 = arbitraryprecisioncalculation::mpftoperations::Abs(pp->velocity[d]);
             mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add(v1, v2);
-            if(! (arbitraryprecisioncalculation::mpftoperations::Compare(sum, delta_) < 0) ){
+            if(! (arbitraryprecisioncalculation::mpftoperations::Compare(sum, delta_, "DeltaUpdaterTCS::DimensionsOfDeltaUpdate") < 0) ){
                 deltaUpdate[d] = false;
             }
             arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
@@ -217,7 +210,6 @@ std::vector<bool> DeltaUpdaterTCS::DimensionsOfDeltaUpdate(Particle* p){
         }
        	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDirTmp);
     }
-    arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
     return deltaUpdate;
 }
 
@@ -46,6 +46,7 @@
 #include "bound_handling/bound_handling.h"
 #include "general/check_condition.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 #include "neighborhood/neighborhood.h"
@@ -61,160 +62,104 @@ void DimensionIndependentUpdater::Update(Particle* p) {
 	std::vector<mpf_t*> nextVelocity = arbitraryprecisioncalculation::vectoroperations::Multiply(p->velocity,
 			configuration::g_chi);
 
-	std::vector<mpf_t*> localAttractorPosition = p->GetLocalAttractorPosition();
-	std::vector<mpf_t*> globalAttractorPosition = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	arbitraryprecisioncalculation::MpfVector localAttractorPosition = p->GetLocalAttractorPosition();
+	arbitraryprecisioncalculation::MpfVector globalAttractorPosition = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
 
 	std::vector<mpf_t*> main_direction;
-	if(!arbitraryprecisioncalculation::vectoroperations::Equals(localAttractorPosition, globalAttractorPosition)){
-		main_direction = configuration::g_bound_handling->GetDirectionVector(globalAttractorPosition, localAttractorPosition);
-	} else if(!arbitraryprecisioncalculation::vectoroperations::Equals(p->position, globalAttractorPosition)){
-		main_direction = configuration::g_bound_handling->GetDirectionVector(globalAttractorPosition, p->position);
+	if(!arbitraryprecisioncalculation::vectoroperations::Equals(localAttractorPosition.Get(), globalAttractorPosition.Get())){
+		main_direction = configuration::g_bound_handling->GetDirectionVector(globalAttractorPosition.Get(), localAttractorPosition.Get());
+	} else if(!arbitraryprecisioncalculation::vectoroperations::Equals(p->position, globalAttractorPosition.Get())){
+		main_direction = configuration::g_bound_handling->GetDirectionVector(globalAttractorPosition.Get(), p->position);
 	}
 	
 	if(!main_direction.empty()) {
 		std::vector<mpf_t*> localDir = configuration::g_bound_handling->GetDirectionVector(
-				p->position, localAttractorPosition);
+				p->position, localAttractorPosition.Get());
 		std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(
-				p->position, globalAttractorPosition);
+				p->position, globalAttractorPosition.Get());
 		std::vector<std::vector<mpf_t*> > used_directions;
 		std::vector<mpf_t*> remaining_main_direction = main_direction;
 
 		for(int dirs = 0; dirs < max_directions_ - 1; dirs++){
 			std::vector<mpf_t*> random_direction;
-			for(int d = 0; d < configuration::g_dimensions; d++){
-				random_direction.push_back(arbitraryprecisioncalculation::mpftoperations::GetGaussianRandomMpft(0.0, 1.0));
-			}
+			arbitraryprecisioncalculation::vectoroperations::FillGaussianRandom(&random_direction, configuration::g_dimensions, 0.0, 1.0);
 			// remove used directions
 			for(unsigned int i = 0; i < used_directions.size(); i++){
 				std::vector<mpf_t*> projection = arbitraryprecisioncalculation::vectoroperations::OrthogonalProjection(random_direction, used_directions[i]);
-				std::vector<mpf_t*> remaining = arbitraryprecisioncalculation::vectoroperations::Subtract(random_direction, projection);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(random_direction);
+				arbitraryprecisioncalculation::vectoroperations::SubtractTo(&random_direction, random_direction, projection);
 				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(projection);
-				random_direction = remaining;
 			}
 			// remove remaining main direction
 			{
 				std::vector<mpf_t*> projection = arbitraryprecisioncalculation::vectoroperations::OrthogonalProjection(random_direction, remaining_main_direction);
-				std::vector<mpf_t*> remaining = arbitraryprecisioncalculation::vectoroperations::Subtract(random_direction, projection);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(random_direction);
+				arbitraryprecisioncalculation::vectoroperations::SubtractTo(&random_direction, random_direction, projection);
 				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(projection);
-				random_direction = remaining;
 			}
 			// scale random direction to correct relative length of remaining main direction
-			mpf_t* random_direction_length;
-			{
-				std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Multiply(random_direction, random_direction);
-				random_direction_length = arbitraryprecisioncalculation::vectoroperations::Add(tmp);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
-			}
-			mpf_t* remaining_main_direction_length;
-			{
-				std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Multiply(remaining_main_direction, remaining_main_direction);
-				remaining_main_direction_length = arbitraryprecisioncalculation::vectoroperations::Add(tmp);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
-			}
+			mpf_t* random_direction_length = arbitraryprecisioncalculation::vectoroperations::Dot(random_direction, random_direction);
+			mpf_t* remaining_main_direction_length = arbitraryprecisioncalculation::vectoroperations::Dot(remaining_main_direction, remaining_main_direction);
 			AssertCondition(arbitraryprecisioncalculation::mpftoperations::Compare( random_direction_length, 0.0 ) > 0, "This is an internal error in the dimension independent updater. Please contact the program author.");
 			AssertCondition(arbitraryprecisioncalculation::mpftoperations::Compare( remaining_main_direction_length, 0.0 ) > 0, "This is an internal error in the dimension independent updater. Please contact the program author.");
 			mpf_t* squared_scale = arbitraryprecisioncalculation::mpftoperations::Divide(remaining_main_direction_length, random_direction_length);
 			mpf_t* scale = arbitraryprecisioncalculation::mpftoperations::Sqrt(squared_scale);
-			std::vector<mpf_t*> scaled_random_direction = arbitraryprecisioncalculation::vectoroperations::Multiply(random_direction, scale);
-			std::vector<mpf_t*> reduced_random_direction = arbitraryprecisioncalculation::vectoroperations::Multiply(scaled_random_direction, reduction_);
+			arbitraryprecisioncalculation::vectoroperations::MultiplyTo(&random_direction, random_direction, scale);
+			arbitraryprecisioncalculation::vectoroperations::MultiplyTo(&random_direction, random_direction, reduction_);
 			// the next direction consists of the remaining main direction and the reduced random direction
-			std::vector<mpf_t*> next_direction = arbitraryprecisioncalculation::vectoroperations::Add(reduced_random_direction, remaining_main_direction);
+			std::vector<mpf_t*> next_direction;
+			arbitraryprecisioncalculation::vectoroperations::AddTo(&next_direction, random_direction, remaining_main_direction);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(squared_scale);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(scale);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(random_direction_length);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(remaining_main_direction_length);
 			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(random_direction);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scaled_random_direction);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(reduced_random_direction);
 			// update velocity in the current direction and update remaining vectors
 			std::vector<mpf_t*> curLocalDir = arbitraryprecisioncalculation::vectoroperations::OrthogonalProjection(localDir, next_direction);
-			{
-				std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Subtract(localDir, curLocalDir);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
-				localDir = tmp;
-			}
+			arbitraryprecisioncalculation::vectoroperations::SubtractTo(&localDir, localDir, curLocalDir);
 			// - update velocity with local attractor
 			mpf_t* local_part_scale = arbitraryprecisioncalculation::mpftoperations::ToMpft(configuration::g_coefficient_local_attractor);
 			mpf_t* local_part_randomized = arbitraryprecisioncalculation::mpftoperations::Randomize(local_part_scale);
-			std::vector<mpf_t*> curLocalPart = arbitraryprecisioncalculation::vectoroperations::Multiply(
-					curLocalDir,
-					local_part_randomized);
+			arbitraryprecisioncalculation::vectoroperations::ScaleAdd(&nextVelocity, nextVelocity, local_part_randomized, curLocalDir);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(local_part_scale);
 			local_part_scale = NULL;
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(local_part_randomized);
 			local_part_randomized = NULL;
-
-			{
-				std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Add(nextVelocity, curLocalPart);
-				std::swap(tmp, nextVelocity);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
-			}
 			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(curLocalDir);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(curLocalPart);
 
 			std::vector<mpf_t*> curGlobalDir = arbitraryprecisioncalculation::vectoroperations::OrthogonalProjection(globalDir, next_direction);
-			{
-				std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Subtract(globalDir, curGlobalDir);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
-				globalDir = tmp;
-			}
+			arbitraryprecisioncalculation::vectoroperations::SubtractTo(&globalDir, globalDir, curGlobalDir);
 			// - update velocity with global attractor
 			mpf_t* global_part_scale = arbitraryprecisioncalculation::mpftoperations::ToMpft(configuration::g_coefficient_global_attractor);
 			mpf_t* global_part_randomized = arbitraryprecisioncalculation::mpftoperations::Randomize(global_part_scale);
-			std::vector<mpf_t*> curGlobalPart = arbitraryprecisioncalculation::vectoroperations::Multiply(curGlobalDir, global_part_randomized);
+			arbitraryprecisioncalculation::vectoroperations::ScaleAdd(&nextVelocity, nextVelocity, global_part_randomized, curGlobalDir);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(global_part_scale);
 			global_part_scale = NULL;
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(global_part_randomized);
 			global_part_randomized = NULL;
-			{
-				std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Add(nextVelocity, curGlobalPart);
-				std::swap(tmp, nextVelocity);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
-			}
 			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(curGlobalDir);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(curGlobalPart);
 
 			used_directions.push_back(next_direction);
 			{
-				std::vector<mpf_t*> tmp1 = arbitraryprecisioncalculation::vectoroperations::OrthogonalProjection(remaining_main_direction, next_direction);
-				std::vector<mpf_t*> tmp2 = arbitraryprecisioncalculation::vectoroperations::Subtract(remaining_main_direction, tmp1);
-				std::swap(tmp2, remaining_main_direction);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp1);
-				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp2);
+				std::vector<mpf_t*> projection = arbitraryprecisioncalculation::vectoroperations::OrthogonalProjection(remaining_main_direction, next_direction);
+				arbitraryprecisioncalculation::vectoroperations::SubtractTo(&remaining_main_direction, remaining_main_direction, projection);
+				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(projection);
 			}
 		}
 		// - update velocity with remaining local attractor
 		mpf_t* local_part_scale = arbitraryprecisioncalculation::mpftoperations::ToMpft(configuration::g_coefficient_local_attractor);
 		mpf_t* local_part_randomized = arbitraryprecisioncalculation::mpftoperations::Randomize(local_part_scale);
-		std::vector<mpf_t*> localPart = arbitraryprecisioncalculation::vectoroperations::Multiply(
-				localDir,
-				local_part_randomized);
+		arbitraryprecisioncalculation::vectoroperations::ScaleAdd(&nextVelocity, nextVelocity, local_part_randomized, localDir);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(local_part_scale);
 		local_part_scale = NULL;
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(local_part_randomized);
 		local_part_randomized = NULL;
-		{
-			std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Add(nextVelocity, localPart);
-			std::swap(tmp, nextVelocity);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
-		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localPart);
 		// - update velocity with remaining global attractor
 		mpf_t* global_part_scale = arbitraryprecisioncalculation::mpftoperations::ToMpft(configuration::g_coefficient_global_attractor);
 		mpf_t* global_part_randomized = arbitraryprecisioncalculation::mpftoperations::Randomize(global_part_scale);
-		std::vector<mpf_t*> globalPart = arbitraryprecisioncalculation::vectoroperations::Multiply(globalDir, global_part_randomized);
+		arbitraryprecisioncalculation::vectoroperations::ScaleAdd(&nextVelocity, nextVelocity, global_part_randomized, globalDir);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(global_part_scale);
 		global_part_scale = NULL;
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(global_part_randomized);
 		global_part_randomized = NULL;
-		{
-			std::vector<mpf_t*> tmp = arbitraryprecisioncalculation::vectoroperations::Add(nextVelocity, globalPart);
-			std::swap(tmp, nextVelocity);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
-		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalPart);
 
 		for(unsigned int i = 0; i < used_directions.size(); i++){
 			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(used_directions[i]);
@@ -223,10 +168,7 @@ void DimensionIndependentUpdater::Update(Particle* p) {
 		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
 		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
 	}
-	p->SetVelocity(nextVelocity);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(nextVelocity);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localAttractorPosition);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalAttractorPosition);
+	p->SetVelocity(arbitraryprecisioncalculation::MpfVector::Adopt(nextVelocity));
 	configuration::g_bound_handling->SetParticleUpdate(p);
 }
 
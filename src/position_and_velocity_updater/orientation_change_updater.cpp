@@ -46,6 +46,7 @@
 
 #include "bound_handling/bound_handling.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 #include "neighborhood/neighborhood.h"
@@ -70,28 +71,30 @@ void OrientationChangeUpdater::Update(Particle* p) {
 	}
 	std::vector<mpf_t*> localDir = configuration::g_bound_handling->GetDirectionVector(
 			p->position, p->local_attractor_position);
-	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
-	std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
+	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos.Get());
 	std::pair<double, int> lowest = std::make_pair(1e301, -1), highest = std::make_pair(-1e301, -1);
 	std::vector<mpf_t*> velRot = Rotation(p->velocity);
 	std::vector<mpf_t*> globalRot = Rotation(globalDir);
 	std::vector<mpf_t*> localRot = Rotation(localDir);
-	for(int d = 0; d < configuration::g_dimensions; ++d){
-		mpf_t* v1 = arbitraryprecisioncalculation::mpftoperations::Abs(velRot[d]);
-		mpf_t* v2 = arbitraryprecisioncalculation::mpftoperations::Abs(globalRot[d]);
-		mpf_t* v3 = arbitraryprecisioncalculation::mpftoperations::Abs(localRot[d]);
-		mpf_t* sum1 = arbitraryprecisioncalculation::mpftoperations::Add(v1, v2);
-		mpf_t* sum2 = arbitraryprecisioncalculation::mpftoperations::Add(sum1, v3);
-		double logv = arbitraryprecisioncalculation::mpftoperations::Log2Double(sum2);
+	{
+		mpf_t* v1 = NULL;
+		mpf_t* v2 = NULL;
+		mpf_t* v3 = NULL;
+		for(int d = 0; d < configuration::g_dimensions; ++d){
+			arbitraryprecisioncalculation::mpftoperations::AbsTo(&v1, velRot[d]);
+			arbitraryprecisioncalculation::mpftoperations::AbsTo(&v2, globalRot[d]);
+			arbitraryprecisioncalculation::mpftoperations::AbsTo(&v3, localRot[d]);
+			arbitraryprecisioncalculation::mpftoperations::AddTo(&v1, v1, v2);
+			arbitraryprecisioncalculation::mpftoperations::AddTo(&v1, v1, v3);
+			double logv = arbitraryprecisioncalculation::mpftoperations::Log2Double(v1);
+			std::pair<double,int> cur = std::make_pair(logv, d);
+			lowest = std::min(lowest, cur);
+			highest = std::max(highest, cur);
+		}
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v2);
 		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v3);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum1);
-		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum2);
-		std::pair<double,int> cur = std::make_pair(logv, d);
-		lowest = std::min(lowest, cur);
-		highest = std::max(highest, cur);
 	}
 
 	if(highest.first - lowest.first > log2_limit_){
@@ -100,20 +103,17 @@ void OrientationChangeUpdater::Update(Particle* p) {
 			mpf_t* two = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.5);
 			mpf_t* sq2 = arbitraryprecisioncalculation::mpftoperations::Sqrt(two);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(two);
-			std::vector<mpf_t*> vec1, vec2;
+			mpf_t* sum = NULL;
 			for(int d = 0; d < configuration::g_dimensions; ++d){
-				mpf_t* v = arbitraryprecisioncalculation::mpftoperations::Add(orthogonal_transformation_matrix_[d1][d], orthogonal_transformation_matrix_[d2][d]);
-				vec1.push_back(arbitraryprecisioncalculation::mpftoperations::Multiply(v, sq2));
-				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v);
-				v = arbitraryprecisioncalculation::mpftoperations::Subtract(orthogonal_transformation_matrix_[d1][d], orthogonal_transformation_matrix_[d2][d]);
-				vec2.push_back(arbitraryprecisioncalculation::mpftoperations::Multiply(v, sq2));
-				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v);
+				mpf_t** entry1 = &orthogonal_transformation_matrix_[d1][d];
+				mpf_t** entry2 = &orthogonal_transformation_matrix_[d2][d];
+				arbitraryprecisioncalculation::mpftoperations::AddTo(&sum, *entry1, *entry2);
+				arbitraryprecisioncalculation::mpftoperations::SubtractTo(entry2, *entry1, *entry2);
+				arbitraryprecisioncalculation::mpftoperations::MultiplyTo(entry2, *entry2, sq2);
+				arbitraryprecisioncalculation::mpftoperations::MultiplyTo(entry1, sum, sq2);
 			}
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sq2);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(orthogonal_transformation_matrix_[d1]);
-			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(orthogonal_transformation_matrix_[d2]);
-			orthogonal_transformation_matrix_[d1] = vec1;
-			orthogonal_transformation_matrix_[d2] = vec2;
 
 			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(velRot);
 			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalRot);
@@ -154,15 +154,17 @@ void OrientationChangeUpdater::Update(Particle* p) {
 	std::vector<mpf_t*> lRotRan = arbitraryprecisioncalculation::vectoroperations::Randomize(localRot);
 	std::vector<mpf_t*> gRotRan = arbitraryprecisioncalculation::vectoroperations::Randomize(globalRot);
 
-	std::vector<mpf_t*> scaledGRotRan = arbitraryprecisioncalculation::vectoroperations::Multiply(gRotRan, configuration::g_coefficient_global_attractor);
-	std::vector<mpf_t*> scaledLRotRan = arbitraryprecisioncalculation::vectoroperations::Multiply(lRotRan, configuration::g_coefficient_local_attractor);
-
-	std::vector<mpf_t*> rotRan = arbitraryprecisioncalculation::vectoroperations::Add(scaledGRotRan, scaledLRotRan);
-
-	std::vector<mpf_t*> randomPart = InverseRotation(rotRan);
-	std::vector<mpf_t*> oldPart = arbitraryprecisioncalculation::vectoroperations::Multiply(p->velocity, configuration::g_chi);
+	mpf_t* global_coefficient = arbitraryprecisioncalculation::mpftoperations::ToMpft(configuration::g_coefficient_global_attractor);
+	mpf_t* local_coefficient = arbitraryprecisioncalculation::mpftoperations::ToMpft(configuration::g_coefficient_local_attractor);
+	std::vector<mpf_t*> rotRan;
+	arbitraryprecisioncalculation::vectoroperations::Axpby(&rotRan, global_coefficient, gRotRan, local_coefficient, lRotRan);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(global_coefficient);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(local_coefficient);
 
-	std::vector<mpf_t*> newVelocity = arbitraryprecisioncalculation::vectoroperations::Add(randomPart, oldPart);
+	std::vector<mpf_t*> newVelocity = InverseRotation(rotRan);
+	mpf_t* chi = arbitraryprecisioncalculation::mpftoperations::ToMpft(configuration::g_chi);
+	arbitraryprecisioncalculation::vectoroperations::ScaleAdd(&newVelocity, newVelocity, chi, p->velocity);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(chi);
 
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
@@ -171,14 +173,9 @@ void OrientationChangeUpdater::Update(Particle* p) {
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localRot);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(gRotRan);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(lRotRan);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scaledGRotRan);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scaledLRotRan);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(rotRan);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(randomPart);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldPart);
 
-	p->SetVelocity(newVelocity);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newVelocity);
+	p->SetVelocity(arbitraryprecisioncalculation::MpfVector::Adopt(newVelocity));
 	configuration::g_bound_handling->SetParticleUpdate(p);
 }
 
@@ -192,32 +189,23 @@ std::string OrientationChangeUpdater::GetName(){
 std::vector<mpf_t*> OrientationChangeUpdater::Rotation(std::vector<mpf_t*> v){
 	std::vector<mpf_t*> res;
 	for(int d = 0; d < configuration::g_dimensions; ++d){
-		mpf_t* next = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0);
-		for(int i = 0; i < configuration::g_dimensions; ++i){
-			mpf_t* cur = arbitraryprecisioncalculation::mpftoperations::Multiply(v[i], orthogonal_transformation_matrix_[d][i]);
-			mpf_t* prev = next;
-			next = arbitraryprecisioncalculation::mpftoperations::Add(cur, prev);
-			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cur);
-			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(prev);
-		}
-		res.push_back(next);
+		res.push_back(arbitraryprecisioncalculation::vectoroperations::Dot(v, orthogonal_transformation_matrix_[d]));
 	}
 	return res;
 }
 
 std::vector<mpf_t*> OrientationChangeUpdater::InverseRotation(std::vector<mpf_t*> v){
 	std::vector<mpf_t*> res;
+	mpf_t* cur = NULL;
 	for(int d = 0; d < configuration::g_dimensions; ++d){
 		mpf_t* next = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0);
 		for(int i = 0; i < configuration::g_dimensions; ++i){
-			mpf_t* cur = arbitraryprecisioncalculation::mpftoperations::Multiply(v[i], orthogonal_transformation_matrix_[i][d]);
-			mpf_t* prev = next;
-			next = arbitraryprecisioncalculation::mpftoperations::Add(cur, prev);
-			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cur);
-			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(prev);
+			arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&cur, v[i], orthogonal_transformation_matrix_[i][d]);
+			arbitraryprecisioncalculation::mpftoperations::AddTo(&next, cur, next);
 		}
 		res.push_back(next);
 	}
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cur);
 	return res;
 }
 
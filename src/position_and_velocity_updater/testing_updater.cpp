@@ -46,6 +46,7 @@
 #include "bound_handling/bound_handling.h"
 #include "general/check_condition.h"
 #include "general/configuration.h"
+#include "arbitrary_precision_calculation/mpf_value.h"
 #include "arbitrary_precision_calculation/operations.h"
 #include "general/particle.h"
 #include "neighborhood/neighborhood.h"
@@ -59,9 +60,8 @@ void TestingUpdater::Update(Particle* p) {
 	std::vector<mpf_t*> helperVector = arbitraryprecisioncalculation::vectoroperations::Randomize(localDir);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(localDir);
 	localDir = helperVector;
-	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
-	std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
+	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	std::vector<mpf_t*> globalDir = configuration::g_bound_handling->GetDirectionVector(p->position, glAtPos.Get());
 	helperVector = arbitraryprecisioncalculation::vectoroperations::Randomize(globalDir);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globalDir);
 	globalDir = helperVector;
@@ -80,8 +80,7 @@ void TestingUpdater::Update(Particle* p) {
 			helperVector);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(oldVelocityPart);
 	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(helperVector);
-	p->SetVelocity(newVelocity);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(newVelocity);
+	p->SetVelocity(arbitraryprecisioncalculation::MpfVector::Adopt(newVelocity));
 	configuration::g_bound_handling->SetParticleUpdate(p);
 }
 
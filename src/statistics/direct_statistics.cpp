@@ -127,7 +127,7 @@ std::string NamedStatistic::GetName(){
 }
 
 std::vector<mpf_t*> GlobalBestPositionStatistic::Evaluate(){
-	return configuration::g_neighborhood->GetGlobalAttractorPosition();
+	return configuration::g_neighborhood->GetGlobalAttractorPosition().Release();
 }
 
 std::string GlobalBestPositionStatistic::GetName(){
@@ -135,10 +135,9 @@ std::string GlobalBestPositionStatistic::GetName(){
 }
 
 std::vector<mpf_t*> GlobalBestPositionDistTo1DOptimumStatistic::Evaluate(){
-	std::vector<mpf_t*> globBest = configuration::g_neighborhood->GetGlobalAttractorPosition();
+	arbitraryprecisioncalculation::MpfVector globBest = configuration::g_neighborhood->GetGlobalAttractorPosition();
 	DistTo1DOptimumOperation operation;
-	std::vector<mpf_t*> res = operation.Operate(globBest);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(globBest);
+	std::vector<mpf_t*> res = operation.Operate(globBest.Get());
 	return res;
 }
 
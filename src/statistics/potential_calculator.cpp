@@ -70,12 +70,10 @@ mpf_t* PotentialFunctionDifference::Evaluate(Particle* p, int dim){
 	position2[dim] = x;
 	mpf_t* f2 = (*(configuration::g_function)).Evaluate(position2);
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
-	mpf_t* dif = arbitraryprecisioncalculation::mpftoperations::Subtract(f1,f2);
-	mpf_t* res = arbitraryprecisioncalculation::mpftoperations::Abs(dif);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(f1);
+	arbitraryprecisioncalculation::mpftoperations::SubtractTo(&f1, f1, f2);
+	arbitraryprecisioncalculation::mpftoperations::AbsTo(&f1, f1);
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(f2);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(dif);
-	return res;
+	return f1;
 }
 
 std::string PotentialFunctionDifference::GetName(){
@@ -87,19 +85,15 @@ PotentialAbsVelocityPlusDistToGlobalAttractor::PotentialAbsVelocityPlusDistToGlo
 }
 
 mpf_t* PotentialAbsVelocityPlusDistToGlobalAttractor::Evaluate(Particle* p, int dim){
-	mpf_t* v1 = arbitraryprecisioncalculation::mpftoperations::Abs(p->velocity[dim]);
-	mpf_t* v2 = arbitraryprecisioncalculation::mpftoperations::Multiply(v1, scale_);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
-	mpf_t* res = v2;
-	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
-	v1 = arbitraryprecisioncalculation::mpftoperations::Subtract(p->position[dim], glAtPos[dim]);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
-	v2 = arbitraryprecisioncalculation::mpftoperations::Abs(v1);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
-	v1 = res;
-	res = arbitraryprecisioncalculation::mpftoperations::Add(v1, v2);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v2);
+	mpf_t* res = NULL;
+	arbitraryprecisioncalculation::mpftoperations::AbsTo(&res, p->velocity[dim]);
+	arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&res, res, scale_);
+	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	mpf_t* distance = NULL;
+	arbitraryprecisioncalculation::mpftoperations::SubtractTo(&distance, p->position[dim], glAtPos[dim]);
+	arbitraryprecisioncalculation::mpftoperations::AbsTo(&distance, distance);
+	arbitraryprecisioncalculation::mpftoperations::AddTo(&res, res, distance);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(distance);
 	return res;
 }
 
@@ -113,21 +107,16 @@ std::string PotentialAbsVelocityPlusDistToGlobalAttractor::GetName(){
 PotentialSqrtAbsVelocityPlusSqrtDistToGlobalAttractor::PotentialSqrtAbsVelocityPlusSqrtDistToGlobalAttractor(double scale) : scale_(scale){}
 
 mpf_t* PotentialSqrtAbsVelocityPlusSqrtDistToGlobalAttractor::Evaluate(Particle* p, int dim){
-	mpf_t* v1 = arbitraryprecisioncalculation::mpftoperations::Abs(p->velocity[dim]);
-	mpf_t* v2 = arbitraryprecisioncalculation::mpftoperations::Sqrt(v1);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
-	v1 = arbitraryprecisioncalculation::mpftoperations::Multiply(v2, scale_);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v2);
-	mpf_t* sqrtv = v1;
-	std::vector<mpf_t*> glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
-	v1 = arbitraryprecisioncalculation::mpftoperations::Subtract(p->position[dim], glAtPos[dim]);
-	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(glAtPos);
-	v2 = arbitraryprecisioncalculation::mpftoperations::Abs(v1);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v1);
-	mpf_t* sqrtdiff = arbitraryprecisioncalculation::mpftoperations::Sqrt(v2);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(v2);
-	mpf_t* res = arbitraryprecisioncalculation::mpftoperations::Add(sqrtv, sqrtdiff);
-	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sqrtv);
+	mpf_t* res = NULL;
+	arbitraryprecisioncalculation::mpftoperations::AbsTo(&res, p->velocity[dim]);
+	arbitraryprecisioncalculation::mpftoperations::SqrtTo(&res, res);
+	arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&res, res, scale_);
+	arbitraryprecisioncalculation::MpfVector glAtPos = configuration::g_neighborhood->GetGlobalAttractorPosition(p);
+	mpf_t* sqrtdiff = NULL;
+	arbitraryprecisioncalculation::mpftoperations::SubtractTo(&sqrtdiff, p->position[dim], glAtPos[dim]);
+	arbitraryprecisioncalculation::mpftoperations::AbsTo(&sqrtdiff, sqrtdiff);
+	arbitraryprecisioncalculation::mpftoperations::SqrtTo(&sqrtdiff, sqrtdiff);
+	arbitraryprecisioncalculation::mpftoperations::AddTo(&res, res, sqrtdiff);
 	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sqrtdiff);
 	return res;
 }
@@ -58,11 +58,9 @@ OperatedSpecificStatisticalEvaluation::OperatedSpecificStatisticalEvaluation(Ope
 std::vector<std::vector<mpf_t*> > OperatedSpecificStatisticalEvaluation::Evaluate(){
 	std::vector<std::vector<mpf_t*> > data = specific_evaluation_->Evaluate();
 	for(unsigned int i = 0; i < data.size(); i++){
-		for(unsigned int j = 0; j < data[i].size(); j++){
-			mpf_t* result = operation_->Operate(data[i][j]);
-			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(data[i][j]);
-			data[i][j] = result;
-		}
+		std::vector<mpf_t*> result = operation_->OperateElementWise(data[i]);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(data[i]);
+		data[i] = result;
 	}
 	return data;
 }
@@ -99,7 +97,7 @@ std::string CombineSpecificStatisticalEvaluation::GetName(){
 std::vector<std::vector<mpf_t*> > PositionEvaluation::Evaluate(){
 	std::vector<std::vector<mpf_t*> > data;
 	for(int i = 0; i < configuration::g_particles; i++){
-		data.push_back((*(configuration::g_statistics->swarm))[i]->GetPosition());
+		data.push_back((*(configuration::g_statistics->swarm))[i]->GetPosition().Release());
 	}
 	return data;
 }
@@ -111,7 +109,7 @@ std::string PositionEvaluation::GetName(){
 std::vector<std::vector<mpf_t*> > VelocityEvaluation::Evaluate(){
 	std::vector<std::vector<mpf_t*> > data;
 	for(int i = 0; i < configuration::g_particles; i++){
-		data.push_back((*(configuration::g_statistics->swarm))[i]->GetVelocity());
+		data.push_back((*(configuration::g_statistics->swarm))[i]->GetVelocity().Release());
 	}
 	return data;
 }
@@ -123,7 +121,7 @@ std::string VelocityEvaluation::GetName(){
 std::vector<std::vector<mpf_t*> > LocalAttractorEvaluation::Evaluate(){
 	std::vector<std::vector<mpf_t*> > data;
 	for(int i = 0; i < configuration::g_particles; i++){
-		data.push_back((*(configuration::g_statistics->swarm))[i]->GetLocalAttractorPosition());
+		data.push_back((*(configuration::g_statistics->swarm))[i]->GetLocalAttractorPosition().Release());
 	}
 	return data;
 }
@@ -136,7 +134,7 @@ std::vector<std::vector<mpf_t*> > GlobalAttractorEvaluation::Evaluate(){
 	std::vector<std::vector<mpf_t*> > data;
 	for(int i = 0; i < configuration::g_particles; i++){
 		Particle* p = (*(configuration::g_statistics->swarm))[i];
-		data.push_back(configuration::g_neighborhood->GetGlobalAttractorPosition(p));
+		data.push_back(configuration::g_neighborhood->GetGlobalAttractorPosition(p).Release());
 	}
 	return data;
 }
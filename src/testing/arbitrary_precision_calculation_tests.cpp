@@ -41,12 +41,18 @@
 #include <assert.h>
 #include <cfloat>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <gmp.h>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "arbitrary_precision_calculation/arbitraryprecisioncalculation.h"
+#include "arbitrary_precision_calculation/check_condition.h"
 
 namespace arbitraryprecisioncalculation {
 
@@ -1213,7 +1219,1703 @@ int test_baseFunctionality(){
 	return 0;
 }
 
+int test_mpftPool(){
+	std::cout << "begin mpf_t pool test\n";
+	mpf_set_default_prec(BASE_PRECISION);
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	std::vector<mpf_t*> values;
+	for(int i = 0; i < 100; i++){
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(i + 0.5));
+	}
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetMaximalNumberOfMpftValuesInUse() >= in_use + 100);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	int pooled = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesPooled();
+	{
+		int result_should_be_true = (pooled >= 100);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	// reused values need to behave like freshly initialized values
+	for(int i = 0; i < 100; i++){
+		mpf_t* value = arbitraryprecisioncalculation::mpftoperations::GetResultPointer();
+		int result_should_be_true = (mpf_cmp_ui(*value, 0) == 0 && mpf_get_prec(*value) == mpf_get_default_prec());
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		values[i] = value;
+	}
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesPooled() == pooled - 100);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	arbitraryprecisioncalculation::mpftoperations::TrimMpftPool();
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesPooled() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	// values which are larger than the values of the current precision are not kept after a decrease of the precision
+	{
+		unsigned int memDefaultPrecision = mpf_get_default_prec();
+		mpf_set_default_prec(memDefaultPrecision * 10);
+		mpf_t* large = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.5);
+		mpf_set_default_prec(memDefaultPrecision);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(large);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesPooled() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "mpf_t pool test succeeded.\n";
+	return 0;
+}
+
+int test_destinationPassing(){
+	std::cout << "begin destination passing test\n";
+	mpf_set_default_prec(BASE_PRECISION);
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	std::vector<mpf_t*> values = {
+		arbitraryprecisioncalculation::mpftoperations::ToMpft(-2.75),
+		arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0),
+		arbitraryprecisioncalculation::mpftoperations::ToMpft(3.125),
+		arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity(),
+		arbitraryprecisioncalculation::mpftoperations::GetMinusInfinity(),
+		arbitraryprecisioncalculation::mpftoperations::GetUndefined()
+	};
+	mpf_t* result = NULL;
+	for(unsigned int i = 0; i < values.size(); i++){
+		for(unsigned int j = 0; j < values.size(); j++){
+			mpf_t* a = values[i];
+			mpf_t* b = values[j];
+			std::vector<mpf_t*> expected = {
+				arbitraryprecisioncalculation::mpftoperations::Add(a, b),
+				arbitraryprecisioncalculation::mpftoperations::Subtract(a, b),
+				arbitraryprecisioncalculation::mpftoperations::Multiply(a, b),
+				arbitraryprecisioncalculation::mpftoperations::Divide(a, b)
+			};
+			for(unsigned int k = 0; k < expected.size(); k++){
+				switch(k){
+					case 0: arbitraryprecisioncalculation::mpftoperations::AddTo(&result, a, b); break;
+					case 1: arbitraryprecisioncalculation::mpftoperations::SubtractTo(&result, a, b); break;
+					case 2: arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&result, a, b); break;
+					default: arbitraryprecisioncalculation::mpftoperations::DivideTo(&result, a, b); break;
+				}
+				int result_should_be_true = (
+						arbitraryprecisioncalculation::mpftoperations::IsUndefined(expected[k]) ?
+						arbitraryprecisioncalculation::mpftoperations::IsUndefined(result) :
+						arbitraryprecisioncalculation::mpftoperations::Compare(expected[k], result) == 0);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(expected);
+		}
+	}
+	// the destination may be an operand
+	arbitraryprecisioncalculation::mpftoperations::SetTo(&result, 1.5);
+	arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&result, result, 4.0);
+	arbitraryprecisioncalculation::mpftoperations::AddTo(&result, result, result);
+	arbitraryprecisioncalculation::mpftoperations::NegateTo(&result, result);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(result, -12.0) == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::vector<mpf_t*> x = arbitraryprecisioncalculation::vectoroperations::GetVector({1.0, -2.0, 0.5});
+	std::vector<mpf_t*> y = arbitraryprecisioncalculation::vectoroperations::GetVector({4.0, 1.0, -1.0});
+	mpf_t* alpha = arbitraryprecisioncalculation::mpftoperations::ToMpft(2.0);
+	arbitraryprecisioncalculation::vectoroperations::AxpyInPlace(&y, alpha, x);
+	std::vector<mpf_t*> axpy_expected = arbitraryprecisioncalculation::vectoroperations::GetVector({6.0, -3.0, 0.0});
+	{
+		int result_should_be_true = arbitraryprecisioncalculation::vectoroperations::Equals(y, axpy_expected);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::vector<mpf_t*> destination;
+	arbitraryprecisioncalculation::vectoroperations::SubtractTo(&destination, y, x);
+	arbitraryprecisioncalculation::vectoroperations::AddTo(&destination, destination, x);
+	{
+		int result_should_be_true = arbitraryprecisioncalculation::vectoroperations::Equals(destination, y);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::vectoroperations::MultiplyTo(&destination, x, alpha);
+	arbitraryprecisioncalculation::vectoroperations::DivideTo(&destination, destination, x);
+	{
+		int result_should_be_true = (destination.size() == 3 && arbitraryprecisioncalculation::mpftoperations::Compare(destination[1], alpha) == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(x);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(y);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(axpy_expected);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(destination);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(alpha);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(result);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "destination passing test succeeded.\n";
+	return 0;
+}
+
+int test_mpfValueTypes(){
+	std::cout << "begin mpf value types test\n";
+	mpf_set_default_prec(BASE_PRECISION);
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	{
+		arbitraryprecisioncalculation::Mpf a(1.5);
+		arbitraryprecisioncalculation::Mpf b(2.0);
+		arbitraryprecisioncalculation::Mpf c = a * b + a;
+		mpf_t* raw_c = c.Get();
+		arbitraryprecisioncalculation::Mpf d = std::move(c);
+		{
+			int result_should_be_true = (c.IsEmpty() && d.Get() == raw_c && d == arbitraryprecisioncalculation::Mpf(4.5));
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		arbitraryprecisioncalculation::Mpf e = d;
+		e -= b;
+		e /= b;
+		{
+			int result_should_be_true = (e.Get() != d.Get() && e == arbitraryprecisioncalculation::Mpf(1.25) && e < d && -e < e);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		arbitraryprecisioncalculation::Mpf infinity = arbitraryprecisioncalculation::Mpf::Adopt(arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity());
+		arbitraryprecisioncalculation::Mpf undefined = infinity - infinity;
+		{
+			int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::IsUndefined(undefined.Get()));
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		mpf_t* raw_a = a.Release();
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(raw_a);
+
+		arbitraryprecisioncalculation::MpfVector x = arbitraryprecisioncalculation::MpfVector::Adopt(
+				arbitraryprecisioncalculation::vectoroperations::GetVector({1.0, -2.0, 0.5}));
+		arbitraryprecisioncalculation::MpfVector y = x * 2.0 + x;
+		y -= x;
+		y *= b;
+		arbitraryprecisioncalculation::MpfVector z = std::move(y);
+		arbitraryprecisioncalculation::MpfVector expected = arbitraryprecisioncalculation::MpfVector::Adopt(
+				arbitraryprecisioncalculation::vectoroperations::GetVector({4.0, -8.0, 2.0}));
+		{
+			int result_should_be_true = (y.size() == 0 && arbitraryprecisioncalculation::vectoroperations::Equals(z.Get(), expected.Get()));
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		std::vector<mpf_t*> raw = z.Release();
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(raw);
+	}
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "mpf value types test succeeded.\n";
+	return 0;
+}
+
+int test_fusedVectorKernels(){
+	std::cout << "begin fused vector kernels test\n";
+	mpf_set_default_prec(BASE_PRECISION);
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	std::vector<mpf_t*> a = arbitraryprecisioncalculation::vectoroperations::GetVector({1.0, -2.0, 0.5, 3.0});
+	std::vector<mpf_t*> b = arbitraryprecisioncalculation::vectoroperations::GetVector({0.25, 4.0, -1.5, 2.0});
+	std::vector<mpf_t*> c = arbitraryprecisioncalculation::vectoroperations::GetVector({-3.0, 0.125, 1.0, 7.0});
+	mpf_t* third = arbitraryprecisioncalculation::mpftoperations::Divide(a[0], a[3]);
+	mpf_t* alpha = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.75);
+	mpf_t* beta = arbitraryprecisioncalculation::mpftoperations::Negate(third);
+	mpf_t* gamma = arbitraryprecisioncalculation::mpftoperations::ToMpft(-2.0);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(b[0]);
+	b[0] = third;
+	{
+		// dot product and squared distance
+		mpf_t* dot = arbitraryprecisioncalculation::vectoroperations::Dot(a, b);
+		std::vector<mpf_t*> products = arbitraryprecisioncalculation::vectoroperations::Multiply(a, b);
+		mpf_t* dot_expected = arbitraryprecisioncalculation::vectoroperations::Add(products);
+		mpf_t* distance = arbitraryprecisioncalculation::vectoroperations::SquaredDistance(a, b);
+		std::vector<mpf_t*> difference = arbitraryprecisioncalculation::vectoroperations::Subtract(a, b);
+		mpf_t* distance_expected = arbitraryprecisioncalculation::vectoroperations::SquaredEuclideanLength(difference);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(dot, dot_expected) == 0
+				&& arbitraryprecisioncalculation::mpftoperations::Compare(distance, distance_expected) == 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(dot);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(dot_expected);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(distance);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(distance_expected);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(products);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(difference);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// axpby, scaled addition and linear combination
+		std::vector<mpf_t*> scaled_a = arbitraryprecisioncalculation::vectoroperations::Multiply(a, alpha);
+		std::vector<mpf_t*> scaled_b = arbitraryprecisioncalculation::vectoroperations::Multiply(b, beta);
+		std::vector<mpf_t*> scaled_c = arbitraryprecisioncalculation::vectoroperations::Multiply(c, gamma);
+		std::vector<mpf_t*> axpby_expected = arbitraryprecisioncalculation::vectoroperations::Add(scaled_a, scaled_b);
+		std::vector<mpf_t*> scale_add_expected = arbitraryprecisioncalculation::vectoroperations::Add(c, scaled_b);
+		std::vector<mpf_t*> combination_expected = arbitraryprecisioncalculation::vectoroperations::Add(axpby_expected, scaled_c);
+		std::vector<mpf_t*> axpby, scale_add;
+		arbitraryprecisioncalculation::vectoroperations::Axpby(&axpby, alpha, a, beta, b);
+		arbitraryprecisioncalculation::vectoroperations::ScaleAdd(&scale_add, c, beta, b);
+		std::vector<mpf_t*> combination = arbitraryprecisioncalculation::vectoroperations::Clone(a);
+		arbitraryprecisioncalculation::vectoroperations::LinearCombination3(&combination, alpha, combination, beta, b, gamma, c);
+		int result_should_be_true = (arbitraryprecisioncalculation::vectoroperations::Equals(axpby, axpby_expected)
+				&& arbitraryprecisioncalculation::vectoroperations::Equals(scale_add, scale_add_expected)
+				&& arbitraryprecisioncalculation::vectoroperations::Equals(combination, combination_expected));
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scaled_a);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scaled_b);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scaled_c);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(axpby_expected);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scale_add_expected);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(combination_expected);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(axpby);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(scale_add);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(combination);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(a);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(b);
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(c);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(alpha);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(beta);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(gamma);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "fused vector kernels test succeeded.\n";
+	return 0;
+}
+
+int test_precisionCheckAlgorithms(){
+	std::cout << "begin precision check algorithms test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	int memPrecisionSafetyMargin = arbitraryprecisioncalculation::Configuration::getPrecisionSafetyMargin();
+	arbitraryprecisioncalculation::RandomNumberGenerator* random = new arbitraryprecisioncalculation::FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 42);
+	std::vector<int> precisions = {BASE_PRECISION, 64, 1000};
+	std::vector<int> margins = {0, 1, 63, 64, 65, BASE_PRECISION / 2, 300};
+	int checks = 0, recommendations = 0;
+	// the regression algorithm compares both algorithms within the real additions and subtractions
+	arbitraryprecisioncalculation::configuration::CheckPrecisionMode memCheckPrecisionMode = arbitraryprecisioncalculation::Configuration::getCheckPrecisionMode();
+	arbitraryprecisioncalculation::configuration::CheckPrecisionAlgorithm memCheckPrecisionAlgorithm = arbitraryprecisioncalculation::Configuration::getCheckPrecisionAlgorithm();
+	double memCheckPrecisionProbability = arbitraryprecisioncalculation::Configuration::getCheckPrecisionProbability();
+	bool memIncreasePrecisionRecommended = arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended();
+	int disagreements = arbitraryprecisioncalculation::mpftoperations::GetNumberOfPrecisionCheckDisagreements();
+	int operation_recommendations = 0;
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionAlgorithm(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_REGRESSION);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(1.0);
+	for(unsigned int p = 0; p < precisions.size(); p++){
+		mpf_set_default_prec(precisions[p]);
+		for(unsigned int m = 0; m < margins.size(); m++){
+			arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(margins[m]);
+			for(int shift = 0; shift < precisions[p] + margins[m] + 200; shift += 3){
+				mpf_t* a = arbitraryprecisioncalculation::mpftoperations::GetRandomMpft(random);
+				mpf_t* r = arbitraryprecisioncalculation::mpftoperations::GetRandomMpft(random);
+				mpf_t* small = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(r, -shift);
+				std::vector<mpf_t*> b = {
+					arbitraryprecisioncalculation::mpftoperations::Clone(small),
+					arbitraryprecisioncalculation::mpftoperations::Negate(small),
+					arbitraryprecisioncalculation::mpftoperations::Subtract(small, a),
+					arbitraryprecisioncalculation::mpftoperations::Negate(a),
+					arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0)
+				};
+				for(unsigned int i = 0; i < b.size(); i++){
+					bool trial_addition = arbitraryprecisioncalculation::mpftoperations::CheckPrecisionOnAddRecommendsIncrease(a, b[i],
+							arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_TRIAL_ADDITION);
+					bool exponent = arbitraryprecisioncalculation::mpftoperations::CheckPrecisionOnAddRecommendsIncrease(a, b[i],
+							arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALGORITHM_EXPONENT);
+					++checks;
+					if(trial_addition) ++recommendations;
+					int result_should_be_true = (trial_addition == exponent);
+					assert(result_should_be_true);
+					if(!(result_should_be_true)) return 1;
+					// additions and subtractions with new, separate and replaced destinations
+					arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+					mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add(a, b[i]);
+					mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract(a, b[i]);
+					arbitraryprecisioncalculation::mpftoperations::AddTo(&difference, b[i], a);
+					arbitraryprecisioncalculation::mpftoperations::SubtractTo(&sum, sum, b[i]);
+					arbitraryprecisioncalculation::mpftoperations::AddTo(&sum, sum, b[i]);
+					if(arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended()) ++operation_recommendations;
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+				}
+				arbitraryprecisioncalculation::vectoroperations::ReleaseValues(b);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(r);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(small);
+			}
+		}
+	}
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(memCheckPrecisionProbability);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionAlgorithm(memCheckPrecisionAlgorithm);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(memCheckPrecisionMode);
+	arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+	if(memIncreasePrecisionRecommended) arbitraryprecisioncalculation::Configuration::RecommendIncreasePrecision();
+	{
+		// both decisions need to occur and the algorithms agree within the real operations
+		int result_should_be_true = (recommendations > 0 && recommendations < checks
+				&& operation_recommendations > 0 && operation_recommendations < checks
+				&& arbitraryprecisioncalculation::mpftoperations::GetNumberOfPrecisionCheckDisagreements() == disagreements);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	delete random;
+	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(memPrecisionSafetyMargin);
+	mpf_set_default_prec(BASE_PRECISION);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "precision check algorithms test succeeded.\n";
+	return 0;
+}
+
+int test_checkPrecisionSampler(){
+	std::cout << "begin check precision sampler test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	{
+		// the ratio of checked calculations matches the probability
+		arbitraryprecisioncalculation::CheckPrecisionSampler sampler(7, false);
+		int samples = 200000, checked = 0;
+		for(int i = 0; i < samples; i++){
+			if(sampler.ShouldCheck(0.25)) ++checked;
+		}
+		int result_should_be_true = (checked > 0.24 * samples && checked < 0.26 * samples);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// equal seeds yield equal decisions
+		arbitraryprecisioncalculation::CheckPrecisionSampler sampler1(11, false);
+		arbitraryprecisioncalculation::CheckPrecisionSampler sampler2(11, false);
+		for(int i = 0; i < 1000; i++){
+			int result_should_be_true = (sampler1.ShouldCheck(0.1) == sampler2.ShouldCheck(0.1));
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	{
+		// the adaptive sampler reduces its rate while no increase of the precision is recommended
+		arbitraryprecisioncalculation::CheckPrecisionSampler sampler(13, true);
+		for(int i = 0; i < 10 * arbitraryprecisioncalculation::CheckPrecisionSampler::ADAPTATION_WINDOW; i++){
+			sampler.ReportCheckResult(false);
+		}
+		int result_should_be_true = (sampler.GetEffectiveProbability(0.5) == std::ldexp(0.5, -arbitraryprecisioncalculation::CheckPrecisionSampler::MAXIMAL_RATE_REDUCTION));
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		sampler.ReportCheckResult(true);
+		result_should_be_true = (sampler.GetEffectiveProbability(0.5) == 0.5);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// probabilistic precision checks with a sampler do not consume random values of the standard random number generator
+		arbitraryprecisioncalculation::RandomNumberGenerator* memStandardRandomNumberGenerator = arbitraryprecisioncalculation::Configuration::getStandardRandomNumberGenerator();
+		arbitraryprecisioncalculation::configuration::CheckPrecisionMode memCheckPrecisionMode = arbitraryprecisioncalculation::Configuration::getCheckPrecisionMode();
+		double memCheckPrecisionProbability = arbitraryprecisioncalculation::Configuration::getCheckPrecisionProbability();
+		bool memIncreasePrecisionRecommended = arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::RandomNumberGenerator* random = new arbitraryprecisioncalculation::FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 5);
+		arbitraryprecisioncalculation::RandomNumberGenerator* reference = new arbitraryprecisioncalculation::FastM2P63LinearCongruenceRandomNumberGenerator(1571204578482947281ULL, 12345678901234567ULL, 5);
+		arbitraryprecisioncalculation::CheckPrecisionSampler* sampler = new arbitraryprecisioncalculation::CheckPrecisionSampler(17, false);
+		arbitraryprecisioncalculation::Configuration::setStandardRandomNumberGenerator(random);
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS);
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(0.5);
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionSampler(sampler);
+		mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		for(int i = 0; i < 100; i++){
+			mpf_t* next = arbitraryprecisioncalculation::mpftoperations::Add(sum, sum);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+			sum = next;
+		}
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+		int result_should_be_true = (random->RandomLongLong() == reference->RandomLongLong()
+				&& !arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended());
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionSampler(NULL);
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(memCheckPrecisionProbability);
+		arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(memCheckPrecisionMode);
+		arbitraryprecisioncalculation::Configuration::setStandardRandomNumberGenerator(memStandardRandomNumberGenerator);
+		if(memIncreasePrecisionRecommended) arbitraryprecisioncalculation::Configuration::RecommendIncreasePrecision();
+		delete sampler;
+		delete random;
+		delete reference;
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "check precision sampler test succeeded.\n";
+	return 0;
+}
+
+// Returns true if the relative difference of the values is less than 2^-bits.
+bool relativeDifferenceIsSmall(const mpf_t* a, const mpf_t* b, int bits){
+	mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract(a, b);
+	mpf_t* absolute_difference = arbitraryprecisioncalculation::mpftoperations::Abs(difference);
+	mpf_t* absolute_b = arbitraryprecisioncalculation::mpftoperations::Abs(b);
+	mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(absolute_b, -bits);
+	bool result = (arbitraryprecisioncalculation::mpftoperations::Compare(absolute_difference, bound) < 0);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(absolute_difference);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(absolute_b);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+	return result;
+}
+
+int test_fastElementaryFunctions(){
+	std::cout << "begin fast elementary functions test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm memElementaryFunctionAlgorithm = arbitraryprecisioncalculation::Configuration::getElementaryFunctionAlgorithm();
+	// 3000 bits use the logarithm based on the arithmetic-geometric mean
+	std::vector<int> precisions = {64, BASE_PRECISION, 1000, 3000};
+	std::vector<double> exp_arguments = {-7.25, -1.0, -0.001, 1e-20, 0.3, 1.0, 2.5, 40.0};
+	std::vector<double> log_arguments = {1e-10, 0.25, 0.9999, 1.0, 1.0001, 2.0, 3.5, 1e10};
+	for(unsigned int p = 0; p < precisions.size(); p++){
+		mpf_set_default_prec(precisions[p]);
+		for(unsigned int i = 0; i < exp_arguments.size() + log_arguments.size(); i++){
+			bool exp_test = (i < exp_arguments.size());
+			mpf_t* argument = arbitraryprecisioncalculation::mpftoperations::ToMpft(exp_test ? exp_arguments[i] : log_arguments[i - exp_arguments.size()]);
+			arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE);
+			mpf_t* reference = (exp_test ? arbitraryprecisioncalculation::mpftoperations::Exp(argument) : arbitraryprecisioncalculation::mpftoperations::LogE(argument));
+			arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST);
+			mpf_t* fast = (exp_test ? arbitraryprecisioncalculation::mpftoperations::Exp(argument) : arbitraryprecisioncalculation::mpftoperations::LogE(argument));
+			// the logarithm of the exponential function yields the argument again
+			mpf_t* inverse = (exp_test ? arbitraryprecisioncalculation::mpftoperations::LogE(fast) : arbitraryprecisioncalculation::mpftoperations::Exp(fast));
+			int result_should_be_true = ((arbitraryprecisioncalculation::mpftoperations::Compare(reference, 0.0) == 0 && arbitraryprecisioncalculation::mpftoperations::Compare(fast, 0.0) == 0)
+					|| relativeDifferenceIsSmall(fast, reference, precisions[p] - 16));
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+			result_should_be_true = relativeDifferenceIsSmall(inverse, argument, precisions[p] - 16);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(argument);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fast);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(inverse);
+		}
+	}
+	arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(memElementaryFunctionAlgorithm);
+	mpf_set_default_prec(BASE_PRECISION);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "fast elementary functions test succeeded.\n";
+	return 0;
+}
+
+// Returns true if the absolute difference of the values is less than 2^-bits.
+bool absoluteDifferenceIsSmall(const mpf_t* a, const mpf_t* b, int bits){
+	mpf_t* difference = arbitraryprecisioncalculation::mpftoperations::Subtract(a, b);
+	mpf_t* absolute_difference = arbitraryprecisioncalculation::mpftoperations::Abs(difference);
+	mpf_t* n1 = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(n1, -bits);
+	bool result = (arbitraryprecisioncalculation::mpftoperations::Compare(absolute_difference, bound) < 0);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(difference);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(absolute_difference);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(n1);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+	return result;
+}
+
+int test_sinCos(){
+	std::cout << "begin sin cos test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm memElementaryFunctionAlgorithm = arbitraryprecisioncalculation::Configuration::getElementaryFunctionAlgorithm();
+	std::vector<int> precisions = {64, BASE_PRECISION, 1000};
+	std::vector<double> arguments = {0.0, 1e-25, -0.3, 0.78, 1.0, -1.5707963267948966, 2.5, 3.14159, -10.0, 123.456, 1e6};
+	for(unsigned int p = 0; p < precisions.size(); p++){
+		mpf_set_default_prec(precisions[p]);
+		for(unsigned int i = 0; i < arguments.size(); i++){
+			mpf_t* argument = arbitraryprecisioncalculation::mpftoperations::ToMpft(arguments[i]);
+			arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE);
+			mpf_t* reference_sin = arbitraryprecisioncalculation::mpftoperations::Sin(argument);
+			mpf_t* reference_cos = arbitraryprecisioncalculation::mpftoperations::Cos(argument);
+			arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST);
+			mpf_t* fast_sin = NULL;
+			mpf_t* fast_cos = NULL;
+			arbitraryprecisioncalculation::mpftoperations::SinCos(argument, &fast_sin, &fast_cos);
+			mpf_t* single_sin = arbitraryprecisioncalculation::mpftoperations::Sin(argument);
+			mpf_t* single_cos = arbitraryprecisioncalculation::mpftoperations::Cos(argument);
+			// the reference implementation loses precision close to multiples of Pi, hence absolute differences are compared
+			int result_should_be_true = (absoluteDifferenceIsSmall(fast_sin, reference_sin, precisions[p] - 24)
+					&& absoluteDifferenceIsSmall(fast_cos, reference_cos, precisions[p] - 24)
+					&& arbitraryprecisioncalculation::mpftoperations::Compare(fast_sin, single_sin) == 0
+					&& arbitraryprecisioncalculation::mpftoperations::Compare(fast_cos, single_cos) == 0);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+			// sin^2 + cos^2 = 1
+			mpf_t* sin_square = arbitraryprecisioncalculation::mpftoperations::Multiply(fast_sin, fast_sin);
+			mpf_t* cos_square = arbitraryprecisioncalculation::mpftoperations::Multiply(fast_cos, fast_cos);
+			mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add(sin_square, cos_square);
+			mpf_t* n1 = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+			result_should_be_true = absoluteDifferenceIsSmall(sum, n1, precisions[p] - 8);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(argument);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference_sin);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference_cos);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fast_sin);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fast_cos);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(single_sin);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(single_cos);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sin_square);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cos_square);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(n1);
+		}
+	}
+	arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(memElementaryFunctionAlgorithm);
+	mpf_set_default_prec(BASE_PRECISION);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "sin cos test succeeded.\n";
+	return 0;
+}
+
+int test_fastInverseTrigonometricFunctions(){
+	std::cout << "begin fast inverse trigonometric functions test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm memElementaryFunctionAlgorithm = arbitraryprecisioncalculation::Configuration::getElementaryFunctionAlgorithm();
+	std::vector<int> precisions = {64, BASE_PRECISION, 1000};
+	std::vector<double> arguments = {-1.0, -0.999, -0.5, -1e-20, 0.0, 0.015625, 0.1, 0.49, 0.75, 0.99999, 1.0, 1.5, -7.0, 1e8};
+	for(unsigned int p = 0; p < precisions.size(); p++){
+		mpf_set_default_prec(precisions[p]);
+		for(unsigned int i = 0; i < arguments.size(); i++){
+			mpf_t* argument = arbitraryprecisioncalculation::mpftoperations::ToMpft(arguments[i]);
+			bool in_domain = (arguments[i] >= -1.0 && arguments[i] <= 1.0);
+			for(int function = 0; function < 3; function++){
+				if(function > 0 && !in_domain) continue;
+				arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE);
+				mpf_t* reference = (function == 0 ? arbitraryprecisioncalculation::mpftoperations::Arctan(argument)
+						: (function == 1 ? arbitraryprecisioncalculation::mpftoperations::Arcsin(argument) : arbitraryprecisioncalculation::mpftoperations::Arccos(argument)));
+				arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST);
+				mpf_t* fast = (function == 0 ? arbitraryprecisioncalculation::mpftoperations::Arctan(argument)
+						: (function == 1 ? arbitraryprecisioncalculation::mpftoperations::Arcsin(argument) : arbitraryprecisioncalculation::mpftoperations::Arccos(argument)));
+				// the reference implementations lose precision close to the borders of the domain, hence absolute differences are compared
+				int result_should_be_true = absoluteDifferenceIsSmall(fast, reference, precisions[p] - 24);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fast);
+			}
+			if(!in_domain){
+				mpf_t* fast = arbitraryprecisioncalculation::mpftoperations::Arccos(argument);
+				int result_should_be_true = arbitraryprecisioncalculation::mpftoperations::IsUndefined(fast);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(argument);
+		}
+	}
+	arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(memElementaryFunctionAlgorithm);
+	mpf_set_default_prec(BASE_PRECISION);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "fast inverse trigonometric functions test succeeded.\n";
+	return 0;
+}
+
+int test_constants(){
+	std::cout << "begin constants test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::configuration::ConstantAlgorithm memConstantAlgorithm = arbitraryprecisioncalculation::Configuration::getConstantAlgorithm();
+	std::vector<int> precisions = {3000, 64, BASE_PRECISION, 1000};
+	for(unsigned int p = 0; p < precisions.size(); p++){
+		mpf_set_default_prec(precisions[p]);
+		arbitraryprecisioncalculation::Configuration::setConstantAlgorithm(arbitraryprecisioncalculation::configuration::CONSTANT_ALGORITHM_REFERENCE);
+		mpf_t* reference_pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+		mpf_t* reference_e = arbitraryprecisioncalculation::mpftoperations::GetE();
+		arbitraryprecisioncalculation::Configuration::setConstantAlgorithm(arbitraryprecisioncalculation::configuration::CONSTANT_ALGORITHM_ENGINE);
+		mpf_t* engine_pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+		mpf_t* engine_e = arbitraryprecisioncalculation::mpftoperations::GetE();
+		mpf_t* engine_ln2 = arbitraryprecisioncalculation::mpftoperations::GetResultPointer();
+		arbitraryprecisioncalculation::constants::Ln2(*engine_ln2);
+		mpf_t* engine_sqrt2 = arbitraryprecisioncalculation::mpftoperations::GetResultPointer();
+		arbitraryprecisioncalculation::constants::Sqrt2(*engine_sqrt2);
+		mpf_t* n2 = arbitraryprecisioncalculation::mpftoperations::ToMpft(2.0);
+		mpf_t* reference_ln2 = arbitraryprecisioncalculation::mpftoperations::LogE(n2);
+		mpf_t* reference_sqrt2 = arbitraryprecisioncalculation::mpftoperations::Sqrt(n2);
+		int result_should_be_true = (relativeDifferenceIsSmall(engine_pi, reference_pi, precisions[p] - 16)
+				&& relativeDifferenceIsSmall(engine_e, reference_e, precisions[p] - 16)
+				&& relativeDifferenceIsSmall(engine_ln2, reference_ln2, precisions[p] - 16)
+				&& relativeDifferenceIsSmall(engine_sqrt2, reference_sqrt2, precisions[p] - 16));
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		// lower precisions are served from the most precise value
+		result_should_be_true = (arbitraryprecisioncalculation::constants::GetCachedPiPrecision() >= 3000);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference_pi);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference_e);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(engine_pi);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(engine_e);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(engine_ln2);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(engine_sqrt2);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(n2);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference_ln2);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference_sqrt2);
+	}
+	// the cache file can be read again and invalid cache files are rejected
+	std::string cache_file_name = "constants_cache_test.tmp";
+	mp_bitcnt_t cached_pi_precision = arbitraryprecisioncalculation::constants::GetCachedPiPrecision();
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::constants::StoreCacheFile(cache_file_name)
+				&& arbitraryprecisioncalculation::constants::LoadCacheFile(cache_file_name)
+				&& arbitraryprecisioncalculation::constants::GetCachedPiPrecision() == cached_pi_precision);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		std::ofstream invalid_file(cache_file_name.c_str());
+		invalid_file << "constants " << GMP_NUMB_BITS << "\npi 100000 1 -2 1 2\n";
+		invalid_file.close();
+		int result_should_be_true = (!arbitraryprecisioncalculation::constants::LoadCacheFile(cache_file_name)
+				&& arbitraryprecisioncalculation::constants::GetCachedPiPrecision() == cached_pi_precision);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::constants::LoadCacheFile("");
+	std::remove(cache_file_name.c_str());
+	arbitraryprecisioncalculation::Configuration::setConstantAlgorithm(memConstantAlgorithm);
+	mpf_set_default_prec(BASE_PRECISION);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "constants test succeeded.\n";
+	return 0;
+}
+
+int test_fastPow(){
+	std::cout << "begin fast pow test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm memElementaryFunctionAlgorithm = arbitraryprecisioncalculation::Configuration::getElementaryFunctionAlgorithm();
+	std::vector<int> precisions = {64, BASE_PRECISION, 1000};
+	std::vector<double> bases = {0.001, 0.3, 0.9, 1.7, 3.0, 123.0, -2.5};
+	// integer, dyadic rational and general exponents
+	std::vector<double> exponents = {3.0, -2.0, 17.0, 0.5, 0.375, 7.5, -0.25, 0.1, 2.2, -0.7};
+	for(unsigned int p = 0; p < precisions.size(); p++){
+		mpf_set_default_prec(precisions[p]);
+		for(unsigned int i = 0; i < bases.size(); i++){
+			mpf_t* base = arbitraryprecisioncalculation::mpftoperations::ToMpft(bases[i]);
+			// integer powers are the same as repeated multiplications
+			mpf_t* product = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+			for(int exponent = 0; exponent < 12; exponent++){
+				mpf_t* power = arbitraryprecisioncalculation::mpftoperations::Pow(base, exponent);
+				int result_should_be_true = relativeDifferenceIsSmall(power, product, precisions[p] - 8);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(power);
+				mpf_t* tmp = arbitraryprecisioncalculation::mpftoperations::Multiply(product, base);
+				std::swap(tmp, product);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tmp);
+			}
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(product);
+			for(unsigned int j = 0; j < exponents.size(); j++){
+				mpf_t* exponent = arbitraryprecisioncalculation::mpftoperations::ToMpft(exponents[j]);
+				arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST);
+				mpf_t* fast = arbitraryprecisioncalculation::mpftoperations::Pow(base, exponent);
+				int result_should_be_true = 0;
+				if(bases[i] < 0 && exponents[j] != std::floor(exponents[j])){
+					// negative bases are only defined for integer exponents
+					result_should_be_true = arbitraryprecisioncalculation::mpftoperations::IsUndefined(fast);
+				} else {
+					arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE);
+					mpf_t* reference = arbitraryprecisioncalculation::mpftoperations::Pow(base, exponent);
+					result_should_be_true = relativeDifferenceIsSmall(fast, reference, precisions[p] - 16);
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(reference);
+				}
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fast);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exponent);
+			}
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(base);
+		}
+	}
+	arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(memElementaryFunctionAlgorithm);
+	mpf_set_default_prec(BASE_PRECISION);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "fast pow test succeeded.\n";
+	return 0;
+}
+
+int test_vectorElementaryFunctions(){
+	std::cout << "begin vector elementary functions test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm memElementaryFunctionAlgorithm = arbitraryprecisioncalculation::Configuration::getElementaryFunctionAlgorithm();
+	std::vector<arbitraryprecisioncalculation::configuration::ElementaryFunctionAlgorithm> algorithms = {
+			arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE,
+			arbitraryprecisioncalculation::configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST};
+	std::vector<mpf_t*> (*vector_functions[])(const std::vector<mpf_t*> &) = {
+			arbitraryprecisioncalculation::vectoroperations::Sin,
+			arbitraryprecisioncalculation::vectoroperations::Cos,
+			arbitraryprecisioncalculation::vectoroperations::Exp,
+			arbitraryprecisioncalculation::vectoroperations::LogE,
+			arbitraryprecisioncalculation::vectoroperations::Sqrt};
+	mpf_t* (*single_functions[])(mpf_t*) = {
+			arbitraryprecisioncalculation::mpftoperations::Sin,
+			arbitraryprecisioncalculation::mpftoperations::Cos,
+			arbitraryprecisioncalculation::mpftoperations::Exp,
+			arbitraryprecisioncalculation::mpftoperations::LogE,
+			arbitraryprecisioncalculation::mpftoperations::Sqrt};
+	std::vector<mpf_t*> values = arbitraryprecisioncalculation::vectoroperations::GetVector({-3.5, -0.25, 0.0, 1e-12, 0.7, 2.0, 31.4159});
+	values.push_back(arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity());
+	values.push_back(arbitraryprecisioncalculation::mpftoperations::GetUndefined());
+	for(unsigned int a = 0; a < algorithms.size(); a++){
+		arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(algorithms[a]);
+		for(unsigned int f = 0; f < sizeof(single_functions) / sizeof(single_functions[0]); f++){
+			std::vector<mpf_t*> results = vector_functions[f](values);
+			int result_should_be_true = (results.size() == values.size());
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+			// the vector functions yield the same results as the functions for single values
+			for(unsigned int i = 0; i < values.size(); i++){
+				mpf_t* single = single_functions[f](values[i]);
+				bool special = (arbitraryprecisioncalculation::mpftoperations::IsUndefined(single) || arbitraryprecisioncalculation::mpftoperations::IsInfinite(single));
+				result_should_be_true = (special ? results[i] == single : (results[i] != single && mpf_cmp(*results[i], *single) == 0));
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(single);
+			}
+			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(results);
+		}
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	arbitraryprecisioncalculation::Configuration::setElementaryFunctionAlgorithm(memElementaryFunctionAlgorithm);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "vector elementary functions test succeeded.\n";
+	return 0;
+}
+
+// Computes a chain of operations which starts with exact values.
+std::vector<mpf_t*> computeBallArithmeticChain(){
+	std::vector<mpf_t*> res;
+	mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	mpf_t* three = arbitraryprecisioncalculation::mpftoperations::ToMpft(3.0);
+	mpf_t* exponent = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.7);
+	mpf_t* a = arbitraryprecisioncalculation::mpftoperations::Divide(one, three);
+	res.push_back(a);
+	mpf_t* b = arbitraryprecisioncalculation::mpftoperations::Sqrt(a);
+	res.push_back(b);
+	mpf_t* c = arbitraryprecisioncalculation::mpftoperations::Exp(b);
+	res.push_back(c);
+	mpf_t* tmp = arbitraryprecisioncalculation::mpftoperations::Add(c, a);
+	mpf_t* d = arbitraryprecisioncalculation::mpftoperations::LogE(tmp);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tmp);
+	res.push_back(d);
+	mpf_t* sin_d = arbitraryprecisioncalculation::mpftoperations::Sin(d);
+	mpf_t* cube = arbitraryprecisioncalculation::mpftoperations::Pow(a, 3);
+	mpf_t* e = arbitraryprecisioncalculation::mpftoperations::Multiply(sin_d, cube);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sin_d);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(cube);
+	res.push_back(e);
+	mpf_t* arctan_e = arbitraryprecisioncalculation::mpftoperations::Arctan(e);
+	mpf_t* power = arbitraryprecisioncalculation::mpftoperations::Pow(b, exponent);
+	mpf_t* f = arbitraryprecisioncalculation::mpftoperations::Divide(arctan_e, power);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(arctan_e);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(power);
+	res.push_back(f);
+	res.push_back(arbitraryprecisioncalculation::mpftoperations::Arcsin(a));
+	res.push_back(arbitraryprecisioncalculation::mpftoperations::Tan(d));
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(three);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exponent);
+	return res;
+}
+
+int test_ballArithmetic(){
+	std::cout << "begin ball arithmetic test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	unsigned int memDefaultPrecision = mpf_get_default_prec();
+	arbitraryprecisioncalculation::configuration::CheckPrecisionMode memCheckPrecisionMode = arbitraryprecisioncalculation::Configuration::getCheckPrecisionMode();
+	mpf_set_default_prec(128);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_BALL);
+	std::vector<mpf_t*> chain = computeBallArithmeticChain();
+	{
+		mpf_t* exact = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.5);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetBallRadiusExponent(exact) == arbitraryprecisioncalculation::mpftoperations::BALL_RADIUS_EXACT);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exact);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	// the values calculated with much higher precision lie inside of the balls
+	mpf_set_default_prec(1024);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_NEVER);
+	std::vector<mpf_t*> reference = computeBallArithmeticChain();
+	for(unsigned int i = 0; i < chain.size(); i++){
+		long radius = arbitraryprecisioncalculation::mpftoperations::GetBallRadiusExponent(chain[i]);
+		int result_should_be_true = (radius > -140 && radius < -100);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		mpf_t* diff = arbitraryprecisioncalculation::mpftoperations::Subtract(reference[i], chain[i]);
+		mpf_t* distance = arbitraryprecisioncalculation::mpftoperations::Abs(diff);
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* bound = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(one, (int)radius);
+		result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(distance, bound) <= 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(diff);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(distance);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(bound);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(reference);
+	mpf_set_default_prec(128);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_BALL);
+	{
+		// a value which differs from 1/3 by less than the radius of 1/3 can not be distinguished from 1/3
+		mpf_t* tiny = arbitraryprecisioncalculation::mpftoperations::ToMpft(ldexp(1.0, -140));
+		mpf_t* close = arbitraryprecisioncalculation::mpftoperations::Add(chain[0], tiny);
+		mpf_t* half = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.5);
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		arbitraryprecisioncalculation::mpftoperations::ResetUndecidableComparisons();
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(chain[0], half, "decidable") < 0
+				&& arbitraryprecisioncalculation::mpftoperations::GetUndecidableComparisons().empty()
+				&& !arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended());
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(chain[0], close, "undecidable")
+				== arbitraryprecisioncalculation::mpftoperations::Compare(chain[0], close)
+				&& arbitraryprecisioncalculation::mpftoperations::GetUndecidableComparisons().size() == 1
+				&& arbitraryprecisioncalculation::mpftoperations::GetUndecidableComparisons().at("undecidable") == 1
+				&& arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended());
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		// exact values are always decidable
+		arbitraryprecisioncalculation::Configuration::ResetIncreasePrecisionRecommended();
+		std::vector<mpf_t*> values = {chain[0], close};
+		arbitraryprecisioncalculation::vectoroperations::MarkExact(values);
+		arbitraryprecisioncalculation::mpftoperations::Compare(chain[0], close, "undecidable");
+		result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetBallRadiusExponent(close) == arbitraryprecisioncalculation::mpftoperations::BALL_RADIUS_EXACT
+				&& arbitraryprecisioncalculation::mpftoperations::GetUndecidableComparisons().at("undecidable") == 1
+				&& !arbitraryprecisioncalculation::Configuration::isIncreasePrecisionRecommended());
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tiny);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(close);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(half);
+		arbitraryprecisioncalculation::mpftoperations::ResetUndecidableComparisons();
+	}
+	arbitraryprecisioncalculation::vectoroperations::ReleaseValues(chain);
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(memCheckPrecisionMode);
+	mpf_set_default_prec(memDefaultPrecision);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "ball arithmetic test succeeded.\n";
+	return 0;
+}
+
+// Calculates values with the current context, which depend on the pool, the cached constants and the standard random number generator.
+std::vector<mpf_t*> computeContextChain(){
+	std::vector<mpf_t*> res;
+	mpf_t* seven = arbitraryprecisioncalculation::mpftoperations::ToMpft(7.0);
+	for(int i = 1; i <= 20; i++){
+		mpf_t* numerator = arbitraryprecisioncalculation::mpftoperations::ToMpft(i);
+		mpf_t* x = arbitraryprecisioncalculation::mpftoperations::Divide(numerator, seven);
+		mpf_t* sin_x = arbitraryprecisioncalculation::mpftoperations::Sin(x);
+		mpf_t* exp_sin_x = arbitraryprecisioncalculation::mpftoperations::Exp(sin_x);
+		mpf_t* log_x = arbitraryprecisioncalculation::mpftoperations::LogE(x);
+		res.push_back(arbitraryprecisioncalculation::mpftoperations::Add(exp_sin_x, log_x));
+		res.push_back(arbitraryprecisioncalculation::mpftoperations::GetRandomMpft());
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(numerator);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(x);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sin_x);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(exp_sin_x);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(log_x);
+	}
+	res.push_back(arbitraryprecisioncalculation::mpftoperations::GetPi());
+	res.push_back(arbitraryprecisioncalculation::mpftoperations::GetE());
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(seven);
+	// the precision of this context is increased, other contexts are not affected
+	arbitraryprecisioncalculation::mpftoperations::IncreasePrecision();
+	return res;
+}
+
+void computeContextChainInContext(arbitraryprecisioncalculation::Context* context, std::vector<mpf_t*>* res){
+	arbitraryprecisioncalculation::Context::SetCurrent(context);
+	*res = computeContextChain();
+	arbitraryprecisioncalculation::Context::SetCurrent(NULL);
+}
+
+int test_context(){
+	std::cout << "begin context test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	unsigned int memDefaultPrecision = mpf_get_default_prec();
+	const int NUMBER_OF_THREADS = 4;
+	std::vector<arbitraryprecisioncalculation::Context*> contexts;
+	std::vector<std::vector<mpf_t*> > results(NUMBER_OF_THREADS + 1);
+	for(int i = 0; i <= NUMBER_OF_THREADS; i++) contexts.push_back(new arbitraryprecisioncalculation::Context(300));
+	// the last context is used by this thread as reference
+	computeContextChainInContext(contexts[NUMBER_OF_THREADS], &results[NUMBER_OF_THREADS]);
+	std::vector<std::thread> threads;
+	for(int i = 0; i < NUMBER_OF_THREADS; i++) threads.push_back(std::thread(computeContextChainInContext, contexts[i], &results[i]));
+	for(int i = 0; i < NUMBER_OF_THREADS; i++) threads[i].join();
+	for(int i = 0; i <= NUMBER_OF_THREADS; i++){
+		arbitraryprecisioncalculation::Context::SetCurrent(contexts[i]);
+		int result_should_be_true = (contexts[i]->GetPrecision() == 310
+				&& results[i].size() == results[NUMBER_OF_THREADS].size()
+				&& arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse()
+					== (int)results[i].size() + arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesCached());
+		for(unsigned int j = 0; result_should_be_true && j < results[i].size(); j++){
+			result_should_be_true = (mpf_get_prec(*results[i][j]) >= 300
+					&& mpf_cmp(*results[i][j], *results[NUMBER_OF_THREADS][j]) == 0);
+		}
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(results[i]);
+		arbitraryprecisioncalculation::Context::SetCurrent(NULL);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	for(int i = 0; i <= NUMBER_OF_THREADS; i++) delete contexts[i];
+	{
+		int result_should_be_true = (mpf_get_default_prec() == memDefaultPrecision
+				&& arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "context test succeeded.\n";
+	return 0;
+}
+
+void changeDefaultContextPrecision(int* result){
+	// the default context of this thread must not change the default precision of gmp
+	arbitraryprecisioncalculation::Context* context = arbitraryprecisioncalculation::Context::GetCurrent();
+	context->SetPrecision(500);
+	// the constants are cached per context
+	mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetResultPointer();
+	arbitraryprecisioncalculation::constants::Pi(*pi);
+	*result = (context->GetPrecision() == 500
+			&& mpf_get_prec(*pi) >= 500
+			&& arbitraryprecisioncalculation::constants::GetCachedPiPrecision() >= 500);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi);
+}
+
+int test_contextDefaultPrecision(){
+	std::cout << "begin context default precision test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	unsigned int memDefaultPrecision = mpf_get_default_prec();
+	mp_bitcnt_t memCachedPiPrecision = arbitraryprecisioncalculation::constants::GetCachedPiPrecision();
+	int worker_result = 0;
+	std::thread worker(changeDefaultContextPrecision, &worker_result);
+	worker.join();
+	{
+		int result_should_be_true = (worker_result
+				&& mpf_get_default_prec() == memDefaultPrecision
+				&& arbitraryprecisioncalculation::Context::GetCurrent()->GetPrecision() == memDefaultPrecision
+				&& arbitraryprecisioncalculation::constants::GetCachedPiPrecision() == memCachedPiPrecision
+				&& arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "context default precision test succeeded.\n";
+	return 0;
+}
+
+int test_contextSampledPrecisionChecks(){
+	std::cout << "begin context sampled precision checks test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	double memCheckPrecisionProbability = arbitraryprecisioncalculation::Configuration::getCheckPrecisionProbability();
+	// the decision whether an addition is checked is drawn from the standard random number generator of each context
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(0.5);
+	const int NUMBER_OF_THREADS = 4;
+	for(int repetition = 0; repetition < 5; repetition++){
+		std::vector<arbitraryprecisioncalculation::Context*> contexts;
+		std::vector<std::vector<mpf_t*> > results(NUMBER_OF_THREADS + 1);
+		for(int i = 0; i <= NUMBER_OF_THREADS; i++) contexts.push_back(new arbitraryprecisioncalculation::Context(300));
+		computeContextChainInContext(contexts[NUMBER_OF_THREADS], &results[NUMBER_OF_THREADS]);
+		std::vector<std::thread> threads;
+		for(int i = 0; i < NUMBER_OF_THREADS; i++) threads.push_back(std::thread(computeContextChainInContext, contexts[i], &results[i]));
+		for(int i = 0; i < NUMBER_OF_THREADS; i++) threads[i].join();
+		int result_should_be_true = (arbitraryprecisioncalculation::Configuration::getCheckPrecisionProbability() == 0.5);
+		for(int i = 0; i <= NUMBER_OF_THREADS; i++){
+			arbitraryprecisioncalculation::Context::SetCurrent(contexts[i]);
+			result_should_be_true = result_should_be_true && (results[i].size() == results[NUMBER_OF_THREADS].size());
+			for(unsigned int j = 0; result_should_be_true && j < results[i].size(); j++){
+				result_should_be_true = (mpf_cmp(*results[i][j], *results[NUMBER_OF_THREADS][j]) == 0);
+			}
+			arbitraryprecisioncalculation::Context::SetCurrent(NULL);
+		}
+		for(int i = 0; i <= NUMBER_OF_THREADS; i++){
+			arbitraryprecisioncalculation::Context::SetCurrent(contexts[i]);
+			arbitraryprecisioncalculation::vectoroperations::ReleaseValues(results[i]);
+			arbitraryprecisioncalculation::Context::SetCurrent(NULL);
+			delete contexts[i];
+		}
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionProbability(memCheckPrecisionProbability);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "context sampled precision checks test succeeded.\n";
+	return 0;
+}
+
+int test_valuePrecision(){
+	std::cout << "begin value precision test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	unsigned int memDefaultPrecision = mpf_get_default_prec();
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::IsEquivalentPrecision(300, 310)
+				&& arbitraryprecisioncalculation::mpftoperations::IsEquivalentPrecision(300, 320)
+				&& !arbitraryprecisioncalculation::mpftoperations::IsEquivalentPrecision(300, 321)
+				&& arbitraryprecisioncalculation::mpftoperations::GetPrecision(arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity()) == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	mpf_set_default_prec(300);
+	mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+	mpf_t* three = arbitraryprecisioncalculation::mpftoperations::ToMpft(3.0);
+	mpf_t* third = arbitraryprecisioncalculation::mpftoperations::Divide(one, three);
+	mpf_t* pi = arbitraryprecisioncalculation::mpftoperations::GetPi();
+	mpf_set_default_prec(310);
+	{
+		// the cached value of pi is reused for an equivalent precision
+		mpf_t* pi_equivalent = arbitraryprecisioncalculation::mpftoperations::GetPi();
+		int result_should_be_true = (mpf_cmp(*pi, *pi_equivalent) == 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi_equivalent);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	// results keep the precision of their operands in a context with lower precision
+	mpf_set_default_prec(64);
+	{
+		mpf_t* low_third = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0 / 3.0);
+		mpf_t* clone = arbitraryprecisioncalculation::mpftoperations::Clone(third);
+		mpf_t* sum = arbitraryprecisioncalculation::mpftoperations::Add(third, low_third);
+		mpf_t* product = NULL;
+		arbitraryprecisioncalculation::mpftoperations::MultiplyTo(&product, third, one);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetPrecision(third) >= 300
+				&& arbitraryprecisioncalculation::mpftoperations::GetPrecision(low_third) < 300
+				&& arbitraryprecisioncalculation::mpftoperations::GetPrecision(clone) >= 300
+				&& arbitraryprecisioncalculation::mpftoperations::GetPrecision(sum) >= 300
+				&& mpf_cmp(*clone, *third) == 0
+				&& mpf_cmp(*product, *third) == 0
+				&& mpf_cmp(*sum, *third) > 0);
+		// lazy upgrade of a value with low precision
+		mpf_set_default_prec(300);
+		mpf_t* low_third_before = arbitraryprecisioncalculation::mpftoperations::Clone(low_third);
+		arbitraryprecisioncalculation::mpftoperations::UpgradePrecision(low_third);
+		result_should_be_true = (result_should_be_true
+				&& arbitraryprecisioncalculation::mpftoperations::GetPrecision(low_third) >= 300
+				&& mpf_cmp(*low_third, *low_third_before) == 0
+				&& mpf_cmp(*low_third, *third) < 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(low_third);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(low_third_before);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(clone);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(sum);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(product);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(three);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(third);
+	arbitraryprecisioncalculation::mpftoperations::ReleaseValue(pi);
+	mpf_set_default_prec(memDefaultPrecision);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "value precision test succeeded.\n";
+	return 0;
+}
+
+// Formats the value like the original implementation of MpftToString.
+std::string referenceMpftToString(const mpf_t* value, int output_precision){
+	bool remove_trailing_zeros = (output_precision == -1);
+	if(remove_trailing_zeros) output_precision = mpf_get_default_prec() / log(10.0) * log(2.0);
+	std::vector<char> buf(output_precision + 100);
+	int string_size = gmp_snprintf(&buf[0], buf.size(), "%.*Fe", output_precision, *value);
+	std::string res(&buf[0]);
+	if(remove_trailing_zeros){
+		int e_pos = res.find('e');
+		int zeros = 0;
+		while(res[e_pos - 1 - zeros] == '0') ++zeros;
+		if(zeros > 0 && res[e_pos - 1 - zeros] == '.') --zeros;
+		res.erase(e_pos - zeros, zeros);
+	}
+	return (string_size < (int)buf.size() ? res : std::string());
+}
+
+int test_stringConversion(){
+	std::cout << "begin string conversion test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	unsigned int memDefaultPrecision = mpf_get_default_prec();
+	int memOutputPrecision = arbitraryprecisioncalculation::Configuration::getOutputPrecision();
+	arbitraryprecisioncalculation::configuration::OutputFormat memOutputFormat = arbitraryprecisioncalculation::Configuration::getOutputFormat();
+	const int output_precisions[] = {0, 1, 5, 10, 30, -1};
+	const unsigned int precisions[] = {64, 300, 3000};
+	for(unsigned int p = 0; p < sizeof(precisions) / sizeof(precisions[0]); p++){
+		mpf_set_default_prec(precisions[p]);
+		std::vector<mpf_t*> values;
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0));
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0));
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(-0.375));
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(9.99999999999));
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(1e-300));
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(-123456789e200));
+		{
+			mpf_t* three = arbitraryprecisioncalculation::mpftoperations::ToMpft(3.0);
+			mpf_t* third = arbitraryprecisioncalculation::mpftoperations::Divide(values[1], three);
+			values.push_back(arbitraryprecisioncalculation::mpftoperations::Sqrt(three));
+			values.push_back(arbitraryprecisioncalculation::mpftoperations::Negate(third));
+			values.push_back(arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(third, -1000));
+			values.push_back(arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(third, 1000));
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(three);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(third);
+		}
+		for(unsigned int i = 0; i < values.size(); i++){
+			arbitraryprecisioncalculation::Configuration::setOutputFormat(arbitraryprecisioncalculation::configuration::OUTPUT_FORMAT_DECIMAL);
+			for(unsigned int o = 0; o < sizeof(output_precisions) / sizeof(output_precisions[0]); o++){
+				arbitraryprecisioncalculation::Configuration::setOutputPrecision(output_precisions[o]);
+				std::string res = arbitraryprecisioncalculation::mpftoperations::MpftToString(values[i]);
+				std::string expected = referenceMpftToString(values[i], output_precisions[o]);
+				int result_should_be_true = (res == expected);
+				if(!result_should_be_true) std::cerr << "decimal output " << res << " differs from " << expected << std::endl;
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+			arbitraryprecisioncalculation::Configuration::setOutputFormat(arbitraryprecisioncalculation::configuration::OUTPUT_FORMAT_HEXADECIMAL);
+			std::string hex = arbitraryprecisioncalculation::mpftoperations::MpftToString(values[i]);
+			mpf_t* recovered = arbitraryprecisioncalculation::mpftoperations::HexadecimalStringToMpft(hex);
+			int result_should_be_true = (mpf_cmp(*recovered, *values[i]) == 0
+					&& hex.substr(0, hex.find('x') + 1) == (mpf_sgn(*values[i]) < 0 ? "-0x" : "0x"));
+			if(mpf_cmp_d(*values[i], mpf_get_d(*values[i])) == 0){
+				// the hexadecimal format is compatible to the format of C
+				result_should_be_true = result_should_be_true && (strtod(hex.c_str(), NULL) == mpf_get_d(*values[i]));
+			}
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(recovered);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	}
+	{
+		arbitraryprecisioncalculation::Configuration::setOutputFormat(arbitraryprecisioncalculation::configuration::OUTPUT_FORMAT_HEXADECIMAL);
+		mpf_t* value = arbitraryprecisioncalculation::mpftoperations::ToMpft(-0.375);
+		mpf_t* infinity = arbitraryprecisioncalculation::mpftoperations::HexadecimalStringToMpft("-inf");
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::MpftToString(value) == "-0x1.8p-2"
+				&& arbitraryprecisioncalculation::mpftoperations::IsMinusInfinity(infinity));
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(value);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(infinity);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::Configuration::setOutputFormat(memOutputFormat);
+	arbitraryprecisioncalculation::Configuration::setOutputPrecision(memOutputPrecision);
+	mpf_set_default_prec(memDefaultPrecision);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "string conversion test succeeded.\n";
+	return 0;
+}
+
+int test_binaryStorage(){
+	std::cout << "begin binary storage test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	unsigned int memDefaultPrecision = mpf_get_default_prec();
+	arbitraryprecisioncalculation::configuration::StorageFormat memStorageFormat = arbitraryprecisioncalculation::Configuration::getStorageFormat();
+	std::vector<mpf_t*> values;
+	values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0));
+	values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(-0.375));
+	values.push_back(arbitraryprecisioncalculation::mpftoperations::ToMpft(1e-300));
+	mpf_set_default_prec(300);
+	{
+		mpf_t* one = arbitraryprecisioncalculation::mpftoperations::ToMpft(1.0);
+		mpf_t* three = arbitraryprecisioncalculation::mpftoperations::ToMpft(-3.0);
+		values.push_back(arbitraryprecisioncalculation::mpftoperations::Divide(one, three));
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(one);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(three);
+	}
+	mpf_set_default_prec(memDefaultPrecision);
+	std::string file_name = "binary_storage_test.tmp";
+	{
+		// the formats may be mixed within one stream and with other tokens
+		std::ofstream output_stream(file_name.c_str(), std::ios::binary);
+		for(unsigned int i = 0; i < values.size(); i++){
+			arbitraryprecisioncalculation::Configuration::setStorageFormat(
+					(i % 2 == 0) ? arbitraryprecisioncalculation::configuration::STORAGE_FORMAT_BINARY : arbitraryprecisioncalculation::configuration::STORAGE_FORMAT_TEXT);
+			arbitraryprecisioncalculation::mpftoperations::StoreMpft(values[i], &output_stream);
+			output_stream << " " << i << "\n";
+		}
+		arbitraryprecisioncalculation::Configuration::setStorageFormat(arbitraryprecisioncalculation::configuration::STORAGE_FORMAT_BINARY);
+		arbitraryprecisioncalculation::mpftoperations::StoreMpft(NULL, &output_stream);
+		arbitraryprecisioncalculation::mpftoperations::StoreMpft(arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity(), &output_stream);
+		arbitraryprecisioncalculation::mpftoperations::StoreMpft(arbitraryprecisioncalculation::mpftoperations::GetMinusInfinity(), &output_stream);
+		output_stream.close();
+	}
+	{
+		std::ifstream input_stream(file_name.c_str(), std::ios::binary);
+		for(unsigned int i = 0; i < values.size(); i++){
+			mpf_t* loaded = arbitraryprecisioncalculation::mpftoperations::LoadMpft(&input_stream);
+			unsigned int index = values.size();
+			input_stream >> index;
+			int result_should_be_true = (loaded != NULL && index == i && mpf_cmp(*loaded, *values[i]) == 0);
+			if(result_should_be_true && i % 2 == 0){
+				// binary records restore the limbs and the precision exactly
+				result_should_be_true = ((*loaded)[0]._mp_size == (*values[i])[0]._mp_size
+						&& (*loaded)[0]._mp_exp == (*values[i])[0]._mp_exp
+						&& arbitraryprecisioncalculation::mpftoperations::GetPrecision(loaded) == arbitraryprecisioncalculation::mpftoperations::GetPrecision(values[i]));
+				int size = (*loaded)[0]._mp_size < 0 ? -(*loaded)[0]._mp_size : (*loaded)[0]._mp_size;
+				for(int limb = 0; result_should_be_true && limb < size; limb++){
+					result_should_be_true = ((*loaded)[0]._mp_d[limb] == (*values[i])[0]._mp_d[limb]);
+				}
+			}
+			if(loaded != NULL) arbitraryprecisioncalculation::mpftoperations::ReleaseValue(loaded);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		mpf_t* loaded_null = arbitraryprecisioncalculation::mpftoperations::LoadMpft(&input_stream);
+		mpf_t* loaded_plus_infinity = arbitraryprecisioncalculation::mpftoperations::LoadMpft(&input_stream);
+		mpf_t* loaded_minus_infinity = arbitraryprecisioncalculation::mpftoperations::LoadMpft(&input_stream);
+		int result_should_be_true = (loaded_null == NULL
+				&& arbitraryprecisioncalculation::mpftoperations::IsPlusInfinity(loaded_plus_infinity)
+				&& arbitraryprecisioncalculation::mpftoperations::IsMinusInfinity(loaded_minus_infinity));
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+		input_stream.close();
+	}
+	std::remove(file_name.c_str());
+	for(unsigned int i = 0; i < values.size(); i++){
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(values[i]);
+	}
+	arbitraryprecisioncalculation::Configuration::setStorageFormat(memStorageFormat);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "binary storage test succeeded.\n";
+	return 0;
+}
+
+int test_randomNumberGeneratorStreams(){
+	std::cout << "begin random number generator streams test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	std::vector<std::vector<std::string> > rng_descriptions ={
+		{"xoshiroRNG", "42", "0"},
+		{"xoshiroRNG", "42", "1"},
+		{"pcgRNG", "42", "54"},
+		{"pcgRNG", "42", "55"},
+		{"philoxRNG", "0"}};
+	std::vector<arbitraryprecisioncalculation::RandomNumberGenerator*> randoms;
+	for(unsigned int i = 0; i < rng_descriptions.size(); i++){
+		unsigned int parsed = 0;
+		randoms.push_back(arbitraryprecisioncalculation::parse::ParseRandomNumberGenerator(rng_descriptions[i], parsed));
+		int result_should_be_true = (parsed == rng_descriptions[i].size() && randoms[i] != NULL);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// known answers of the reference implementations (pcg64 seeded with 42 and stream 54, Philox4x32-10 with zero counter and key)
+		arbitraryprecisioncalculation::PhiloxRandomNumberGenerator philox(0);
+		philox.SetStream(0, 0, 0);
+		int result_should_be_true = ((unsigned long long)randoms[2]->RandomLongLong() == (0x86b1da1d72062b68ULL >> 1)
+				&& (unsigned long long)randoms[2]->RandomLongLong() == (0x1304aa46c9853d39ULL >> 1)
+				&& (unsigned long long)philox.RandomLongLong() == (0xe169c58d6627e8d5ULL >> 1)
+				&& (unsigned long long)philox.RandomLongLong() == (0x9b00dbd8bc57ac4cULL >> 1));
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	for(unsigned int i = 0; i < randoms.size(); i++){
+		// random values are in the interval [0,1] and the state is restored by the stored data
+		for(int j = 0; j < 10; j++){
+			mpf_t* value = randoms[i]->RandomMpft();
+			int result_should_be_true = (mpf_sgn(*value) >= 0 && mpf_cmp_ui(*value, 1) <= 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(value);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		std::string file_name = "random_number_generator_test.tmp";
+		{
+			std::ofstream output_stream(file_name.c_str());
+			randoms[i]->StoreData(&output_stream);
+			output_stream.close();
+		}
+		std::vector<long long> expected;
+		for(int j = 0; j < 5; j++) expected.push_back(randoms[i]->RandomLongLong());
+		unsigned int parsed = 0;
+		arbitraryprecisioncalculation::RandomNumberGenerator* restored = arbitraryprecisioncalculation::parse::ParseRandomNumberGenerator(rng_descriptions[i], parsed);
+		{
+			std::ifstream input_stream(file_name.c_str());
+			restored->LoadData(&input_stream);
+			input_stream.close();
+		}
+		std::remove(file_name.c_str());
+		for(int j = 0; j < 5; j++){
+			int result_should_be_true = (restored->RandomLongLong() == expected[j]);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		delete restored;
+	}
+	{
+		// different streams produce different sequences
+		int result_should_be_true = (randoms[0]->RandomLongLong() != randoms[1]->RandomLongLong()
+				&& randoms[2]->RandomLongLong() != randoms[3]->RandomLongLong());
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// the values of a counter based stream do not depend on previously drawn values
+		randoms[4]->SetStream(3, 1, 7);
+		long long first = randoms[4]->RandomLongLong();
+		long long second = randoms[4]->RandomLongLong();
+		randoms[4]->SetStream(2, 1, 7);
+		long long other_particle = randoms[4]->RandomLongLong();
+		randoms[4]->SetStream(3, 1, 7);
+		int result_should_be_true = (randoms[4]->RandomLongLong() == first && randoms[4]->RandomLongLong() == second
+				&& other_particle != first);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// a linear congruence with arbitrary modulus matches the direct calculation
+		std::vector<std::string> description = {"linearCongruenceRNG", "742", "specific", "23", "37", "1000000007", "fast"};
+		unsigned int parsed = 0;
+		arbitraryprecisioncalculation::RandomNumberGenerator* random = arbitraryprecisioncalculation::parse::ParseRandomNumberGenerator(description, parsed);
+		unsigned long long seed = 742;
+		for(int j = 0; j < 100; j++){
+			seed = (23 * seed + 37) % 1000000007ULL;
+			int result_should_be_true = ((unsigned long long)random->RandomLongLong() == seed);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+		delete random;
+	}
+	for(unsigned int i = 0; i < randoms.size(); i++){
+		delete randoms[i];
+	}
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "random number generator streams test succeeded.\n";
+	return 0;
+}
+
+int test_randomFill(){
+	std::cout << "begin random fill test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	unsigned int memDefaultPrecision = mpf_get_default_prec();
+	arbitraryprecisioncalculation::configuration::CheckPrecisionMode memCheckPrecisionMode = arbitraryprecisioncalculation::Configuration::getCheckPrecisionMode();
+	{
+		// the words are interpreted as fraction with the first word as most significant part
+		const unsigned long long words[] = {0ULL, 3ULL, 1ULL};
+		mpf_t* value = NULL;
+		arbitraryprecisioncalculation::mpftoperations::SetFractionBitsTo(&value, words, 3, 2);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Compare(value, 3.0 / 16.0 + 1.0 / 64.0) == 0);
+		const unsigned long long high_bit = (1ULL << 63);
+		arbitraryprecisioncalculation::mpftoperations::SetFractionBitsTo(&value, &high_bit, 1, 64);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::Compare(value, 0.5) == 0);
+		const unsigned long long zero = 0;
+		arbitraryprecisioncalculation::mpftoperations::SetFractionBitsTo(&value, &zero, 1, 64);
+		result_should_be_true = result_should_be_true && ((*value)[0]._mp_size == 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(value);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	mpf_set_default_prec(3000);
+	{
+		// batch generation yields the same values as single generation and all bits are random
+		arbitraryprecisioncalculation::Xoshiro256StarStarRandomNumberGenerator batch_random(5, 0);
+		arbitraryprecisioncalculation::Xoshiro256StarStarRandomNumberGenerator single_random(5, 0);
+		std::vector<mpf_t*> values;
+		const int sizes[] = {20, 10};
+		for(int fill = 0; fill < 2; fill++){
+			// the second call reuses and releases the values of the first call
+			arbitraryprecisioncalculation::vectoroperations::FillRandom(&values, sizes[fill], &batch_random);
+			for(unsigned int i = 0; i < values.size(); i++){
+				mpf_t* single = single_random.RandomMpft();
+				int result_should_be_true = (values.size() == (unsigned int)sizes[fill] && mpf_cmp(*single, *values[i]) == 0
+						&& mpf_sgn(*single) > 0 && mpf_cmp_ui(*single, 1) < 0 && (*single)[0]._mp_size > 40);
+				arbitraryprecisioncalculation::mpftoperations::ReleaseValue(single);
+				assert(result_should_be_true);
+				if(!(result_should_be_true)) return 1;
+			}
+		}
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+	}
+	{
+		// linear congruence generators write the same values into the limbs as by checked additions
+		arbitraryprecisioncalculation::FastM2P63LinearCongruenceRandomNumberGenerator fast_checked(1571204578482947281ULL, 12345678901234567ULL, 3);
+		arbitraryprecisioncalculation::FastM2P63LinearCongruenceRandomNumberGenerator fast_direct(1571204578482947281ULL, 12345678901234567ULL, 3);
+		arbitraryprecisioncalculation::IntenseM2P63LinearCongruenceRandomNumberGenerator intense_checked(1571204578482947281ULL, 12345678901234567ULL, 3, 25);
+		arbitraryprecisioncalculation::IntenseM2P63LinearCongruenceRandomNumberGenerator intense_direct(1571204578482947281ULL, 12345678901234567ULL, 3, 25);
+		for(int i = 0; i < 20; i++){
+			arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_ALWAYS);
+			mpf_t* fast_checked_value = fast_checked.RandomMpft();
+			mpf_t* intense_checked_value = intense_checked.RandomMpft();
+			arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(arbitraryprecisioncalculation::configuration::CHECK_PRECISION_NEVER);
+			mpf_t* fast_direct_value = fast_direct.RandomMpft();
+			mpf_t* intense_direct_value = intense_direct.RandomMpft();
+			int result_should_be_true = (mpf_cmp(*fast_checked_value, *fast_direct_value) == 0
+					&& mpf_cmp(*intense_checked_value, *intense_direct_value) == 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fast_checked_value);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(intense_checked_value);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(fast_direct_value);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(intense_direct_value);
+			assert(result_should_be_true);
+			if(!(result_should_be_true)) return 1;
+		}
+	}
+	arbitraryprecisioncalculation::Configuration::setCheckPrecisionMode(memCheckPrecisionMode);
+	mpf_set_default_prec(memDefaultPrecision);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "random fill test succeeded.\n";
+	return 0;
+}
+
+int test_gaussianSampler(){
+	std::cout << "begin gaussian sampler test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::configuration::GaussianAlgorithm memGaussianAlgorithm = arbitraryprecisioncalculation::Configuration::getGaussianAlgorithm();
+	{
+		// the reference algorithm fills vectors with the sequence of single values
+		arbitraryprecisioncalculation::Configuration::setGaussianAlgorithm(arbitraryprecisioncalculation::configuration::GAUSSIAN_ALGORITHM_REFERENCE);
+		arbitraryprecisioncalculation::Xoshiro256StarStarRandomNumberGenerator batch_random(7, 0);
+		arbitraryprecisioncalculation::Xoshiro256StarStarRandomNumberGenerator single_random(7, 0);
+		std::vector<mpf_t*> values;
+		arbitraryprecisioncalculation::vectoroperations::FillGaussianRandom(&values, 5, 0.5, 2.0, &batch_random);
+		int result_should_be_true = (values.size() == 5);
+		for(unsigned int i = 0; i < values.size(); i++){
+			mpf_t* single = arbitraryprecisioncalculation::mpftoperations::GetGaussianRandomMpft(0.5, 2.0, &single_random);
+			result_should_be_true = result_should_be_true && (mpf_cmp(*single, *values[i]) == 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(single);
+		}
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::Configuration::setGaussianAlgorithm(arbitraryprecisioncalculation::configuration::GAUSSIAN_ALGORITHM_POLAR);
+	{
+		// the polar algorithm uses both values of each pair
+		arbitraryprecisioncalculation::Xoshiro256StarStarRandomNumberGenerator batch_random(7, 0);
+		arbitraryprecisioncalculation::Xoshiro256StarStarRandomNumberGenerator pair_random(7, 0);
+		std::vector<mpf_t*> values;
+		arbitraryprecisioncalculation::vectoroperations::FillGaussianRandom(&values, 7, 0.5, 2.0, &batch_random);
+		int result_should_be_true = (values.size() == 7);
+		mpf_t* first = NULL;
+		mpf_t* second = NULL;
+		for(unsigned int i = 0; i < values.size(); i += 2){
+			arbitraryprecisioncalculation::mpftoperations::GaussianRandomPairTo(&first, &second, 0.5, 2.0, &pair_random);
+			result_should_be_true = result_should_be_true && (mpf_cmp(*first, *values[i]) == 0);
+			result_should_be_true = result_should_be_true && (i + 1 == values.size() || mpf_cmp(*second, *values[i + 1]) == 0);
+		}
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(first);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(second);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// compare the empirical distribution with the normal distribution
+		double mu = 1.5, sigma = 2.0;
+		int test_size = 20000;
+		double allowed_error = 0.02;
+		std::vector<mpf_t*> values;
+		arbitraryprecisioncalculation::vectoroperations::FillGaussianRandom(&values, test_size, mu, sigma);
+		std::vector<double> double_values = arbitraryprecisioncalculation::vectoroperations::MpftToDouble(values);
+		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(values);
+		sort(double_values.begin(), double_values.end());
+		double max_error = 0.0;
+		for(int i = 0; i < test_size; i++){
+			double expected_probability = ( erf((double_values[i] - mu) / (sigma * sqrt(2.0))) + 1 ) * 0.5;
+			max_error = std::max(max_error, std::abs(expected_probability - i / (double) test_size));
+			max_error = std::max(max_error, std::abs(expected_probability - (i + 1.0) / (double) test_size));
+		}
+		int result_should_be_true = (max_error < allowed_error);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::Configuration::setGaussianAlgorithm(memGaussianAlgorithm);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "gaussian sampler test succeeded.\n";
+	return 0;
+}
+
+int test_signAndCompareD(){
+	std::cout << "begin sign and compareD test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	{
+		mpf_t* plus_infinity = arbitraryprecisioncalculation::mpftoperations::GetPlusInfinity();
+		mpf_t* minus_infinity = arbitraryprecisioncalculation::mpftoperations::GetMinusInfinity();
+		mpf_t* zero = arbitraryprecisioncalculation::mpftoperations::ToMpft(0.0);
+		mpf_t* negative = arbitraryprecisioncalculation::mpftoperations::ToMpft(-2.5);
+		mpf_t* positive = arbitraryprecisioncalculation::mpftoperations::ToMpft(1e-300);
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::Sign(plus_infinity) == 1);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::Sign(minus_infinity) == -1);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::Sign(zero) == 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::Sign(negative) == -1);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::Sign(positive) == 1);
+		result_should_be_true = result_should_be_true && arbitraryprecisioncalculation::mpftoperations::IsZero(zero);
+		result_should_be_true = result_should_be_true && !arbitraryprecisioncalculation::mpftoperations::IsZero(positive);
+		result_should_be_true = result_should_be_true && !arbitraryprecisioncalculation::mpftoperations::IsZero(minus_infinity);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(negative, -2.5) == 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(negative, -2.0) < 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(positive, 0.0) > 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(plus_infinity, 1e300) > 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(plus_infinity, INFINITY) == 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(minus_infinity, INFINITY) < 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(minus_infinity, -INFINITY) == 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(negative, -INFINITY) > 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::CompareD(positive, INFINITY) < 0);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::mpftoperations::Compare(-INFINITY, negative) < 0);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(zero);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(negative);
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(positive);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// comparisons of values close to each other, in particular at the factors 2 and 1/2
+		std::vector<double> bases = {1.0, -1.0, 0.75, -3.0, 1e-20, 12345.678};
+		std::vector<double> factors = {2.0, 0.5, 1.0, 1.5, 0.75, 4.0, 0.25, -1.0, 0.0};
+		int result_should_be_true = 1;
+		for(unsigned int i = 0; i < bases.size(); i++){
+			for(unsigned int j = 0; j < factors.size(); j++){
+				for(int offset = -1; offset <= 1; offset++){
+					mpf_t* a = arbitraryprecisioncalculation::mpftoperations::ToMpft(bases[i]);
+					mpf_t* b = arbitraryprecisioncalculation::mpftoperations::Multiply(a, factors[j]);
+					mpf_t* tiny = arbitraryprecisioncalculation::mpftoperations::Multiply2Exp(a, -(int)mpf_get_default_prec() / 2);
+					mpf_t* tiny_offset = arbitraryprecisioncalculation::mpftoperations::Multiply(tiny, (double)offset);
+					arbitraryprecisioncalculation::mpftoperations::AddTo(&b, b, tiny_offset);
+					int expected = mpf_cmp(*a, *b);
+					expected = (expected > 0) - (expected < 0);
+					int actual = arbitraryprecisioncalculation::mpftoperations::Compare(a, b);
+					actual = (actual > 0) - (actual < 0);
+					result_should_be_true = result_should_be_true && (expected == actual);
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(a);
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(b);
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tiny);
+					arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tiny_offset);
+				}
+			}
+		}
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "sign and compareD test succeeded.\n";
+	return 0;
+}
+
+int test_assertionLevels(){
+	std::cout << "begin assertion levels test\n";
+	int in_use = arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse();
+	arbitraryprecisioncalculation::AssertionLevel memAssertionLevel = arbitraryprecisioncalculation::GetAssertionLevel();
+	{
+		// levels above the compiled level are reduced to the compiled level
+		arbitraryprecisioncalculation::SetAssertionLevel(arbitraryprecisioncalculation::ASSERTION_LEVEL_PARANOID);
+		int result_should_be_true = (arbitraryprecisioncalculation::GetAssertionLevel() == ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::IsAssertionLevelActive(arbitraryprecisioncalculation::ASSERTION_LEVEL_PARANOID)
+				== (ARBITRARY_PRECISION_CALCULATION_ASSERTION_LEVEL >= 2));
+		arbitraryprecisioncalculation::SetAssertionLevel(arbitraryprecisioncalculation::ASSERTION_LEVEL_OFF);
+		result_should_be_true = result_should_be_true && (arbitraryprecisioncalculation::GetAssertionLevel() == arbitraryprecisioncalculation::ASSERTION_LEVEL_OFF);
+		result_should_be_true = result_should_be_true && !arbitraryprecisioncalculation::IsAssertionLevelActive(arbitraryprecisioncalculation::ASSERTION_LEVEL_CHEAP);
+		result_should_be_true = result_should_be_true && arbitraryprecisioncalculation::IsAssertionLevelActive(arbitraryprecisioncalculation::ASSERTION_LEVEL_OFF);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// inactive checks do not evaluate their condition
+		int evaluations = 0;
+		AssertConditionAtLevel(arbitraryprecisioncalculation::ASSERTION_LEVEL_CHEAP, ++evaluations > 0, "");
+		arbitraryprecisioncalculation::SetAssertionLevel(memAssertionLevel);
+		AssertConditionAtLevel(arbitraryprecisioncalculation::ASSERTION_LEVEL_OFF, ++evaluations > 0, "");
+		int result_should_be_true = (evaluations == 1);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		// clones are equal independent of the assertion level
+		mpf_t* value = arbitraryprecisioncalculation::mpftoperations::ToMpft(-12.375);
+		int result_should_be_true = 1;
+		for(int level = arbitraryprecisioncalculation::ASSERTION_LEVEL_OFF; level <= arbitraryprecisioncalculation::ASSERTION_LEVEL_PARANOID; level++){
+			arbitraryprecisioncalculation::SetAssertionLevel((arbitraryprecisioncalculation::AssertionLevel)level);
+			mpf_t* clone = arbitraryprecisioncalculation::mpftoperations::Clone(value);
+			result_should_be_true = result_should_be_true && (mpf_cmp(*clone, *value) == 0);
+			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(clone);
+		}
+		arbitraryprecisioncalculation::mpftoperations::ReleaseValue(value);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	arbitraryprecisioncalculation::SetAssertionLevel(memAssertionLevel);
+	{
+		int result_should_be_true = (arbitraryprecisioncalculation::mpftoperations::GetNumberOfMpftValuesInUse() == in_use);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	std::cout << "assertion levels test succeeded.\n";
+	return 0;
+}
+
 int start_tests(int argv, char * argc[]) {
+	arbitraryprecisioncalculation::mpftoperations::SetMpftPoolDebugMode(true);
 	arbitraryprecisioncalculation::Configuration::setOutputPrecision(10);
 	arbitraryprecisioncalculation::Configuration::setInitialPrecision(BASE_PRECISION);
 	arbitraryprecisioncalculation::Configuration::setPrecisionSafetyMargin(BASE_PRECISION / 2);
@@ -1255,6 +2957,126 @@ int start_tests(int argv, char * argc[]) {
 		assert(result_should_be_true);
 		if(!(result_should_be_true)) return 1;
 	}
+	{
+		int result_should_be_true = (test_mpftPool() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_destinationPassing() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_mpfValueTypes() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_fusedVectorKernels() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_precisionCheckAlgorithms() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_checkPrecisionSampler() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_fastElementaryFunctions() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_sinCos() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_fastInverseTrigonometricFunctions() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_constants() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_fastPow() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_vectorElementaryFunctions() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_ballArithmetic() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_context() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_contextDefaultPrecision() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_contextSampledPrecisionChecks() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_valuePrecision() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_stringConversion() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_binaryStorage() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_randomNumberGeneratorStreams() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_randomFill() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_gaussianSampler() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_signAndCompareD() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
+	{
+		int result_should_be_true = (test_assertionLevels() == 0);
+		assert(result_should_be_true);
+		if(!(result_should_be_true)) return 1;
+	}
 	std::cout << "All tests passed.\n";
 	return 0;
 }
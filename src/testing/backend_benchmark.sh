@@ -0,0 +1,45 @@
+#!/bin/bash
+
+# Compares the running times of two builds of the PSO program (usually the gmp and the mpfr backend)
+# on the configurations of the test data sets.
+# Usage: backend_benchmark.sh <first executable> <second executable>
+
+FIRSTEXECUTABLE=$(readlink -f "$1")
+SECONDEXECUTABLE=$(readlink -f "$2")
+TESTBASEFOLDER=$(dirname $(readlink -f "$0"))/test_data_sets
+TMPFOLDER=$(mktemp -d)
+
+if [ ! -x "$FIRSTEXECUTABLE" ] || [ ! -x "$SECONDEXECUTABLE" ] ; then
+    echo "Usage: $0 <first executable> <second executable>"
+    exit 1
+fi
+
+# runs the executable on the configuration file in a clean folder and prints the elapsed seconds
+measureRun(){
+    executable="$1"
+    conffile="$2"
+    rm -rf "$TMPFOLDER/run"
+    mkdir "$TMPFOLDER/run"
+    cd "$TMPFOLDER/run"
+    cp "$conffile" tmpconffile.conf
+    start=$(date +%s.%N)
+    "$executable" c tmpconffile.conf > /dev/null 2> /dev/null
+    end=$(date +%s.%N)
+    cd "$TESTBASEFOLDER"
+    echo "$start $end" | awk '{printf "%.3f", $2 - $1}'
+}
+
+FIRSTTOTAL=0
+SECONDTOTAL=0
+echo "configuration $(basename $FIRSTEXECUTABLE)[s] $(basename $SECONDEXECUTABLE)[s]"
+while IFS= read -r -d $'\0' conffile; do
+    firsttime=$(measureRun "$FIRSTEXECUTABLE" "$conffile")
+    secondtime=$(measureRun "$SECONDEXECUTABLE" "$conffile")
+    echo "${conffile#$TESTBASEFOLDER/} $firsttime $secondtime"
+    FIRSTTOTAL=$(echo "$FIRSTTOTAL $firsttime" | awk '{printf "%.3f", $1 + $2}')
+    SECONDTOTAL=$(echo "$SECONDTOTAL $secondtime" | awk '{printf "%.3f", $1 + $2}')
+done < <(find "$TESTBASEFOLDER" -name "*.confBU" -path "*reference_data*" -print0 | sort -z)
+echo "total $FIRSTTOTAL $SECONDTOTAL"
+
+rm -rf "$TMPFOLDER"
+exit 0
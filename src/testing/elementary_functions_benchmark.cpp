@@ -0,0 +1,140 @@
+/**
+* @file   testing/elementary_functions_benchmark.cpp
+* @author Alexander Raß (alexander.rass@fau.de)
+* @date   October, 2026
+* @brief  This file contains a benchmark which compares the reference and the fast implementations of the elementary functions.
+*
+* @copyright
+* This project is released under the MIT License (MIT).
+*
+* @copyright
+* The MIT License (MIT)
+*
+* @copyright
+* Copyright (c) 2016 by Friedrich-Alexander-Universität Erlangen-Nürnberg and
+* Alexander Raß
+*
+* @copyright
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* @copyright
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* @copyright
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include <chrono>
+#include <gmp.h>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "arbitrary_precision_calculation/arbitraryprecisioncalculation.h"
+
+namespace arbitraryprecisioncalculation {
+
+/**
+* @brief Minimal time in seconds which is spent for the measurement of one function with one algorithm at one precision.
+*/
+const double MINIMAL_MEASUREMENT_TIME = 0.2;
+
+/**
+* @brief An elementary function of the mpftoperations namespace.
+*/
+typedef mpf_t* (*ElementaryFunction)(mpf_t*);
+
+/**
+* @brief Calculates sine and cosine. The fast implementation shares the argument reduction.
+*
+* @param x The argument.
+*
+* @return The sine of x. The cosine is released immediately.
+*/
+mpf_t* sinAndCos(mpf_t* x){
+	mpf_t* sin_result = NULL;
+	mpf_t* cos_result = NULL;
+	mpftoperations::SinCos(x, &sin_result, &cos_result);
+	mpftoperations::ReleaseValue(cos_result);
+	return sin_result;
+}
+
+/**
+* @brief Measures the average time of one evaluation of the function on the given arguments.
+*
+* @param function The measured function.
+* @param arguments The arguments, which are precalculated with the current default precision.
+* @param algorithm The implementation of the elementary functions which is used.
+*
+* @return The average time in microseconds.
+*/
+double measure(ElementaryFunction function, const std::vector<mpf_t*> & arguments, configuration::ElementaryFunctionAlgorithm algorithm){
+	Configuration::setElementaryFunctionAlgorithm(algorithm);
+	// warm up the cached constants and the pool of mpf_t values
+	for(unsigned int i = 0; i < arguments.size(); i++) mpftoperations::ReleaseValue(function(arguments[i]));
+	long long evaluations = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	double elapsed = 0.0;
+	do {
+		for(unsigned int i = 0; i < arguments.size(); i++) mpftoperations::ReleaseValue(function(arguments[i]));
+		evaluations += arguments.size();
+		elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while(elapsed < MINIMAL_MEASUREMENT_TIME);
+	return 1e6 * elapsed / evaluations;
+}
+
+/**
+* @brief Runs the benchmark for all elementary functions with fast kernels from 64 to 8192 bits.
+*
+* @return 0.
+*/
+int start_benchmark(){
+	Configuration::setCheckPrecisionMode(configuration::CHECK_PRECISION_NEVER);
+	std::vector<std::string> names = {"exp", "logE", "sin+cos", "arctan", "arcsin", "arccos"};
+	std::vector<ElementaryFunction> functions = {mpftoperations::Exp, mpftoperations::LogE, sinAndCos, mpftoperations::Arctan, mpftoperations::Arcsin, mpftoperations::Arccos};
+	std::vector<std::vector<double> > arguments = {
+			{-7.25, -0.3, 0.001, 1.0, 2.5, 40.0},
+			{1e-10, 0.25, 0.9999, 2.0, 3.5, 1e10},
+			{-0.3, 0.78, 2.5, 3.14159, -10.0, 123.456},
+			{-7.0, -0.5, 0.01, 0.3, 0.75, 1e8},
+			{-0.999, -0.5, 0.01, 0.3, 0.75, 0.99999},
+			{-0.999, -0.5, 0.01, 0.3, 0.75, 0.99999}};
+	std::cout << "average time per evaluation in microseconds" << std::endl;
+	std::cout << std::setw(10) << "function" << std::setw(8) << "bits" << std::setw(14) << "reference" << std::setw(14) << "fast" << std::setw(10) << "speedup" << std::endl;
+	for(unsigned int f = 0; f < functions.size(); f++){
+		for(int bits = 64; bits <= 8192; bits *= 2){
+			mpf_set_default_prec(bits);
+			std::vector<mpf_t*> values;
+			for(unsigned int i = 0; i < arguments[f].size(); i++) values.push_back(mpftoperations::ToMpft(arguments[f][i]));
+			double reference = measure(functions[f], values, configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE);
+			double fast = measure(functions[f], values, configuration::ELEMENTARY_FUNCTION_ALGORITHM_FAST);
+			vectoroperations::ReleaseValues(values);
+			std::cout << std::setw(10) << names[f] << std::setw(8) << bits
+					<< std::fixed << std::setprecision(2)
+					<< std::setw(14) << reference << std::setw(14) << fast << std::setw(10) << reference / fast
+					<< std::endl;
+		}
+	}
+	Configuration::setElementaryFunctionAlgorithm(configuration::ELEMENTARY_FUNCTION_ALGORITHM_REFERENCE);
+	return 0;
+}
+
+} // namespace arbitraryprecisioncalculation
+
+int main() {
+	return arbitraryprecisioncalculation::start_benchmark();
+}
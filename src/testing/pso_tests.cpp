@@ -169,20 +169,18 @@ int testFunction(Function* func, double (*evalFunc)(std::vector<double>), double
 	// check free of mpfts with functions distance_to_1D_local_optimum, getLower, getUpper:
 	{
 		configuration::g_dimensions = 10;
-		std::vector<mpf_t*> tmp = func->GetLowerSearchSpaceBound();
+		arbitraryprecisioncalculation::MpfVector tmp = func->GetLowerSearchSpaceBound();
 		{
 			int result_should_be_true = (tmp.size() == (unsigned int) configuration::g_dimensions);
 			assert(result_should_be_true);
 			if(!(result_should_be_true)) return 1;
 		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
 		tmp = func->GetUpperSearchSpaceBound();
 		{
 			int result_should_be_true = (tmp.size() == (unsigned int) configuration::g_dimensions);
 			assert(result_should_be_true);
 			if(!(result_should_be_true)) return 1;
 		}
-		arbitraryprecisioncalculation::vectoroperations::ReleaseValues(tmp);
 	}
 	{
 		{
@@ -55,6 +55,21 @@ else
 		fi
 	fi
 fi
+../../../../bin/high_precision_pso -backend > version.txt
+VERSIONLINES=$(cat version.txt | wc -l)
+if [ $VERSIONLINES -ne 1 ]; then
+	EXITCODE=1
+else
+	VERSIONWORDS=$(cat version.txt | wc -w)
+	if [ $VERSIONWORDS -ne 2 ]; then
+		EXITCODE=1
+	else
+		filecontent="$(cat version.txt)"
+		if [ "${filecontent:0:9}" != "backend: " ]; then
+			EXITCODE=1
+		fi
+	fi
+fi
 rm version.txt
 mkdir testfolder
 ../../../../bin/high_precision_pso > testfolder/usage.txt
@@ -48,10 +48,8 @@ void VelocityAdjustmentRandomBack::AdjustVelocity(Particle * p, std::vector<bool
 	for(unsigned int i = 0; i < adjustDimensions.size(); i++) {
 		if(adjustDimensions[i]) {
 			mpf_t* tmp = arbitraryprecisioncalculation::mpftoperations::Negate(p->velocity[i]);
-			mpf_t* tmp2 = arbitraryprecisioncalculation::mpftoperations::Randomize(tmp);
-			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(p->velocity[i]);
+			arbitraryprecisioncalculation::mpftoperations::RandomizeTo(&p->velocity[i], tmp);
 			arbitraryprecisioncalculation::mpftoperations::ReleaseValue(tmp);
-			p->velocity[i] = tmp2;
 		}
 	}
 }